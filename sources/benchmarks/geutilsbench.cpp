@@ -0,0 +1,1355 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Microbenchmarks for the public primitives of gerealutl.h, gebaseutl.h,
+// gevector3.h and their batch counterparts.
+//
+// Build (from the repository root) with CMake, target geutilsbench; the
+// geutilsbench_baseline and geutilsbench_check targets record and compare
+// a baseline. Without CMake:
+//   g++ -std=c++17 -O2 -Isources/geometricutils -o geutilsbench
+//       sources/benchmarks/geutilsbench.cpp sources/geometricutils/impl/*.cpp
+//
+// Usage:
+//   geutilsbench [--filter <substr>] [--size <n>] [--min-time-ms <ms>]
+//                [--save <baseline.json>] [--baseline <baseline.json>]
+//                [--threshold <percent>]
+//
+// With --baseline every benchmark slower than the stored ns/op by more than
+// --threshold percent (default 10) is reported and the exit code is 1.
+//
+// Not measured: GeZero and GeIsLittleEndian fold to constants, print() is
+// I/O, ge::equal/less/greater forward to functions that are not defined.
+
+#include "gerealutl.h"
+#include "gebaseutl.h"
+#include "gevector3.h"
+#include "gevector3array.h"
+#include "gevector3expr.h"
+#include "gevector3reduce.h"
+#include "gebvh.h"
+#include "geweld.h"
+#include "gepointfile.h"
+#include "gestream.h"
+#include "gepredicates.h"
+#include "gequantize.h"
+#include "gecompressed.h"
+#include "getransform.h"
+#include "gesort.h"
+#include "gecurve.h"
+#include "gearena.h"
+#include "gestats.h"
+#include "geparallel.h"
+#include "gevector3hash.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+//==============================================================================
+// Harness
+
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#ifdef GE_GCC_COMPILER
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* s_pSink;
+    s_pSink = &value;
+#endif
+}
+
+struct BenchOptions
+{
+    std::string filter;
+    GeSize size = 4096;
+    double minTimeMs = 50.0;
+    std::string savePath;
+    std::string baselinePath;
+    double thresholdPercent = 10.0;
+};
+
+struct BenchResult
+{
+    std::string name;
+    double nsPerOp;
+    double elementsPerSec;
+};
+
+class BenchRunner
+{
+public:
+    explicit BenchRunner(const BenchOptions& options)
+        : m_options{options}
+        {}
+
+    // Runs pass() (which processes `elements` items) until the minimum time
+    // is reached; keeps the best of several repetitions.
+    template <typename F>
+    void Run(const std::string& name, GeSize elements, F&& pass)
+    {
+        if (!m_options.filter.empty() && name.find(m_options.filter) == std::string::npos)
+        {
+            return;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const int kRepetitions = 5;
+        const double repTimeNs = m_options.minTimeMs * 1.e6 / kRepetitions;
+
+        pass(); // warm-up
+
+        double bestNsPerOp = 0.0;
+        for (int rep = 0; rep < kRepetitions; ++rep)
+        {
+            GeSize iterations = 0;
+            double elapsedNs = 0.0;
+            const auto start = Clock::now();
+            do
+            {
+                pass();
+                ++iterations;
+                elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            } while (elapsedNs < repTimeNs);
+
+            const double nsPerOp = elapsedNs / static_cast<double>(iterations * elements);
+            if (rep == 0 || nsPerOp < bestNsPerOp)
+            {
+                bestNsPerOp = nsPerOp;
+            }
+        }
+
+        BenchResult result{name, bestNsPerOp, 1.e9 / bestNsPerOp};
+        std::printf("%-56s %10.3f ns/op %14.3e elem/s\n", name.c_str(), result.nsPerOp, result.elementsPerSec);
+        m_results.push_back(result);
+    }
+
+    const std::vector<BenchResult>& Results() const { return m_results; }
+
+private:
+    BenchOptions m_options;
+    std::vector<BenchResult> m_results;
+};
+
+//==============================================================================
+// Baselines (one benchmark per line, written and read by this tool only)
+
+bool SaveBaseline(const std::string& path, const std::vector<BenchResult>& results)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+
+    out << "{\n  \"benchmarks\": [\n";
+    for (GeSize i = 0; i < results.size(); ++i)
+    {
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"ns_per_op\": %.6f, \"elements_per_sec\": %.6e}%s\n",
+                      results[i].name.c_str(), results[i].nsPerOp, results[i].elementsPerSec,
+                      (i + 1 < results.size()) ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+bool LoadBaseline(const std::string& path, std::map<std::string, double>& nsPerOpByName)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        return false;
+    }
+
+    const std::string kNameKey = "\"name\": \"";
+    const std::string kNsKey = "\"ns_per_op\": ";
+    std::string line;
+    while (std::getline(in, line))
+    {
+        const GeSize namePos = line.find(kNameKey);
+        const GeSize nsPos = line.find(kNsKey);
+        if (namePos == std::string::npos || nsPos == std::string::npos)
+        {
+            continue;
+        }
+
+        const GeSize nameBegin = namePos + kNameKey.size();
+        const GeSize nameEnd = line.find('"', nameBegin);
+        nsPerOpByName[line.substr(nameBegin, nameEnd - nameBegin)] =
+            std::strtod(line.c_str() + nsPos + kNsKey.size(), nullptr);
+    }
+    return true;
+}
+
+//==============================================================================
+// Inputs
+
+enum class Distribution
+{
+    kRandom,    // positive, uniform magnitudes
+    kDenormal,  // subnormal values of both signs
+    kNearZero,  // around the comparison threshold, both signs
+    kMixedSign  // uniform over a symmetric range
+};
+
+const char* ToString(Distribution d)
+{
+    switch (d)
+    {
+    case Distribution::kRandom: return "random";
+    case Distribution::kDenormal: return "denormal";
+    case Distribution::kNearZero: return "near_zero";
+    case Distribution::kMixedSign: return "mixed_sign";
+    }
+    return "";
+}
+
+const Distribution kAllDistributions[] = {
+    Distribution::kRandom, Distribution::kDenormal, Distribution::kNearZero, Distribution::kMixedSign
+};
+
+template <typename T>
+std::vector<T> MakeReals(Distribution d, GeSize n, std::mt19937_64& rng)
+{
+    std::vector<T> values(n);
+    std::uniform_real_distribution<T> unit(0, 1);
+    for (T& v : values)
+    {
+        const T sign = (rng() & 1) ? T(-1) : T(1);
+        switch (d)
+        {
+        case Distribution::kRandom:
+            v = T(1.e-3) + unit(rng) * T(1.e3);
+            break;
+        case Distribution::kDenormal:
+            v = sign * unit(rng) * std::numeric_limits<T>::min();
+            break;
+        case Distribution::kNearZero:
+            v = sign * unit(rng) * T(100) * std::numeric_limits<T>::epsilon();
+            break;
+        case Distribution::kMixedSign:
+            v = sign * unit(rng) * T(1.e3);
+            break;
+        }
+    }
+    return values;
+}
+
+// Second operand: half the pairs are a few ULPs apart, the rest independent.
+template <typename T>
+std::vector<T> MakePartners(const std::vector<T>& first, Distribution d, std::mt19937_64& rng)
+{
+    std::vector<T> second = MakeReals<T>(d, first.size(), rng);
+    for (GeSize i = 0; i < first.size(); i += 2)
+    {
+        T v = first[i];
+        for (int k = static_cast<int>(rng() % 4); k > 0; --k)
+        {
+            v = std::nextafter(v, std::numeric_limits<T>::infinity());
+        }
+        second[i] = v;
+    }
+    return second;
+}
+
+template <typename T>
+GeVector3Array<T> MakeVectors(Distribution d, GeSize n, std::mt19937_64& rng)
+{
+    const std::vector<T> x = MakeReals<T>(d, n, rng);
+    const std::vector<T> y = MakeReals<T>(d, n, rng);
+    const std::vector<T> z = MakeReals<T>(d, n, rng);
+
+    GeVector3Array<T> vectors;
+    vectors.reserve(n);
+    for (GeSize i = 0; i < n; ++i)
+    {
+        // sprinkle zero vectors to exercise the normalize() special case
+        vectors.push_back((i % 64 == 0) ? GeVector3<T>() : GeVector3<T>(x[i], y[i], z[i]));
+    }
+    return vectors;
+}
+
+//==============================================================================
+// Suites
+
+template <typename T>
+const char* TypeName();
+
+template <> const char* TypeName<GeReal32>() { return "f32"; }
+template <> const char* TypeName<GeReal64>() { return "f64"; }
+
+template <typename T>
+std::string Name(const char* function, Distribution d)
+{
+    return std::string(function) + "/" + TypeName<T>() + "/" + ToString(d);
+}
+
+// Applies op(a[i], b[i]) over the inputs and feeds the results to the sink.
+template <typename T, typename Op>
+void RunPairwise(BenchRunner& runner, const std::string& name,
+                 const std::vector<T>& a, const std::vector<T>& b, Op op)
+{
+    runner.Run(name, a.size(), [&]()
+    {
+        for (GeSize i = 0; i < a.size(); ++i)
+        {
+            DoNotOptimize(op(a[i], b[i]));
+        }
+    });
+}
+
+template <typename T>
+void RunRealSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const T tol = GeDefaultEpsilon<T>::Value();
+
+    for (Distribution d : kAllDistributions)
+    {
+        const std::vector<T> a = MakeReals<T>(d, options.size, rng);
+        const std::vector<T> b = MakePartners(a, d, rng);
+
+        RunPairwise(runner, Name<T>("GeRealAbs", d), a, b, [](T x, T) { return GeRealAbs(x); });
+        RunPairwise(runner, Name<T>("GeIsRealNegative", d), a, b, [](T x, T) { return GeIsRealNegative(x); });
+        RunPairwise(runner, Name<T>("GeIsRealEqualByUlps", d), a, b, [](T x, T y) { return GeIsRealEqualByUlps(x, y, 4); });
+        RunPairwise(runner, Name<T>("GeIsRealLessByUlps", d), a, b, [](T x, T y) { return GeIsRealLessByUlps(x, y, 4); });
+        RunPairwise(runner, Name<T>("GeRealEqual", d), a, b, [tol](T x, T y) { return GeRealEqual(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeRealLess", d), a, b, [tol](T x, T y) { return GeRealLess(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeRealGreater", d), a, b, [tol](T x, T y) { return GeRealGreater(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeRealCompare", d), a, b, [tol](T x, T y) { return GeRealCompare(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeRealMax", d), a, b, [tol](T x, T y) { return GeRealMax(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeRealMin", d), a, b, [tol](T x, T y) { return GeRealMin(x, y, tol); });
+        RunPairwise(runner, Name<T>("GeSqrt", d), a, b, [](T x, T) { return GeSqrt(x < 0 ? -x : x); });
+    }
+}
+
+void RunRealBatchSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    for (Distribution d : kAllDistributions)
+    {
+        const std::vector<GeReal32> a = MakeReals<GeReal32>(d, options.size, rng);
+        const std::vector<GeReal32> b = MakePartners(a, d, rng);
+        std::unique_ptr<bool[]> bools(new bool[a.size()]);
+        std::vector<GeUint64> mask((a.size() + 63) / 64);
+        const GeSpan<bool> boolSpan(bools.get(), a.size());
+
+        runner.Run(Name<GeReal32>("GeIsRealEqualByUlps[bools]", d), a.size(), [&]()
+        {
+            GeIsRealEqualByUlps(a, b, 4, boolSpan);
+            DoNotOptimize(bools[0]);
+        });
+        runner.Run(Name<GeReal32>("GeIsRealLessByUlps[bools]", d), a.size(), [&]()
+        {
+            GeIsRealLessByUlps(a, b, 4, boolSpan);
+            DoNotOptimize(bools[0]);
+        });
+        runner.Run(Name<GeReal32>("GeIsRealEqualByUlps[mask]", d), a.size(), [&]()
+        {
+            GeIsRealEqualByUlps(a, b, 4, mask);
+            DoNotOptimize(mask[0]);
+        });
+        runner.Run(Name<GeReal32>("GeIsRealLessByUlps[mask]", d), a.size(), [&]()
+        {
+            GeIsRealLessByUlps(a, b, 4, mask);
+            DoNotOptimize(mask[0]);
+        });
+    }
+}
+
+// One fixed operand against many: binary searches and filter scans with
+// the free functions against the precomputed GeRealComparator
+template <typename T>
+void RunRealSearchSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const T tol = GeDefaultEpsilon<T>::Value();
+    const Distribution d = Distribution::kMixedSign;
+    std::vector<T> sorted = MakeReals<T>(d, options.size, rng);
+    std::sort(sorted.begin(), sorted.end());
+    const std::vector<T> keys = MakeReals<T>(d, 256, rng);
+    std::vector<GeUint32> indices(sorted.size());
+
+    runner.Run(Name<T>("lower_bound<GeRealLess>", d), keys.size(), [&]()
+    {
+        GeSize sum = 0;
+        for (T key : keys)
+            sum += std::lower_bound(sorted.begin(), sorted.end(), key, [tol](T x, T y) { return GeRealLess(x, y, tol); }) - sorted.begin();
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("lower_bound<GeRealComparator>", d), keys.size(), [&]()
+    {
+        GeSize sum = 0;
+        for (T key : keys)
+            sum += std::lower_bound(sorted.begin(), sorted.end(), GeRealComparator<T>(key, tol), GeRealLessOrder<T>(tol)) - sorted.begin();
+        DoNotOptimize(sum);
+    });
+
+    const T value = sorted[sorted.size() / 2];
+    runner.Run(Name<T>("filter<GeRealLess>", d), sorted.size(), [&]()
+    {
+        GeSize count = 0;
+        for (GeSize i = 0; i < sorted.size(); ++i)
+        {
+            if (GeRealLess(sorted[i], value, tol))
+                indices[count++] = static_cast<GeUint32>(i);
+        }
+        DoNotOptimize(count);
+    });
+    runner.Run(Name<T>("GeRealBatchFilter", d), sorted.size(), [&]()
+    {
+        DoNotOptimize(GeRealBatchFilter<T>(sorted, GeRealComparator<T>(value, tol), GeRealOrder::kLess, indices));
+    });
+    std::vector<GeUint64> mask((sorted.size() + 63) / 64);
+    runner.Run(Name<T>("GeRealBatchMask", d), sorted.size(), [&]()
+    {
+        GeRealBatchMask<T>(sorted, GeRealComparator<T>(value, tol), GeRealOrder::kLess, mask);
+        DoNotOptimize(mask[0]);
+    });
+}
+
+void RunIntSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    std::vector<GeInt32> a(options.size);
+    std::vector<GeInt32> b(options.size);
+    for (GeSize i = 0; i < options.size; ++i)
+    {
+        a[i] = static_cast<GeInt32>(rng());
+        b[i] = static_cast<GeInt32>(rng());
+    }
+
+    RunPairwise(runner, "GeIntAbs/i32/random", a, b, [](GeInt32 x, GeInt32) { return GeIntAbs(x); });
+    RunPairwise(runner, "GeIntMax/i32/random", a, b, [](GeInt32 x, GeInt32 y) { return GeIntMax(x, y); });
+    RunPairwise(runner, "GeIntMin/i32/random", a, b, [](GeInt32 x, GeInt32 y) { return GeIntMin(x, y); });
+}
+
+template <typename T>
+void RunVectorSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution kVectorDistributions[] = {Distribution::kMixedSign, Distribution::kNearZero};
+
+    for (Distribution d : kVectorDistributions)
+    {
+        const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+        const GeVector3Array<T> b = MakeVectors<T>(d, options.size, rng);
+        std::vector<GeVector3<T>> aos(a.size());
+        std::vector<GeVector3<T>> bos(b.size());
+        for (GeSize i = 0; i < a.size(); ++i)
+        {
+            aos[i] = a[i];
+            bos[i] = b[i];
+        }
+
+        using V = GeVector3<T>;
+        RunPairwise(runner, Name<T>("GeVector3::operator+", d), aos, bos, [](const V& u, const V& v) { return u + v; });
+        RunPairwise(runner, Name<T>("GeVector3::operator-", d), aos, bos, [](const V& u, const V& v) { return u - v; });
+        RunPairwise(runner, Name<T>("GeVector3::operator*", d), aos, bos, [](const V& u, const V& v) { return u * v.x; });
+        RunPairwise(runner, Name<T>("GeVector3::dot", d), aos, bos, [](const V& u, const V& v) { return u.dot(v); });
+        RunPairwise(runner, Name<T>("GeVector3::cross", d), aos, bos, [](const V& u, const V& v) { return u.cross(v); });
+        RunPairwise(runner, Name<T>("GeVector3::magnitude_square", d), aos, bos, [](const V& u, const V&) { return u.magnitude_square(); });
+        RunPairwise(runner, Name<T>("GeVector3::magnitude", d), aos, bos, [](const V& u, const V&) { return u.magnitude(); });
+        RunPairwise(runner, Name<T>("GeVector3::normalize", d), aos, bos, [](const V& u, const V&) { return u.normalize(); });
+        RunPairwise(runner, Name<T>("GeVector3::normalize<refined>", d), aos, bos, [](const V& u, const V&) { return u.template normalize<GePrecision::kRefined>(); });
+        RunPairwise(runner, Name<T>("GeVector3::normalize<approx>", d), aos, bos, [](const V& u, const V&) { return u.template normalize<GePrecision::kApproximate>(); });
+
+        // a + b * s - a x b, eagerly and as one lazy expression
+        const T s = T(0.75);
+        RunPairwise(runner, Name<T>("GeVector3::a+b*s-cross", d), aos, bos, [s](const V& u, const V& v) { return u + v * s - u.cross(v); });
+        RunPairwise(runner, Name<T>("GeLazy::a+b*s-cross", d), aos, bos, [s](const V& u, const V& v) -> V { return GeLazy(u) + GeLazy(v) * s - GeCross(GeLazy(u), v); });
+
+        std::vector<T> scalars(a.size());
+        GeVector3Array<T> out(a.size());
+
+        runner.Run(Name<T>("GeVector3BatchDot", d), a.size(), [&]()
+        {
+            GeVector3BatchDot<T>(a.cview(), b.cview(), scalars.data());
+            DoNotOptimize(scalars[0]);
+        });
+        runner.Run(Name<T>("GeVector3BatchCross", d), a.size(), [&]()
+        {
+            GeVector3BatchCross<T>(a.cview(), b.cview(), out.view());
+            DoNotOptimize(out.x()[0]);
+        });
+        runner.Run(Name<T>("GeVector3BatchEval<a+b*s-cross>", d), a.size(), [&]()
+        {
+            GeVector3BatchEval(out.view(), GeLazy(a) + GeLazy(b) * s - GeCross(GeLazy(a), GeLazy(b)));
+            DoNotOptimize(out.x()[0]);
+        });
+        runner.Run(Name<T>("GeVector3BatchMagnitudeSquare", d), a.size(), [&]()
+        {
+            GeVector3BatchMagnitudeSquare<T>(a.cview(), scalars.data());
+            DoNotOptimize(scalars[0]);
+        });
+        runner.Run(Name<T>("GeVector3BatchMagnitude", d), a.size(), [&]()
+        {
+            GeVector3BatchMagnitude<T>(a.cview(), scalars.data());
+            DoNotOptimize(scalars[0]);
+        });
+        runner.Run(Name<T>("GeVector3BatchNormalize", d), a.size(), [&]()
+        {
+            GeVector3BatchNormalize<T>(a.cview(), out.view());
+            DoNotOptimize(out.x()[0]);
+        });
+
+        const std::pair<GePrecision, const char*> kPrecisions[] = {
+            {GePrecision::kExact, "exact"}, {GePrecision::kRefined, "refined"}, {GePrecision::kApproximate, "approx"}};
+        for (const auto& precision : kPrecisions)
+        {
+            const std::string suffix = std::string("<") + precision.second + ">";
+            runner.Run(Name<T>(("GeVector3BatchInvMagnitude" + suffix).c_str(), d), a.size(), [&]()
+            {
+                GeVector3BatchInvMagnitude<T>(a.cview(), scalars.data(), precision.first);
+                DoNotOptimize(scalars[0]);
+            });
+            if (precision.first == GePrecision::kExact)
+                continue; // covered by the entries above
+            runner.Run(Name<T>(("GeVector3BatchMagnitude" + suffix).c_str(), d), a.size(), [&]()
+            {
+                GeVector3BatchMagnitude<T>(a.cview(), scalars.data(), precision.first);
+                DoNotOptimize(scalars[0]);
+            });
+            runner.Run(Name<T>(("GeVector3BatchNormalize" + suffix).c_str(), d), a.size(), [&]()
+            {
+                GeVector3BatchNormalize<T>(a.cview(), out.view(), precision.first);
+                DoNotOptimize(out.x()[0]);
+            });
+        }
+    }
+}
+
+template <typename T>
+void RunReduceSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const GeVector3<T> direction(T(0.48), T(-0.6), T(0.64));
+    GeReduceOptions serial;
+    serial.parallel = false;
+
+    runner.Run(Name<T>("GeVector3BatchBounds", d), a.size(), [&]()
+    {
+        DoNotOptimize(GeVector3BatchBounds<T>(a.cview(), serial).min.x);
+    });
+    runner.Run(Name<T>("GeVector3BatchBounds<parallel>", d), a.size(), [&]()
+    {
+        DoNotOptimize(GeVector3BatchBounds<T>(a.cview()).min.x);
+    });
+    runner.Run(Name<T>("GeVector3BatchCentroid", d), a.size(), [&]()
+    {
+        DoNotOptimize(GeVector3BatchCentroid<T>(a.cview(), serial).x);
+    });
+    runner.Run(Name<T>("GeVector3BatchRealMinMax", d), a.size(), [&]()
+    {
+        GeVector3<T> lo, hi;
+        DoNotOptimize(GeVector3BatchRealMinMax<T>(a.cview(), T(1.e-4), lo, hi, serial));
+    });
+    runner.Run(Name<T>("GeVector3BatchExtreme", d), a.size(), [&]()
+    {
+        DoNotOptimize(GeVector3BatchExtreme<T>(a.cview(), direction, serial));
+    });
+
+    // scalar loop reference for the bounds
+    runner.Run(Name<T>("GeAabb3::Expand", d), a.size(), [&]()
+    {
+        GeAabb3<T> box;
+        for (GeSize i = 0; i < a.size(); ++i)
+            box.Expand(a[i]);
+        DoNotOptimize(box.min.x);
+    });
+}
+
+template <typename T>
+void RunPointFileSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> points = MakeVectors<T>(d, options.size, rng);
+    const GeByteOrder foreign = GeNativeByteOrder() == GeByteOrder::kLittle ? GeByteOrder::kBig : GeByteOrder::kLittle;
+    const char* nativePath = "geutilsbench_native.tmp";
+    const char* foreignPath = "geutilsbench_foreign.tmp";
+    if (!GeWritePointFile<T>(nativePath, points.cview()) ||
+        !GeWritePointFile<T>(foreignPath, points.cview(), GePointLayout::kSoa, foreign))
+    {
+        std::fprintf(stderr, "cannot write point files, skipping\n");
+        return;
+    }
+
+    runner.Run(Name<T>("GePointFile::Open+View", d), points.size(), [&]()
+    {
+        GePointFile file;
+        GeVector3ArrayCView<T> view{};
+        file.Open(nativePath);
+        file.View(view);
+        DoNotOptimize(view.x);
+    });
+
+    GeVector3Array<T> copy;
+    runner.Run(Name<T>("GePointFile::Open+Read", d), points.size(), [&]()
+    {
+        GePointFile file;
+        file.Open(nativePath);
+        file.Read(copy);
+        DoNotOptimize(copy.x());
+    });
+    runner.Run(Name<T>("GePointFile::Open+Read<byteswap>", d), points.size(), [&]()
+    {
+        GePointFile file;
+        file.Open(foreignPath);
+        file.Read(copy);
+        DoNotOptimize(copy.x());
+    });
+
+    const GeAabb3<T> half(GeVector3<T>(T(-0.5), T(-0.5), T(-0.5)), GeVector3<T>(T(0.5), T(0.5), T(0.5)));
+    for (GeSize prefetch : {GeSize(0), GeSize(2)})
+    {
+        GeStreamOptions streamOptions;
+        streamOptions.chunkSize = 1 << 14;
+        streamOptions.prefetch = prefetch;
+        const char* name = prefetch == 0 ? "GePointStream<inline>" : "GePointStream<prefetch>";
+        runner.Run(Name<T>(name, d), points.size(), [&]()
+        {
+            GePointFileReader file;
+            file.Open(nativePath);
+            GePointStream<T> stream = GeMakePointStream<T>(file, streamOptions);
+            stream.FilterInBounds(half, T(1e-6));
+            const GeAabb3<T> box = stream.Reduce(GeAabb3<T>(), [](GeAabb3<T>& acc, GeVector3ArrayCView<T> chunk) {
+                acc.Expand(GeVector3BatchBounds<T>(chunk));
+            });
+            DoNotOptimize(box.min.x);
+        });
+    }
+
+    std::remove(nativePath);
+    std::remove(foreignPath);
+}
+
+template <typename T>
+void RunBvhSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> soa = MakeVectors<T>(d, options.size, rng);
+    const GeVector3Array<T> querySoa = MakeVectors<T>(d, options.size, rng);
+    std::vector<GeVector3<T>> points(soa.size());
+    std::vector<GeVector3<T>> queries(querySoa.size());
+    for (GeSize i = 0; i < soa.size(); ++i)
+    {
+        points[i] = soa[i];
+        queries[i] = querySoa[i];
+    }
+
+    GeBvhBuildOptions serial;
+    serial.parallel = false;
+    runner.Run(Name<T>("GeBvh::BuildFromPoints", d), points.size(), [&]()
+    {
+        GeBvh<T> bvh;
+        bvh.BuildFromPoints(points, serial);
+        DoNotOptimize(bvh.NodeCount());
+    });
+    runner.Run(Name<T>("GeBvh::BuildFromPoints<parallel>", d), points.size(), [&]()
+    {
+        GeBvh<T> bvh;
+        bvh.BuildFromPoints(points);
+        DoNotOptimize(bvh.NodeCount());
+    });
+
+    GeBvh<T> bvh;
+    bvh.BuildFromPoints(points);
+    std::vector<typename GeBvh<T>::Hit> hits;
+
+    runner.Run(Name<T>("GeBvh::Nearest", d), queries.size(), [&]()
+    {
+        for (const GeVector3<T>& q : queries)
+            DoNotOptimize(bvh.Nearest(q).index);
+    });
+    runner.Run(Name<T>("GeBvh::KNearest<8>", d), queries.size(), [&]()
+    {
+        for (const GeVector3<T>& q : queries)
+        {
+            bvh.KNearest(q, 8, hits);
+            DoNotOptimize(hits.data());
+        }
+    });
+    runner.Run(Name<T>("GeBvh::RadiusSearch", d), queries.size(), [&]()
+    {
+        const T radius = static_cast<T>(0.05) * bvh.Bounds().Extent().magnitude();
+        for (const GeVector3<T>& q : queries)
+        {
+            bvh.RadiusSearch(q, radius, hits);
+            DoNotOptimize(hits.data());
+        }
+    });
+
+    // linear scan reference for the nearest query
+    runner.Run(Name<T>("LinearScan::Nearest", d), queries.size(), [&]()
+    {
+        for (const GeVector3<T>& q : queries)
+        {
+            GeSize best = 0;
+            T bestDistance = std::numeric_limits<T>::infinity();
+            for (GeSize i = 0; i < points.size(); ++i)
+            {
+                const T distance = (points[i] - q).magnitude_square();
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = i;
+                }
+            }
+            DoNotOptimize(best);
+        }
+    });
+}
+
+template <typename T>
+void RunTransformSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const GeVector3<T> axis(T(0.48), T(-0.6), T(0.64));
+    const GeQuaternion<T> q = GeQuaternion<T>::FromAxisAngle(axis, T(0.7));
+    const GeMatrix4<T> m = GeMatrix4<T>::Affine(q.to_matrix(), GeVector3<T>(T(1), T(-2), T(3)));
+    GeVector3Array<T> out(a.size());
+    GeTransformOptions serial;
+    serial.parallel = false;
+
+    runner.Run(Name<T>("GeVector3BatchTransformPoints", d), a.size(), [&]()
+    {
+        GeVector3BatchTransformPoints<T>(a.cview(), m, out.view(), serial);
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchTransformPoints<parallel>", d), a.size(), [&]()
+    {
+        GeVector3BatchTransformPoints<T>(a.cview(), m, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchProjectPoints", d), a.size(), [&]()
+    {
+        GeVector3BatchProjectPoints<T>(a.cview(), m, out.view(), serial);
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchRotate", d), a.size(), [&]()
+    {
+        GeVector3BatchRotate<T>(a.cview(), q, out.view(), serial);
+        DoNotOptimize(out.view().x[0]);
+    });
+
+    // scalar loop references over AoS vectors
+    std::vector<GeVector3<T>> aos(a.size());
+    std::vector<GeVector3<T>> aosOut(a.size());
+    for (GeSize i = 0; i < a.size(); ++i)
+        aos[i] = a[i];
+    runner.Run(Name<T>("GeMatrix4::transform_point", d), a.size(), [&]()
+    {
+        for (GeSize i = 0; i < aos.size(); ++i)
+            aosOut[i] = m.transform_point(aos[i]);
+        DoNotOptimize(aosOut[0].x);
+    });
+    runner.Run(Name<T>("GeQuaternion::rotate", d), a.size(), [&]()
+    {
+        for (GeSize i = 0; i < aos.size(); ++i)
+            aosOut[i] = q.rotate(aos[i]);
+        DoNotOptimize(aosOut[0].x);
+    });
+}
+
+template <typename T>
+void RunQuantizeSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const GeQuantizeGrid<T> grid = GeQuantizeGrid<T>::template Fit<GeInt32>(GeVector3BatchBounds<T>(a.cview()));
+    const GeQuantizeGrid<T> grid16 = GeQuantizeGrid<T>::template Fit<GeInt16>(GeVector3BatchBounds<T>(a.cview()));
+    GeVector3Array<GeInt32> q32(a.size());
+    GeVector3Array<GeInt16> q16(a.size());
+    GeVector3Array<T> out(a.size());
+
+    runner.Run(Name<T>("GeVector3BatchQuantize<int32>", d), a.size(), [&]()
+    {
+        GeVector3BatchQuantize<T, GeInt32>(a.cview(), grid, q32.view());
+        DoNotOptimize(q32.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchQuantize<int16>", d), a.size(), [&]()
+    {
+        GeVector3BatchQuantize<T, GeInt16>(a.cview(), grid16, q16.view());
+        DoNotOptimize(q16.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchDequantize<int32>", d), a.size(), [&]()
+    {
+        GeVector3BatchDequantize<T, GeInt32>(q32.cview(), grid, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3BatchDequantize<int16>", d), a.size(), [&]()
+    {
+        GeVector3BatchDequantize<T, GeInt16>(q16.cview(), grid16, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+
+    // scalar loop reference
+    runner.Run(Name<T>("QuantizeScaled<int32>", d), a.size(), [&]()
+    {
+        const GeVector3<T> scale = grid.Scale();
+        const GeVector3ArrayCView<T> in = a.cview();
+        const GeVector3ArrayView<GeInt32> q = q32.view();
+        for (GeSize i = 0; i < in.size; ++i)
+        {
+            q.x[i] = ge::details::QuantizeScaled<GeInt32>((in.x[i] - grid.origin.x) * scale.x);
+            q.y[i] = ge::details::QuantizeScaled<GeInt32>((in.y[i] - grid.origin.y) * scale.y);
+            q.z[i] = ge::details::QuantizeScaled<GeInt32>((in.z[i] - grid.origin.z) * scale.z);
+        }
+        DoNotOptimize(q.x[0]);
+    });
+}
+
+void RunCompressedSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    using T = GeReal32;
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    GeVector3Array<T> normals = a;
+    GeVector3BatchNormalize<T>(a.cview(), normals.view());
+
+    GeVector3ArrayHalf half(a.cview());
+    GeNormalArrayOct32 oct(normals.cview());
+    GeVector3ArrayQuantized16 quantized(a.cview());
+    GeVector3Array<T> out(a.size());
+
+    runner.Run(Name<T>("GeVector3ArrayHalf::Assign", d), a.size(), [&]()
+    {
+        half.Assign(a.cview());
+        DoNotOptimize(half.cview().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3ArrayHalf::Decode", d), a.size(), [&]()
+    {
+        half.Decode(0, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeNormalArrayOct32::Assign", d), a.size(), [&]()
+    {
+        oct.Assign(normals.cview());
+        DoNotOptimize(oct.data()[0]);
+    });
+    runner.Run(Name<T>("GeNormalArrayOct32::Decode", d), a.size(), [&]()
+    {
+        oct.Decode(0, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3ArrayQuantized16::Assign", d), a.size(), [&]()
+    {
+        quantized.Assign(a.cview());
+        DoNotOptimize(quantized.cview().x[0]);
+    });
+    runner.Run(Name<T>("GeVector3ArrayQuantized16::Decode", d), a.size(), [&]()
+    {
+        quantized.Decode(0, out.view());
+        DoNotOptimize(out.view().x[0]);
+    });
+
+    // a float kernel fed from compressed storage vs from the float lanes
+    GeReduceOptions serial;
+    serial.parallel = false;
+    runner.Run(Name<T>("GeForEachDecodedBlock<half>+Bounds", d), a.size(), [&]()
+    {
+        GeAabb3<T> box;
+        GeForEachDecodedBlock(half, [&](GeVector3ArrayCView<T> block, GeSize)
+        {
+            box.Expand(GeVector3BatchBounds<T>(block, serial));
+        });
+        DoNotOptimize(box.min.x);
+    });
+    runner.Run(Name<T>("GeVector3BatchBounds", d), a.size(), [&]()
+    {
+        DoNotOptimize(GeVector3BatchBounds<T>(a.cview(), serial).min.x);
+    });
+
+    // measured error against the float input, next to the documented bounds
+    if (options.filter.empty() || std::string("compressed_error").find(options.filter) != std::string::npos)
+    {
+        double halfError = 0.0;
+        double octError = 0.0;
+        GeVector3<T> quantizedError;
+        for (GeSize i = 0; i < a.size(); ++i)
+        {
+            const GeVector3<T> p = a[i];
+            const GeVector3<T> h = half[i];
+            const GeVector3<T> q = quantized[i];
+            const GeVector3<T> n = oct[i];
+            const T components[3][3] = {{p.x, h.x, q.x}, {p.y, h.y, q.y}, {p.z, h.z, q.z}};
+            for (const auto& c : components)
+            {
+                if (std::abs(c[0]) >= T(6.103515625e-5))
+                    halfError = std::max(halfError, double(std::abs(c[1] - c[0]) / std::abs(c[0])));
+            }
+            quantizedError = GeVector3<T>(std::max(quantizedError.x, std::abs(q.x - p.x)),
+                                          std::max(quantizedError.y, std::abs(q.y - p.y)),
+                                          std::max(quantizedError.z, std::abs(q.z - p.z)));
+            // zero inputs have no direction to compare with
+            const GeVector3<T> unit = normals[i];
+            if (unit.dot(unit) > T(0.5))
+            {
+                const GeVector3<T> e = n - unit;
+                octError = std::max(octError, 2.0 * std::asin(std::min(1.0, std::sqrt(double(e.dot(e))) / 2)));
+            }
+        }
+        const GeVector3<T> quantizedBound = quantized.MaxError();
+        std::printf("compressed_error half relative %.3e (bound %.3e)\n", halfError, double(GeVector3ArrayHalf::kRelativeError));
+        std::printf("compressed_error oct32 angle   %.3e (bound %.3e)\n", octError, double(GeNormalArrayOct32::kMaxAngularError));
+        std::printf("compressed_error q16 x/y/z     %.3e %.3e %.3e (bound %.3e %.3e %.3e)\n",
+                    double(quantizedError.x), double(quantizedError.y), double(quantizedError.z),
+                    double(quantizedBound.x), double(quantizedBound.y), double(quantizedBound.z));
+    }
+}
+
+template <typename T>
+void RunWeldSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    // every vertex is repeated a few times with sub-tolerance noise, as in a
+    // triangle soup whose corners were written out per face
+    const Distribution d = Distribution::kMixedSign;
+    const T tol = static_cast<T>(1.e-5);
+    const GeVector3Array<T> soa = MakeVectors<T>(d, options.size / 4 + 1, rng);
+    std::uniform_real_distribution<T> noise(-tol, tol);
+    std::vector<GeVector3<T>> vertices;
+    vertices.reserve(options.size);
+    while (vertices.size() < options.size)
+    {
+        const GeVector3<T> v = soa[rng() % soa.size()];
+        vertices.push_back(GeVector3<T>(v.x * (1 + noise(rng) / 2), v.y * (1 + noise(rng) / 2), v.z * (1 + noise(rng) / 2)));
+    }
+
+    std::vector<GeUint32> remap;
+    std::vector<GeVector3<T>> unique;
+    GeWeldOptions serial;
+    serial.parallel = false;
+    runner.Run(Name<T>("GeWeldVertices", d), vertices.size(), [&]()
+    {
+        DoNotOptimize(GeWeldVertices<T>(vertices, tol, remap, unique, serial));
+    });
+    runner.Run(Name<T>("GeWeldVertices<parallel>", d), vertices.size(), [&]()
+    {
+        DoNotOptimize(GeWeldVertices<T>(vertices, tol, remap, unique));
+    });
+}
+
+// Exact hashing of the bit patterns: the cost floor of a position-keyed
+// map, which does not merge the noisy duplicates
+template <typename T>
+struct ExactVector3Hash
+{
+    GeSize operator()(const GeVector3<T>& v) const
+    {
+        using Bits = ge::details::RealBits<T>;
+        GeSize h = std::hash<typename Bits::uint_type>()(Bits::ToSortable(v.x));
+        h = h * 31 + std::hash<typename Bits::uint_type>()(Bits::ToSortable(v.y));
+        return h * 31 + std::hash<typename Bits::uint_type>()(Bits::ToSortable(v.z));
+    }
+};
+
+template <typename T>
+struct ExactVector3Equal
+{
+    bool operator()(const GeVector3<T>& a, const GeVector3<T>& b) const
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+};
+
+template <typename T>
+void RunHashSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    // the noisy duplicates of the weld suite, deduplicated one at a time
+    const Distribution d = Distribution::kMixedSign;
+    const T tol = static_cast<T>(1.e-5);
+    const GeVector3Array<T> soa = MakeVectors<T>(d, options.size / 4 + 1, rng);
+    std::uniform_real_distribution<T> noise(-tol, tol);
+    std::vector<GeVector3<T>> vertices;
+    vertices.reserve(options.size);
+    while (vertices.size() < options.size)
+    {
+        const GeVector3<T> v = soa[rng() % soa.size()];
+        vertices.push_back(GeVector3<T>(v.x * (1 + noise(rng) / 2), v.y * (1 + noise(rng) / 2), v.z * (1 + noise(rng) / 2)));
+    }
+
+    std::unordered_map<GeVector3<T>, GeUint32, ExactVector3Hash<T>, ExactVector3Equal<T>> exact;
+    runner.Run(Name<T>("std::unordered_map<exact> insert", d), vertices.size(), [&]()
+    {
+        exact.clear();
+        for (GeSize i = 0; i < vertices.size(); ++i)
+            exact.emplace(vertices[i], static_cast<GeUint32>(i));
+        DoNotOptimize(exact.size());
+    });
+
+    GeVector3HashMap<T, GeUint32> map(tol);
+    runner.Run(Name<T>("GeVector3HashMap insert", d), vertices.size(), [&]()
+    {
+        map.Clear();
+        for (GeSize i = 0; i < vertices.size(); ++i)
+            map.Insert(vertices[i], static_cast<GeUint32>(i));
+        DoNotOptimize(map.Size());
+    });
+    runner.Run(Name<T>("GeVector3HashMap find", d), vertices.size(), [&]()
+    {
+        GeSize found = 0;
+        for (GeSize i = 0; i < vertices.size(); ++i)
+            found += map.Find(vertices[i]) != map.kNotFound;
+        DoNotOptimize(found);
+    });
+}
+
+template <typename T>
+void RunSortSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    // every iteration sorts a fresh copy; the copy is part of both timings
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> soa = MakeVectors<T>(d, options.size, rng);
+    const std::vector<T> values(soa.x(), soa.x() + soa.size());
+    std::vector<T> work(values.size());
+    GeSortOptions serial;
+    serial.parallel = false;
+
+    runner.Run(Name<T>("std::sort", d), values.size(), [&]()
+    {
+        work = values;
+        std::sort(work.begin(), work.end());
+        DoNotOptimize(work.data());
+    });
+    runner.Run(Name<T>("GeRadixSort", d), values.size(), [&]()
+    {
+        work = values;
+        GeRadixSort<T>(work, serial);
+        DoNotOptimize(work.data());
+    });
+    runner.Run(Name<T>("GeRadixSort+GeUniqueRealEqual", d), values.size(), [&]()
+    {
+        work = values;
+        GeRadixSort<T>(work, serial);
+        DoNotOptimize(GeUniqueRealEqual<T>(work, static_cast<T>(1.e-5)));
+    });
+
+    GeVector3Array<T> vectors;
+    runner.Run(Name<T>("GeVector3BatchSort", d), soa.size(), [&]()
+    {
+        vectors = soa;
+        GeVector3BatchSort<T>(vectors.view(), serial);
+        DoNotOptimize(vectors.x());
+    });
+}
+
+template <typename T>
+void RunCurveSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const GeAabb3<T> box = GeVector3BatchBounds<T>(a.cview());
+    std::vector<GeUint64> keys(a.size());
+    std::vector<GeUint32> order(a.size());
+    GeVector3Array<T> sorted(a.size());
+    GeCurveOptions serial;
+    serial.parallel = false;
+
+    runner.Run(Name<T>("GeVector3BatchCurveKeys<morton63>", d), a.size(), [&]()
+    {
+        GeVector3BatchCurveKeys<T>(a.cview(), box, GeSpaceCurve::kMorton, GeSpan<GeUint64>(keys.data(), keys.size()), serial);
+        DoNotOptimize(keys.data());
+    });
+    runner.Run(Name<T>("GeVector3BatchCurveKeys<hilbert63>", d), a.size(), [&]()
+    {
+        GeVector3BatchCurveKeys<T>(a.cview(), box, GeSpaceCurve::kHilbert, GeSpan<GeUint64>(keys.data(), keys.size()), serial);
+        DoNotOptimize(keys.data());
+    });
+    runner.Run(Name<T>("GeVector3BatchCurveOrder<morton>+Gather", d), a.size(), [&]()
+    {
+        GeVector3BatchCurveOrder<T>(a.cview(), box, GeSpaceCurve::kMorton, GeSpan<GeUint32>(order.data(), order.size()), serial);
+        GeVector3BatchGather<T>(a.cview(), GeSpan<const GeUint32>(order.data(), order.size()), sorted.view());
+        DoNotOptimize(sorted.x());
+    });
+}
+
+// One per-request pipeline on transient buffers: normalized copy, curve
+// order, gather. The heap version allocates every buffer, the arena one
+// bumps through a block reset each iteration.
+template <typename T, typename Allocator>
+void RunTransientPipeline(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, const Allocator& allocator,
+                          GeArena* pArena)
+{
+    using Lanes = GeVector3Array<T, Allocator>;
+    using OrderAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<GeUint32>;
+
+    Lanes normals(a.size, allocator);
+    GeVector3BatchNormalize<T>(a, normals.view(), GePrecision::kExact);
+
+    std::vector<GeUint32, OrderAllocator> order(a.size, OrderAllocator(allocator));
+    GeCurveOptions curveOptions;
+    curveOptions.parallel = false;
+    curveOptions.pArena = pArena;
+    GeVector3BatchCurveOrder<T>(a, box, GeSpaceCurve::kMorton, GeSpan<GeUint32>(order.data(), order.size()), curveOptions);
+
+    Lanes sorted(a.size, allocator);
+    GeVector3BatchGather<T>(normals.cview(), GeSpan<const GeUint32>(order.data(), order.size()), sorted.view());
+    DoNotOptimize(sorted.x());
+}
+
+template <typename T>
+void RunArenaSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const GeAabb3<T> box = GeVector3BatchBounds<T>(a.cview());
+
+    runner.Run(Name<T>("transient pipeline<heap>", d), a.size(), [&]()
+    {
+        RunTransientPipeline<T>(a.cview(), box, GeAlignedAllocator<T>(), nullptr);
+    });
+
+    GeArena& arena = GeThreadArena();
+    runner.Run(Name<T>("transient pipeline<arena>", d), a.size(), [&]()
+    {
+        arena.Reset();
+        RunTransientPipeline<T>(a.cview(), box, GeArenaAllocator<T>(&arena), &arena);
+    });
+    arena.Release();
+}
+
+// Scheduler overhead and the deterministic reduction against plain loops;
+// the grain keeps several chunks per thread
+template <typename T>
+void RunParallelSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> a = MakeVectors<T>(d, options.size, rng);
+    const T* x = a.x();
+    const GeSize n = a.size();
+    const GeSize grain = std::max<GeSize>(n / (8 * GeGetConcurrency()), 1024);
+    std::vector<T> out(n);
+
+    runner.Run(Name<T>("serial sum", d), n, [&]()
+    {
+        T sum = 0;
+        for (GeSize i = 0; i < n; ++i)
+            sum += x[i];
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("GeParallelReduce sum", d), n, [&]()
+    {
+        const T sum = GeParallelReduce(GeSize(0), n, grain, T(0),
+            [x](GeSize begin, GeSize end) {
+                T s = 0;
+                for (GeSize i = begin; i < end; ++i)
+                    s += x[i];
+                return s;
+            },
+            [](T s, T t) { return s + t; });
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("GeParallelInclusiveScan", d), n, [&]()
+    {
+        GeParallelInclusiveScan(x, out.data(), n, T(0), [](T s, T t) { return s + t; }, grain);
+        DoNotOptimize(out.data());
+    });
+}
+
+template <typename T>
+void RunPredicateSuite(BenchRunner& runner, const BenchOptions& options, std::mt19937_64& rng)
+{
+    // random points are decided by the filter; lattice points on a plane
+    // (exactly coplanar and cospherical sets) all take the exact path
+    const Distribution d = Distribution::kMixedSign;
+    const GeVector3Array<T> points = MakeVectors<T>(d, options.size + 4, rng);
+    std::vector<GeVector3<T>> plane(options.size + 4);
+    for (GeSize i = 0; i < plane.size(); ++i)
+    {
+        const T u = static_cast<T>(rng() % 1024);
+        const T v = static_cast<T>(rng() % 1024);
+        plane[i] = GeVector3<T>(u + 3 * v, 2 * u - v, u + v);
+    }
+
+    runner.Run(Name<T>("GeOrient3d", d), options.size, [&]()
+    {
+        GeInt32 sum = 0;
+        for (GeSize i = 0; i < options.size; ++i)
+            sum += GeOrient3d(points[i], points[i + 1], points[i + 2], points[i + 3]);
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("GeInSphere", d), options.size, [&]()
+    {
+        GeInt32 sum = 0;
+        for (GeSize i = 0; i < options.size; ++i)
+            sum += GeInSphere(points[i], points[i + 1], points[i + 2], points[i + 3], points[i + 4]);
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("GeOrient3d<degenerate>", d), options.size, [&]()
+    {
+        GeInt32 sum = 0;
+        for (GeSize i = 0; i < options.size; ++i)
+            sum += GeOrient3d(plane[i], plane[i + 1], plane[i + 2], plane[i + 3]);
+        DoNotOptimize(sum);
+    });
+    runner.Run(Name<T>("GeInSphere<degenerate>", d), options.size, [&]()
+    {
+        GeInt32 sum = 0;
+        for (GeSize i = 0; i < options.size; ++i)
+            sum += GeInSphere(plane[i], plane[i + 1], plane[i + 2], plane[i + 3], plane[i + 4]);
+        DoNotOptimize(sum);
+    });
+}
+
+//==============================================================================
+
+bool ParseOptions(int argc, char** argv, BenchOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue)
+            options.filter = argv[++i];
+        else if (arg == "--size" && hasValue)
+            options.size = static_cast<GeSize>(std::strtoull(argv[++i], nullptr, 10));
+        else if (arg == "--min-time-ms" && hasValue)
+            options.minTimeMs = std::strtod(argv[++i], nullptr);
+        else if (arg == "--save" && hasValue)
+            options.savePath = argv[++i];
+        else if (arg == "--baseline" && hasValue)
+            options.baselinePath = argv[++i];
+        else if (arg == "--threshold" && hasValue)
+            options.thresholdPercent = std::strtod(argv[++i], nullptr);
+        else
+            return false;
+    }
+    return options.size > 0;
+}
+
+// Returns the number of benchmarks slower than the baseline by more than
+// the threshold.
+int CompareWithBaseline(const BenchOptions& options, const std::vector<BenchResult>& results)
+{
+    std::map<std::string, double> baseline;
+    if (!LoadBaseline(options.baselinePath, baseline))
+    {
+        std::fprintf(stderr, "cannot read baseline %s\n", options.baselinePath.c_str());
+        return -1;
+    }
+
+    int regressions = 0;
+    for (const BenchResult& result : results)
+    {
+        const auto it = baseline.find(result.name);
+        if (it == baseline.end() || it->second <= 0.0)
+        {
+            continue;
+        }
+
+        const double changePercent = (result.nsPerOp / it->second - 1.0) * 100.0;
+        if (changePercent > options.thresholdPercent)
+        {
+            std::printf("REGRESSION %-45s %10.3f -> %10.3f ns/op (+%.1f%%)\n",
+                        result.name.c_str(), it->second, result.nsPerOp, changePercent);
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+} // end of anonymous
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr,
+                     "usage: %s [--filter s] [--size n] [--min-time-ms ms] "
+                     "[--save file] [--baseline file] [--threshold percent]\n", argv[0]);
+        return 2;
+    }
+
+    std::mt19937_64 rng(20250101);
+    BenchRunner runner(options);
+
+    RunRealSuite<GeReal32>(runner, options, rng);
+    RunRealSuite<GeReal64>(runner, options, rng);
+    RunRealBatchSuite(runner, options, rng);
+    RunIntSuite(runner, options, rng);
+    RunVectorSuite<GeReal32>(runner, options, rng);
+    RunVectorSuite<GeReal64>(runner, options, rng);
+    RunReduceSuite<GeReal32>(runner, options, rng);
+    RunReduceSuite<GeReal64>(runner, options, rng);
+    RunTransformSuite<GeReal32>(runner, options, rng);
+    RunTransformSuite<GeReal64>(runner, options, rng);
+    RunQuantizeSuite<GeReal32>(runner, options, rng);
+    RunQuantizeSuite<GeReal64>(runner, options, rng);
+    RunCompressedSuite(runner, options, rng);
+    RunBvhSuite<GeReal32>(runner, options, rng);
+    RunPointFileSuite<GeReal32>(runner, options, rng);
+    RunPointFileSuite<GeReal64>(runner, options, rng);
+    RunWeldSuite<GeReal32>(runner, options, rng);
+    RunPredicateSuite<GeReal64>(runner, options, rng);
+    RunSortSuite<GeReal32>(runner, options, rng);
+    RunSortSuite<GeReal64>(runner, options, rng);
+    RunCurveSuite<GeReal32>(runner, options, rng);
+    RunCurveSuite<GeReal64>(runner, options, rng);
+    RunArenaSuite<GeReal32>(runner, options, rng);
+    RunArenaSuite<GeReal64>(runner, options, rng);
+    RunParallelSuite<GeReal32>(runner, options, rng);
+    RunParallelSuite<GeReal64>(runner, options, rng);
+    RunHashSuite<GeReal32>(runner, options, rng);
+    RunHashSuite<GeReal64>(runner, options, rng);
+    RunRealSearchSuite<GeReal32>(runner, options, rng);
+    RunRealSearchSuite<GeReal64>(runner, options, rng);
+
+    // Instrumented builds (GE_ENABLE_STATS) also report what the suites hit
+    if (GeStatsEnabled())
+    {
+        std::printf("stats %s\n", GeStatsToJson(GeGetStatsSnapshot()).c_str());
+    }
+
+    if (!options.savePath.empty() && !SaveBaseline(options.savePath, runner.Results()))
+    {
+        std::fprintf(stderr, "cannot write baseline %s\n", options.savePath.c_str());
+        return 2;
+    }
+
+    if (!options.baselinePath.empty())
+    {
+        const int regressions = CompareWithBaseline(options, runner.Results());
+        if (regressions != 0)
+        {
+            return regressions < 0 ? 2 : 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_AABB_H
+#define GEOMUTILS_AABB_H
+
+#include "gevector3.h"
+
+#include <limits>
+
+//------------------------------------------------------------------------------
+/**
+    Axis-aligned bounding box. A default-constructed box is empty
+    (min = +max, max = -max) so that Expand() from it yields the first point.
+*/
+template <typename T>
+class GeAabb3
+{
+public:
+    GeVector3<T> min;
+    GeVector3<T> max;
+
+    GeAabb3()
+        : min{std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max()}
+        , max{std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest()}
+        {}
+
+    GeAabb3(const GeVector3<T>& minCorner, const GeVector3<T>& maxCorner)
+        : min{minCorner}
+        , max{maxCorner}
+        {}
+
+    bool IsEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    void Expand(const GeVector3<T>& p)
+    {
+        min = GeVector3<T>(p.x < min.x ? p.x : min.x, p.y < min.y ? p.y : min.y, p.z < min.z ? p.z : min.z);
+        max = GeVector3<T>(p.x > max.x ? p.x : max.x, p.y > max.y ? p.y : max.y, p.z > max.z ? p.z : max.z);
+    }
+
+    // Union with other; an empty other leaves the box unchanged
+    void Expand(const GeAabb3& other)
+    {
+        min = GeVector3<T>(other.min.x < min.x ? other.min.x : min.x,
+                           other.min.y < min.y ? other.min.y : min.y,
+                           other.min.z < min.z ? other.min.z : min.z);
+        max = GeVector3<T>(other.max.x > max.x ? other.max.x : max.x,
+                           other.max.y > max.y ? other.max.y : max.y,
+                           other.max.z > max.z ? other.max.z : max.z);
+    }
+
+    GeVector3<T> Center() const
+    {
+        return GeVector3<T>((min.x + max.x) / 2, (min.y + max.y) / 2, (min.z + max.z) / 2);
+    }
+
+    GeVector3<T> Extent() const
+    {
+        return max - min;
+    }
+
+    // Index of the longest axis (0 = x, 1 = y, 2 = z)
+    int LongestAxis() const
+    {
+        const GeVector3<T> e = Extent();
+        return (e.x >= e.y && e.x >= e.z) ? 0 : (e.y >= e.z ? 1 : 2);
+    }
+
+    // Surface area; 0 for an empty box
+    T SurfaceArea() const
+    {
+        if (IsEmpty())
+            return T(0);
+        const GeVector3<T> e = Extent();
+        return 2 * (e.x * e.y + e.y * e.z + e.z * e.x);
+    }
+
+    bool Contains(const GeVector3<T>& p) const
+    {
+        return p.x >= min.x && p.x <= max.x &&
+               p.y >= min.y && p.y <= max.y &&
+               p.z >= min.z && p.z <= max.z;
+    }
+
+    // Squared distance from p to the box, 0 inside
+    T DistanceSquare(const GeVector3<T>& p) const
+    {
+        const T dx = p.x < min.x ? min.x - p.x : (p.x > max.x ? p.x - max.x : T(0));
+        const T dy = p.y < min.y ? min.y - p.y : (p.y > max.y ? p.y - max.y : T(0));
+        const T dz = p.z < min.z ? min.z - p.z : (p.z > max.z ? p.z - max.z : T(0));
+        return dx * dx + dy * dy + dz * dz;
+    }
+};
+
+namespace ge
+{
+    template <typename T>
+    using aabb3 = GeAabb3<T>;
+} // eof ge
+
+#endif // GEOMUTILS_AABB_H
@@ -0,0 +1,86 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_ALIGNEDALLOCATOR_H
+#define GEOMUTILS_ALIGNEDALLOCATOR_H
+
+#include "gebasedefs.h"
+
+#include <cstddef>
+#include <new>
+
+//------------------------------------------------------------------------------
+/**
+    Standard-compatible allocator returning memory aligned for the widest
+    SIMD registers (GE_SIMD_ALIGNMENT bytes by default).
+*/
+template <typename T, GeSize Alignment = GE_SIMD_ALIGNMENT>
+class GeAlignedAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = GeAlignedAllocator<U, Alignment>;
+    };
+
+    GeAlignedAllocator() noexcept = default;
+
+    template <typename U>
+    GeAlignedAllocator(const GeAlignedAllocator<U, Alignment>&) noexcept
+    {}
+
+    T* allocate(GeSize n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* p, GeSize) noexcept
+    {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+};
+
+template <typename T, typename U, GeSize Alignment>
+inline bool operator==(const GeAlignedAllocator<T, Alignment>&, const GeAlignedAllocator<U, Alignment>&)
+{
+    return true;
+}
+
+template <typename T, typename U, GeSize Alignment>
+inline bool operator!=(const GeAlignedAllocator<T, Alignment>&, const GeAlignedAllocator<U, Alignment>&)
+{
+    return false;
+}
+
+namespace ge
+{
+    template <typename T, GeSize Alignment = GE_SIMD_ALIGNMENT>
+    using aligned_allocator = GeAlignedAllocator<T, Alignment>;
+} // eof ge
+
+#endif // GEOMUTILS_ALIGNEDALLOCATOR_H
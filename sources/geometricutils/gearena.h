@@ -0,0 +1,274 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_ARENA_H
+#define GEOMUTILS_ARENA_H
+
+#include "gebasedefs.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+//==============================================================================
+// Arena
+
+//------------------------------------------------------------------------------
+/**
+    Bump allocator for transient buffers. Allocation moves a cursor through
+    the current block; memory comes back all at once with Reset() or
+    Rewind(). Blocks are kept for reuse, so a pipeline that resets the arena
+    per frame stops touching the heap once the arena has grown to the
+    frame's footprint.
+
+    Not thread-safe: use one arena per thread (GeThreadArena()).
+*/
+class GeArena
+{
+public:
+    static constexpr GeSize kDefaultBlockSize = 1 << 16;
+
+    // Position to rewind to; valid until an earlier position is restored
+    struct Marker
+    {
+        GeSize block = 0;
+        std::uintptr_t cursor = 0;
+    };
+
+    explicit GeArena(GeSize blockSize = kDefaultBlockSize);
+    ~GeArena();
+
+    GeArena(const GeArena&) = delete;
+    GeArena& operator=(const GeArena&) = delete;
+
+    //--------------------------------------------------------------------------
+    /**
+        @param alignment a power of two
+        @return size bytes, valid until the arena is reset or rewound past them
+    */
+    void* Allocate(GeSize size, GeSize alignment = GE_SIMD_ALIGNMENT)
+    {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        const std::uintptr_t padding = (0 - m_cursor) & (alignment - 1);
+        if (padding + size <= m_end - m_cursor)
+        {
+            const std::uintptr_t p = m_cursor + padding;
+            m_cursor = p + size;
+            return reinterpret_cast<void*>(p);
+        }
+        return AllocateSlow(size, alignment);
+    }
+
+    template <typename T>
+    T* Allocate(GeSize count)
+    {
+        constexpr GeSize kAlignment = alignof(T) > GE_SIMD_ALIGNMENT ? alignof(T) : GE_SIMD_ALIGNMENT;
+        return static_cast<T*>(Allocate(count * sizeof(T), kAlignment));
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Gives the memory back only when it is the latest allocation, so
+        temporaries released in reverse order are reused at once; otherwise
+        it waits for the next reset.
+    */
+    void Deallocate(void* p, GeSize size)
+    {
+        if (reinterpret_cast<std::uintptr_t>(p) + size == m_cursor)
+            m_cursor = reinterpret_cast<std::uintptr_t>(p);
+    }
+
+    Marker Mark() const
+    {
+        return {m_block, m_cursor};
+    }
+
+    void Rewind(const Marker& marker);
+
+    //--------------------------------------------------------------------------
+    /**
+        Frees every allocation. If the last round spilled over several
+        blocks they are replaced with one block of their total size, so the
+        next round bumps through a single block.
+    */
+    void Reset();
+
+    // Returns all blocks to the heap
+    void Release();
+
+    // Bytes held in blocks
+    GeSize Capacity() const;
+    GeSize BlockCount() const { return m_blocks.size(); }
+
+private:
+    struct Block
+    {
+        char* pData;
+        GeSize size;
+    };
+
+    void* AllocateSlow(GeSize size, GeSize alignment);
+    void Enter(GeSize block);
+    static char* NewBlock(GeSize size);
+    static void DeleteBlock(const Block& block);
+
+    std::vector<Block> m_blocks;
+    GeSize m_blockSize;
+    GeSize m_block = 0;             // current block, meaningful when m_end != 0
+    std::uintptr_t m_cursor = 0;
+    std::uintptr_t m_end = 0;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Arena of the calling thread, created on first use and freed at thread
+    exit.
+*/
+GeArena& GeThreadArena();
+
+//------------------------------------------------------------------------------
+/**
+    Rewinds an arena to where it was when the scope was entered.
+*/
+class GeArenaScope
+{
+public:
+    explicit GeArenaScope(GeArena& arena = GeThreadArena())
+        : m_arena{arena}
+        , m_marker{arena.Mark()}
+        {}
+
+    ~GeArenaScope()
+    {
+        m_arena.Rewind(m_marker);
+    }
+
+    GeArenaScope(const GeArenaScope&) = delete;
+    GeArenaScope& operator=(const GeArenaScope&) = delete;
+
+private:
+    GeArena& m_arena;
+    GeArena::Marker m_marker;
+};
+
+//==============================================================================
+// Allocator
+
+//------------------------------------------------------------------------------
+/**
+    Standard-compatible allocator drawing from a GeArena. Without an arena
+    it behaves as GeAlignedAllocator, so containers and algorithms can take
+    an optional arena through one type. Allocators compare equal when they
+    share the arena.
+*/
+template <typename T, GeSize Alignment = GE_SIMD_ALIGNMENT>
+class GeArenaAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    static constexpr GeSize kAlignment = alignof(T) > Alignment ? alignof(T) : Alignment;
+
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = GeArenaAllocator<U, Alignment>;
+    };
+
+    GeArenaAllocator() noexcept = default;
+
+    explicit GeArenaAllocator(GeArena* pArena) noexcept
+        : m_pArena{pArena}
+        {}
+
+    template <typename U>
+    GeArenaAllocator(const GeArenaAllocator<U, Alignment>& other) noexcept
+        : m_pArena{other.arena()}
+        {}
+
+    T* allocate(GeSize n)
+    {
+        if (m_pArena)
+            return static_cast<T*>(m_pArena->Allocate(n * sizeof(T), kAlignment));
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{kAlignment}));
+    }
+
+    void deallocate(T* p, GeSize n) noexcept
+    {
+        if (m_pArena)
+            m_pArena->Deallocate(p, n * sizeof(T));
+        else
+            ::operator delete(p, std::align_val_t{kAlignment});
+    }
+
+    GeArena* arena() const noexcept
+    {
+        return m_pArena;
+    }
+
+private:
+    GeArena* m_pArena = nullptr;
+};
+
+template <typename T, typename U, GeSize Alignment>
+inline bool operator==(const GeArenaAllocator<T, Alignment>& a, const GeArenaAllocator<U, Alignment>& b)
+{
+    return a.arena() == b.arena();
+}
+
+template <typename T, typename U, GeSize Alignment>
+inline bool operator!=(const GeArenaAllocator<T, Alignment>& a, const GeArenaAllocator<U, Alignment>& b)
+{
+    return a.arena() != b.arena();
+}
+
+// Vector whose storage comes from an arena, or the heap without one
+template <typename T>
+using GeArenaVector = std::vector<T, GeArenaAllocator<T>>;
+
+namespace ge
+{
+    using arena = GeArena;
+    using arena_scope = GeArenaScope;
+
+    template <typename T, GeSize Alignment = GE_SIMD_ALIGNMENT>
+    using arena_allocator = GeArenaAllocator<T, Alignment>;
+
+    template <typename T>
+    using arena_vector = GeArenaVector<T>;
+
+    inline GeArena& thread_arena()
+    {
+        return GeThreadArena();
+    }
+} // eof ge
+
+#endif // GEOMUTILS_ARENA_H
@@ -25,16 +25,29 @@ SOFTWARE.
 #define GEOMUTILS_BASEDEFS_H
 
 #include <cstdint>
+#include <cstring>
 
 #include "geplatformdefs.h"
 
+#ifdef GE_HAS_STD_BIT_CAST
+#   include <bit>
+#endif
+
 using GeInt8 = std::int8_t;
 using GeInt16 = std::int16_t;
 using GeInt32 = std::int32_t;
+using GeInt64 = std::int64_t;
 
 using GeUint8 = std::uint8_t;
 using GeUint16 = std::uint16_t;
 using GeUint32 = std::uint32_t;
+using GeUint64 = std::uint64_t;
+
+// 128-bit integers, where the compiler provides them
+#if defined(__SIZEOF_INT128__)
+#   define GE_HAS_INT128
+__extension__ typedef __int128 GeInt128;
+#endif
 
 using GeByte = GeUint8;
 using GeSize = std::size_t;
@@ -47,10 +60,12 @@ namespace ge
     using int8_t = GeInt8;
     using int16_t = GeInt16;
     using int32_t = GeInt32;
+    using int64_t = GeInt64;
 
     using uint8_t = GeUint8;
     using uint16_t = GeUint16;
     using uint32_t = GeUint32;
+    using uint64_t = GeUint64;
 
     using byte_t = GeByte;
     using size_t = GeSize;
@@ -60,6 +75,35 @@ namespace ge
 } // eof gu
 
 #define GE_UNUSED(x) ((void)x)
+
+//------------------------------------------------------------------------------
+/**
+    Reinterprets the object representation of from as To. constexpr when
+    GE_BIT_CAST_CONSTEXPR is (see geplatformdefs.h).
+*/
+template <typename To, typename From>
+GE_BIT_CAST_CONSTEXPR To GeBitCast(const From& from) noexcept
+{
+    static_assert(sizeof(To) == sizeof(From), "GeBitCast: size mismatch");
+#if defined(GE_HAS_STD_BIT_CAST)
+    return std::bit_cast<To>(from);
+#elif defined(GE_HAS_BUILTIN_BIT_CAST)
+    return __builtin_bit_cast(To, from);
+#else
+    To to;
+    std::memcpy(&to, &from, sizeof(To));
+    return to;
+#endif
+}
+
+namespace ge
+{
+    template <typename To, typename From>
+    GE_BIT_CAST_CONSTEXPR To bit_cast(const From& from) noexcept
+    {
+        return GeBitCast<To>(from);
+    }
+} // eof ge
 
 
 #endif // GEOMUTILS_BASEDEFS_H
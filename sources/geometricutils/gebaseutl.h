@@ -29,6 +29,11 @@ SOFTWARE.
 #include "gerealutl.h"
 #include <limits>
 #include <cmath>
+#include <type_traits>
+
+#ifdef GE_SIMD_SSE2
+#   include <xmmintrin.h>
+#endif
 
 // Endianness
 constexpr
@@ -51,6 +56,97 @@ bool IsLittleEndian()
 
 } // eof ge
 
+// Byte swap
+constexpr inline GeUint16 GeByteSwap(GeUint16 x)
+{
+    return static_cast<GeUint16>((x >> 8) | (x << 8));
+}
+
+constexpr inline GeUint32 GeByteSwap(GeUint32 x)
+{
+#ifdef GE_GCC_COMPILER
+    return __builtin_bswap32(x);
+#else
+    return (x >> 24) | ((x >> 8) & 0x0000ff00u) | ((x << 8) & 0x00ff0000u) | (x << 24);
+#endif
+}
+
+constexpr inline GeUint64 GeByteSwap(GeUint64 x)
+{
+#ifdef GE_GCC_COMPILER
+    return __builtin_bswap64(x);
+#else
+    return (static_cast<GeUint64>(GeByteSwap(static_cast<GeUint32>(x))) << 32) |
+           GeByteSwap(static_cast<GeUint32>(x >> 32));
+#endif
+}
+
+namespace ge
+{
+    template <typename T>
+    constexpr inline T byte_swap(T x)
+    {
+        return GeByteSwap(x);
+    }
+} // eof ge
+
+// Half precision (IEEE 754 binary16) stored as raw bits. Rounds to nearest
+// even like vcvtps2ph; NaN keeps its top payload bits and is made quiet.
+GE_BIT_CAST_CONSTEXPR inline GeUint16 GeFloatToHalf(GeReal32 x)
+{
+    const GeUint32 bits = GeBitCast<GeUint32>(x);
+    const GeUint32 sign = (bits >> 16) & 0x8000u;
+    const GeUint32 a = bits & 0x7fffffffu;
+    GeUint32 h = 0;
+    if (a > 0x7f800000u)
+    {
+        h = 0x7e00u | ((a >> 13) & 0x3ffu);
+    }
+    else if (a >= 0x47800000u)
+    {
+        // 2^16 and up, or infinity; [65520, 65536) overflows below by rounding
+        h = 0x7c00u;
+    }
+    else if (a < 0x38800000u)
+    {
+        // below 2^-14: the float add aligns the result to the half subnormal
+        // spacing and rounds it
+        const GeUint32 kMagic = 0x3f000000u;
+        h = GeBitCast<GeUint32>(GeBitCast<GeReal32>(a) + GeBitCast<GeReal32>(kMagic)) - kMagic;
+    }
+    else
+    {
+        const GeUint32 mantOdd = (a >> 13) & 1u;
+        h = (a - 0x38000000u + 0xfffu + mantOdd) >> 13;
+    }
+    return static_cast<GeUint16>(h | sign);
+}
+
+GE_BIT_CAST_CONSTEXPR inline GeReal32 GeHalfToFloat(GeUint16 h)
+{
+    const GeUint32 sign = static_cast<GeUint32>(h & 0x8000u) << 16;
+    const GeUint32 exponent = (h >> 10) & 0x1fu;
+    const GeUint32 mant = h & 0x3ffu;
+    if (exponent == 0x1fu)
+        return GeBitCast<GeReal32>(sign | 0x7f800000u | (mant << 13) | (mant != 0 ? 0x400000u : 0u));
+    if (exponent == 0)
+        return GeBitCast<GeReal32>(sign | GeBitCast<GeUint32>(static_cast<GeReal32>(mant) * 5.9604644775390625e-8f));
+    return GeBitCast<GeReal32>(sign | ((exponent + 112) << 23) | (mant << 13));
+}
+
+namespace ge
+{
+    GE_BIT_CAST_CONSTEXPR inline GeUint16 float_to_half(GeReal32 x)
+    {
+        return GeFloatToHalf(x);
+    }
+
+    GE_BIT_CAST_CONSTEXPR inline GeReal32 half_to_float(GeUint16 h)
+    {
+        return GeHalfToFloat(h);
+    }
+} // eof ge
+
 // Zero
 template <typename T>
 constexpr inline T GeZero()
@@ -193,4 +289,104 @@ namespace ge
 
 
 } // eof ge
+
+// fused multiply-add
+
+//------------------------------------------------------------------------------
+/**
+    a * b + c, rounded once when the target has hardware FMA (GE_HAS_FMA);
+    otherwise the plain expression, since the library fma is slow.
+*/
+template <typename T>
+inline T GeFusedMultiplyAdd(T a, T b, T c)
+{
+#ifdef GE_HAS_FMA
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+namespace ge
+{
+    template <typename T>
+    inline T fma(T a, T b, T c)
+    {
+        return GeFusedMultiplyAdd(a, b, c);
+    }
+} // eof ge
+
+
+
+// reciprocal square root
+
+//------------------------------------------------------------------------------
+/**
+    Accuracy/speed trade-off for reciprocal square root based operations.
+    Maximum relative errors for GeReal32:
+
+    - kExact:       correctly rounded sqrt and division (<= 1 ulp).
+    - kRefined:     hardware estimate plus one Newton-Raphson step, < 3e-7.
+    - kApproximate: raw hardware estimate, < 3.3e-4 (the AVX-512 batch tier
+                    uses the 14-bit estimate and is typically tighter).
+
+    Denormal inputs keep these bounds and zero gives +inf, as with kExact.
+    GeReal64 and targets without a hardware estimate always use kExact.
+*/
+enum class GePrecision
+{
+    kExact,
+    kRefined,
+    kApproximate
+};
+
+// True when GeRsqrt has a hardware estimate for T
+template <typename T>
+constexpr inline bool GeHasFastRsqrt()
+{
+#ifdef GE_SIMD_SSE2
+    return std::is_same<T, GeReal32>::value;
+#else
+    return false;
+#endif
+}
+
+template <GePrecision P = GePrecision::kExact, typename T>
+inline T GeRsqrt(T x)
+{
+#ifdef GE_SIMD_SSE2
+    if constexpr (P != GePrecision::kExact && GeHasFastRsqrt<T>())
+    {
+        // the estimate treats denormals as zero, and the Newton step would
+        // turn zero into 0 * inf: both take the exact path (zero gives +inf)
+        if (x < std::numeric_limits<GeReal32>::min())
+            return T(1) / GeSqrt(x);
+
+        const GeReal32 y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        if constexpr (P == GePrecision::kRefined)
+        {
+            return y * (1.5f - 0.5f * x * y * y);
+        }
+        else
+        {
+            return y;
+        }
+    }
+    else
+#endif
+    {
+        return T(1) / GeSqrt(x);
+    }
+}
+
+namespace ge
+{
+    using precision = GePrecision;
+
+    template <GePrecision P = GePrecision::kExact, typename T>
+    inline T rsqrt(T x)
+    {
+        return GeRsqrt<P>(x);
+    }
+} // eof ge
 #endif // GEOMUTILS_BASEUTL_H
@@ -0,0 +1,201 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_BVH_H
+#define GEOMUTILS_BVH_H
+
+#include "geaabb.h"
+#include "gerealutl.h"
+#include "gespan.h"
+
+#include <limits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/**
+    GeBvh build parameters.
+*/
+struct GeBvhBuildOptions
+{
+    GeSize maxLeafSize = 4;             // primitives per leaf, at most 65535
+    GeSize binCount = 16;               // SAH bins, clamped to [2, 64]
+    bool parallel = true;               // build subtrees on worker threads
+    GeSize parallelGrainSize = 4096;    // smallest subtree handed to a worker
+};
+
+namespace ge
+{
+namespace details
+{
+    // Flattened BVH node (32 bytes for GeReal32). Interior nodes have their
+    // left child right after them and the right child at offset.
+    template <typename T>
+    struct BvhNode
+    {
+        T boundsMin[3];
+        T boundsMax[3];
+        GeUint32 offset;    // leaf: first primitive slot, interior: right child
+        GeUint16 count;     // 0 for interior nodes
+        GeUint16 axis;      // split axis of interior nodes
+    };
+} // end of details
+} // end of ge
+
+//------------------------------------------------------------------------------
+/**
+    Bounding volume hierarchy over a static point or triangle set.
+
+    The tree is built with a binned surface area heuristic and stored as a
+    flat depth-first node array (32-byte nodes for GeReal32, left child next
+    to its parent); primitives are copied in leaf order so leaf scans are
+    sequential.
+
+    Query distances are squared distances. Two candidates whose distances
+    (or ray parameters) are equal under GeRealLess with the BVH tolerance are
+    a tie, resolved towards the smaller original primitive index, so results
+    do not depend on the tree layout. Hit::index is the index of the point,
+    or of the triangle, as given to Build*().
+*/
+template <typename T>
+class GeBvh
+{
+public:
+    static constexpr GeSize kInvalidIndex = static_cast<GeSize>(-1);
+
+    struct Hit
+    {
+        GeSize index = kInvalidIndex;
+        T distanceSquare = std::numeric_limits<T>::infinity();
+    };
+
+    struct RayHit
+    {
+        GeSize index = kInvalidIndex;
+        T t = std::numeric_limits<T>::infinity();
+        T u = T(0);     // barycentric coordinates of the hit (triangles)
+        T v = T(0);
+    };
+
+    GeBvh() = default;
+
+    //--------------------------------------------------------------------------
+    /**
+        Builds over points; every point is a primitive.
+    */
+    void BuildFromPoints(GeSpan<const GeVector3<T>> points,
+                         const GeBvhBuildOptions& options = GeBvhBuildOptions());
+
+    //--------------------------------------------------------------------------
+    /**
+        Builds over indexed triangles: triangle i is (indices[3i],
+        indices[3i + 1], indices[3i + 2]).
+    */
+    void BuildFromTriangles(GeSpan<const GeVector3<T>> vertices, GeSpan<const GeUint32> indices,
+                            const GeBvhBuildOptions& options = GeBvhBuildOptions());
+
+    //--------------------------------------------------------------------------
+    /**
+        Builds over a triangle soup: triangle i is vertices [3i, 3i + 3).
+    */
+    void BuildFromTriangles(GeSpan<const GeVector3<T>> vertices,
+                            const GeBvhBuildOptions& options = GeBvhBuildOptions());
+
+    void Clear();
+
+    bool IsEmpty() const { return m_nodes.empty(); }
+    bool IsTriangleSet() const { return m_triangleSet; }
+    GeSize PrimitiveCount() const { return m_primIndices.size(); }
+    GeSize NodeCount() const { return m_nodes.size(); }
+    GeSize Depth() const { return m_depth; }
+    GeAabb3<T> Bounds() const;
+
+    //--------------------------------------------------------------------------
+    /**
+        Relative tolerance of the tie decisions, GeDefaultEpsilon<T> by
+        default. Must be in [0, 0.25).
+    */
+    T Tolerance() const { return m_tolerance; }
+    void SetTolerance(T tolerance);
+
+    //--------------------------------------------------------------------------
+    /**
+        Nearest primitive to query within maxDistance; index is kInvalidIndex
+        when there is none.
+    */
+    Hit Nearest(const GeVector3<T>& query,
+                T maxDistance = std::numeric_limits<T>::infinity()) const;
+
+    //--------------------------------------------------------------------------
+    /**
+        Up to k nearest primitives within maxDistance, nearest first.
+    */
+    void KNearest(const GeVector3<T>& query, GeSize k, std::vector<Hit>& out,
+                  T maxDistance = std::numeric_limits<T>::infinity()) const;
+
+    //--------------------------------------------------------------------------
+    /**
+        All primitives within radius of query, ordered by index.
+    */
+    void RadiusSearch(const GeVector3<T>& query, T radius, std::vector<Hit>& out) const;
+
+    //--------------------------------------------------------------------------
+    /**
+        First primitive hit by origin + t * direction, 0 <= t <= tMax.
+        Points are intersected as spheres of pointRadius (no hit when 0).
+    */
+    bool Raycast(const GeVector3<T>& origin, const GeVector3<T>& direction, RayHit& hit,
+                 T tMax = std::numeric_limits<T>::infinity(), T pointRadius = T(0)) const;
+
+private:
+    using Node = ge::details::BvhNode<T>;
+
+    // primBounds(i) returns the bounds of primitive i
+    template <typename TBounds>
+    void Build(const TBounds& primBounds, GeSize count, const GeBvhBuildOptions& options);
+
+    T PrimitiveDistanceSquare(GeSize slot, const GeVector3<T>& query) const;
+    T RejectBound(T bestDistance) const;
+    bool IsBetter(T distance, GeSize index, T bestDistance, GeSize bestIndex) const;
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<GeUint32> m_primIndices;      // original index per slot
+    std::vector<GeVector3<T>> m_points;       // point sets, slot order
+    std::vector<GeVector3<T>> m_triangles;    // triangle sets, 3 vertices per slot
+    GeSize m_depth = 0;
+    T m_tolerance = GeDefaultEpsilon<T>::Value();
+    bool m_triangleSet = false;
+};
+
+extern template class GeBvh<GeReal32>;
+extern template class GeBvh<GeReal64>;
+
+namespace ge
+{
+    template <typename T>
+    using bvh = GeBvh<T>;
+
+    using bvh_build_options = GeBvhBuildOptions;
+} // eof ge
+
+#endif // GEOMUTILS_BVH_H
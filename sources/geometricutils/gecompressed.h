@@ -0,0 +1,271 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_COMPRESSED_H
+#define GEOMUTILS_COMPRESSED_H
+
+#include "gealignedallocator.h"
+#include "gequantize.h"
+#include "gevector3array.h"
+#include "gevector3reduce.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//==============================================================================
+// Half precision lanes (bits as produced by GeFloatToHalf)
+
+void GeBatchEncodeHalf(const GeReal32* in, GeUint16* out, GeSize n);
+void GeBatchDecodeHalf(const GeUint16* in, GeReal32* out, GeSize n);
+
+void GeVector3BatchEncodeHalf(GeVector3ArrayCView<GeReal32> in, GeVector3ArrayView<GeUint16> out);
+void GeVector3BatchDecodeHalf(GeVector3ArrayCView<GeUint16> in, GeVector3ArrayView<GeReal32> out);
+
+//==============================================================================
+// Octahedral unit vectors in 32 bits
+
+/**
+    Encodes direction n (need not be normalized). Zero maps to +z and NaN
+    components to the (1, 1) corner, i.e. -z.
+*/
+GeUint32 GeOctahedralEncode(const GeVector3<GeReal32>& n);
+
+// Unit vector for code
+GeVector3<GeReal32> GeOctahedralDecode(GeUint32 code);
+
+void GeVector3BatchEncodeOctahedral(GeVector3ArrayCView<GeReal32> in, GeUint32* out);
+
+// Decodes out.size codes
+void GeVector3BatchDecodeOctahedral(const GeUint32* in, GeVector3ArrayView<GeReal32> out);
+
+//==============================================================================
+// Compressed point arrays
+//
+// Each keeps its encoded lanes and decodes a range on demand through
+// Decode(first, out), which fills out.size points starting at first; see
+// GeForEachDecodedBlock for streaming a whole array through a float kernel.
+
+//------------------------------------------------------------------------------
+/**
+    Three fp16 lanes, 6 bytes a point instead of 12. Components keep 11
+    significant bits: |decoded - x| <= kRelativeError * |x| for |x| in
+    [2^-14, 65504], at most 2^-25 below that, and larger values become
+    infinite.
+*/
+class GeVector3ArrayHalf
+{
+public:
+    static constexpr GeReal32 kRelativeError = 1.0f / 2048;
+
+    GeVector3ArrayHalf() = default;
+
+    explicit GeVector3ArrayHalf(GeVector3ArrayCView<GeReal32> points)
+    {
+        Assign(points);
+    }
+
+    void Assign(GeVector3ArrayCView<GeReal32> points)
+    {
+        m_lanes.resize(points.size);
+        GeVector3BatchEncodeHalf(points, m_lanes.view());
+    }
+
+    GeSize size() const { return m_lanes.size(); }
+    bool empty() const { return m_lanes.empty(); }
+    GeSize ByteSize() const { return 3 * size() * sizeof(GeUint16); }
+
+    GeVector3<GeReal32> operator[](GeSize i) const
+    {
+        const GeVector3<GeUint16> h = m_lanes[i];
+        return GeVector3<GeReal32>(GeHalfToFloat(h.x), GeHalfToFloat(h.y), GeHalfToFloat(h.z));
+    }
+
+    void Decode(GeSize first, GeVector3ArrayView<GeReal32> out) const
+    {
+        assert(first + out.size <= size());
+        const GeVector3ArrayCView<GeUint16> lanes = m_lanes.cview();
+        GeVector3BatchDecodeHalf({lanes.x + first, lanes.y + first, lanes.z + first, out.size}, out);
+    }
+
+    GeVector3ArrayCView<GeUint16> cview() const { return m_lanes.cview(); }
+
+private:
+    GeVector3Array<GeUint16> m_lanes;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Unit vectors as octahedral codes, 4 bytes each instead of 12. Decoded
+    vectors are normalized; the angle to the normalized input stays below
+    kMaxAngularError radians (6.5e-5 measured over 2M random directions).
+*/
+class GeNormalArrayOct32
+{
+public:
+    static constexpr GeReal32 kMaxAngularError = 7.0e-5f;
+
+    GeNormalArrayOct32() = default;
+
+    explicit GeNormalArrayOct32(GeVector3ArrayCView<GeReal32> normals)
+    {
+        Assign(normals);
+    }
+
+    void Assign(GeVector3ArrayCView<GeReal32> normals)
+    {
+        m_codes.resize(normals.size);
+        GeVector3BatchEncodeOctahedral(normals, m_codes.data());
+    }
+
+    GeSize size() const { return m_codes.size(); }
+    bool empty() const { return m_codes.empty(); }
+    GeSize ByteSize() const { return size() * sizeof(GeUint32); }
+
+    GeVector3<GeReal32> operator[](GeSize i) const
+    {
+        return GeOctahedralDecode(m_codes[i]);
+    }
+
+    void Decode(GeSize first, GeVector3ArrayView<GeReal32> out) const
+    {
+        assert(first + out.size <= size());
+        GeVector3BatchDecodeOctahedral(m_codes.data() + first, out);
+    }
+
+    const GeUint32* data() const { return m_codes.data(); }
+
+private:
+    std::vector<GeUint32, GeAlignedAllocator<GeUint32>> m_codes;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Positions as 16-bit coordinates on the grid fitted to their bounding box,
+    6 bytes a point, with the per-axis error bound given by MaxError(). Input
+    is expected to be finite.
+*/
+class GeVector3ArrayQuantized16
+{
+public:
+    GeVector3ArrayQuantized16() = default;
+
+    explicit GeVector3ArrayQuantized16(GeVector3ArrayCView<GeReal32> points)
+    {
+        Assign(points);
+    }
+
+    void Assign(GeVector3ArrayCView<GeReal32> points)
+    {
+        m_grid = GeQuantizeGrid<GeReal32>::Fit<GeInt16>(GeVector3BatchBounds<GeReal32>(points));
+        m_lanes.resize(points.size);
+        GeVector3BatchQuantize<GeReal32, GeInt16>(points, m_grid, m_lanes.view());
+    }
+
+    GeSize size() const { return m_lanes.size(); }
+    bool empty() const { return m_lanes.empty(); }
+    GeSize ByteSize() const { return 3 * size() * sizeof(GeInt16); }
+
+    const GeQuantizeGrid<GeReal32>& Grid() const { return m_grid; }
+
+    // Per-axis bound: half a step plus the float rounding of the scale and of
+    // origin + q * step, a few ulps of the largest coordinate
+    GeVector3<GeReal32> MaxError() const
+    {
+        auto bound = [](GeReal32 origin, GeReal32 step)
+        {
+            const GeReal32 magnitude = std::abs(origin) + step * std::numeric_limits<GeInt16>::max();
+            return step / 2 + 4 * std::numeric_limits<GeReal32>::epsilon() * magnitude;
+        };
+        return GeVector3<GeReal32>(bound(m_grid.origin.x, m_grid.step.x), bound(m_grid.origin.y, m_grid.step.y),
+                                   bound(m_grid.origin.z, m_grid.step.z));
+    }
+
+    GeVector3<GeReal32> operator[](GeSize i) const
+    {
+        GeReal32 x, y, z;
+        Decode(i, {&x, &y, &z, 1});
+        return GeVector3<GeReal32>(x, y, z);
+    }
+
+    void Decode(GeSize first, GeVector3ArrayView<GeReal32> out) const
+    {
+        assert(first + out.size <= size());
+        const GeVector3ArrayCView<GeInt16> lanes = m_lanes.cview();
+        GeVector3BatchDequantize<GeReal32, GeInt16>({lanes.x + first, lanes.y + first, lanes.z + first, out.size}, m_grid, out);
+    }
+
+    GeVector3ArrayCView<GeInt16> cview() const { return m_lanes.cview(); }
+
+private:
+    GeQuantizeGrid<GeReal32> m_grid;
+    GeVector3Array<GeInt16> m_lanes;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Decodes compressed (any of the arrays above) blockSize points at a time
+    into one reused float buffer and calls f(GeVector3ArrayCView<GeReal32>
+    block, GeSize first) for each block, so float batch kernels run over
+    compressed storage without a full-size copy.
+*/
+template <typename A, typename F>
+void GeForEachDecodedBlock(const A& compressed, F&& f, GeSize blockSize = 1024)
+{
+    assert(blockSize > 0);
+    const GeSize n = compressed.size();
+    GeVector3Array<GeReal32> block(std::min(blockSize, n));
+    for (GeSize first = 0; first < n; first += blockSize)
+    {
+        GeVector3ArrayView<GeReal32> out = block.view();
+        out.size = std::min(blockSize, n - first);
+        compressed.Decode(first, out);
+        f(GeVector3ArrayCView<GeReal32>{out.x, out.y, out.z, out.size}, first);
+    }
+}
+
+namespace ge
+{
+    using vector3_array_half = GeVector3ArrayHalf;
+    using normal_array_oct32 = GeNormalArrayOct32;
+    using vector3_array_quantized16 = GeVector3ArrayQuantized16;
+
+    inline GeUint32 octahedral_encode(const GeVector3<GeReal32>& n)
+    {
+        return GeOctahedralEncode(n);
+    }
+
+    inline GeVector3<GeReal32> octahedral_decode(GeUint32 code)
+    {
+        return GeOctahedralDecode(code);
+    }
+
+    template <typename A, typename F>
+    inline void for_each_decoded_block(const A& compressed, F&& f, GeSize blockSize = 1024)
+    {
+        GeForEachDecodedBlock(compressed, std::forward<F>(f), blockSize);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_COMPRESSED_H
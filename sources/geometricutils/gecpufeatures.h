@@ -0,0 +1,121 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_CPUFEATURES_H
+#define GEOMUTILS_CPUFEATURES_H
+
+#include "gebasedefs.h"
+
+//==============================================================================
+// CPU features
+
+//------------------------------------------------------------------------------
+/**
+    Instruction set extensions reported by cpuid and enabled by the OS.
+    All false on non-x86 targets.
+*/
+struct GeCpuFeatures
+{
+    bool sse2{};
+    bool sse42{};
+    bool avx{};
+    bool avx2{};
+    bool fma{};
+    bool f16c{};
+    bool bmi2{};
+    bool avx512f{};
+    bool avx512bw{};
+    bool avx512vl{};
+};
+
+//------------------------------------------------------------------------------
+/**
+    Detected once on first use.
+*/
+const GeCpuFeatures& GeGetCpuFeatures();
+
+//==============================================================================
+// Kernel dispatch
+
+//------------------------------------------------------------------------------
+/**
+    Instruction set tiers the batch kernels are built for, in increasing
+    order of width.
+*/
+enum class GeSimdTier : GeInt32
+{
+    kScalar = 0,
+    kSse2 = 1,
+    kAvx2 = 2,
+    kAvx512 = 3
+};
+
+//------------------------------------------------------------------------------
+/**
+    Widest tier that is both compiled in and supported by the running CPU.
+*/
+GeSimdTier GeGetMaxSupportedSimdTier();
+
+//------------------------------------------------------------------------------
+/**
+    Tier currently used by the batch kernels. Initially the widest supported
+    tier, or the one named by the GE_SIMD_TIER environment variable
+    (scalar, sse2, avx2, avx512) when that tier is supported.
+*/
+GeSimdTier GeGetSimdTier();
+
+//------------------------------------------------------------------------------
+/**
+    Forces the batch kernels to the given tier, mainly for testing.
+    @return false (and leaves the tier unchanged) if the tier is not supported
+*/
+bool GeSetSimdTier(GeSimdTier tier);
+
+//------------------------------------------------------------------------------
+/**
+    @return "scalar", "sse2", "avx2" or "avx512"
+*/
+const char* GeSimdTierName(GeSimdTier tier);
+
+namespace ge
+{
+    using cpu_features = GeCpuFeatures;
+    using simd_tier = GeSimdTier;
+
+    inline const GeCpuFeatures& cpu_features_get()
+    {
+        return GeGetCpuFeatures();
+    }
+
+    inline GeSimdTier simd_tier_get()
+    {
+        return GeGetSimdTier();
+    }
+
+    inline bool simd_tier_set(GeSimdTier tier)
+    {
+        return GeSetSimdTier(tier);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_CPUFEATURES_H
@@ -0,0 +1,337 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_CURVE_H
+#define GEOMUTILS_CURVE_H
+
+#include "geaabb.h"
+#include "gearena.h"
+#include "gevector3array.h"
+#include "gespan.h"
+#include "impl/gecurvecodes.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+//==============================================================================
+// Space-filling curve codes
+//
+// Keys of integer cells (x, y, z): 30-bit keys take the low 10 bits of each
+// coordinate, 63-bit keys the low 21. x is the most significant axis. Points
+// close in key order are close in space, Hilbert keys more consistently than
+// Morton (Z-order) ones, which are cheaper to compute.
+
+enum class GeSpaceCurve : GeInt32
+{
+    kMorton = 0,
+    kHilbert = 1
+};
+
+inline GeUint32 GeMortonEncode30(GeUint32 x, GeUint32 y, GeUint32 z)
+{
+    return ge::details::curve::Interleave<GeUint32>(x, y, z);
+}
+
+inline GeUint64 GeMortonEncode63(GeUint32 x, GeUint32 y, GeUint32 z)
+{
+    return ge::details::curve::Interleave<GeUint64>(x, y, z);
+}
+
+inline GeVector3<GeUint32> GeMortonDecode30(GeUint32 key)
+{
+    GeVector3<GeUint32> cell;
+    ge::details::curve::Deinterleave(key, cell.x, cell.y, cell.z);
+    return cell;
+}
+
+inline GeVector3<GeUint32> GeMortonDecode63(GeUint64 key)
+{
+    GeVector3<GeUint32> cell;
+    ge::details::curve::Deinterleave(key, cell.x, cell.y, cell.z);
+    return cell;
+}
+
+inline GeUint32 GeHilbertEncode30(GeUint32 x, GeUint32 y, GeUint32 z)
+{
+    return ge::details::curve::MortonToHilbert(GeMortonEncode30(x, y, z));
+}
+
+inline GeUint64 GeHilbertEncode63(GeUint32 x, GeUint32 y, GeUint32 z)
+{
+    return ge::details::curve::MortonToHilbert(GeMortonEncode63(x, y, z));
+}
+
+inline GeVector3<GeUint32> GeHilbertDecode30(GeUint32 key)
+{
+    return GeMortonDecode30(ge::details::curve::HilbertToMorton(key));
+}
+
+inline GeVector3<GeUint32> GeHilbertDecode63(GeUint64 key)
+{
+    return GeMortonDecode63(ge::details::curve::HilbertToMorton(key));
+}
+
+namespace ge
+{
+namespace details
+{
+namespace curve
+{
+    // Maps box onto 2^kBits cells per axis; a flat axis gets scale 0 and so
+    // a single cell
+    template <typename T>
+    struct Grid
+    {
+        T origin[3];
+        T scale[3];
+    };
+
+    template <typename T>
+    Grid<T> FitGrid(const GeAabb3<T>& box, unsigned bits)
+    {
+        Grid<T> grid = {{T(0), T(0), T(0)}, {T(0), T(0), T(0)}};
+        if (box.IsEmpty())
+            return grid;
+        const T cells = static_cast<T>(GeUint64(1) << bits);
+        const GeVector3<T> e = box.Extent();
+        auto scaleFor = [cells](T extent) { return extent > T(0) ? cells / extent : T(0); };
+        grid.origin[0] = box.min.x;
+        grid.origin[1] = box.min.y;
+        grid.origin[2] = box.min.z;
+        grid.scale[0] = scaleFor(e.x);
+        grid.scale[1] = scaleFor(e.y);
+        grid.scale[2] = scaleFor(e.z);
+        return grid;
+    }
+
+    template <typename T, typename Key>
+    void EncodeGeneric(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve, Key* out)
+    {
+        constexpr unsigned kBits = BitsPerAxis<Key>();
+        const Grid<T> grid = FitGrid(box, kBits);
+        const T maxCell = static_cast<T>((1u << kBits) - 1);
+        for (GeSize i = 0; i < a.size; ++i)
+        {
+            const Key morton = Interleave<Key>(Cell(a.x[i], grid.origin[0], grid.scale[0], maxCell),
+                                               Cell(a.y[i], grid.origin[1], grid.scale[1], maxCell),
+                                               Cell(a.z[i], grid.origin[2], grid.scale[2], maxCell));
+            out[i] = curve == GeSpaceCurve::kHilbert ? MortonToHilbert(morton) : morton;
+        }
+    }
+} // end of curve
+} // end of details
+} // end of ge
+
+//==============================================================================
+// Curve keys of points
+//
+// box is divided into 2^10 (30-bit keys) or 2^21 (63-bit keys) cells per
+// axis, each cell being [min + k * extent / 2^bits, min + (k + 1) * extent /
+// 2^bits) and the last one closed. Coordinates outside box are clamped to
+// it and NaN goes to the first cell, so keys are defined for any input;
+// GeVector3BatchBounds gives the usual box. The GeReal32/GeReal64 versions
+// interleave with BMI2 pdep on the AVX2 and AVX-512 tiers and produce the
+// same keys on every tier.
+
+//------------------------------------------------------------------------------
+/**
+    Key parameters.
+*/
+struct GeCurveOptions
+{
+    bool parallel = true;               // split the input across threads
+    GeSize grainSize = 1 << 16;         // smallest chunk handed to a worker
+    GeArena* pArena = nullptr;          // scratch buffers; the heap when null
+};
+
+//------------------------------------------------------------------------------
+/**
+    30-bit curve keys of the points of a.
+*/
+template <typename T>
+void GeVector3BatchCurveKeys(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve,
+                             GeSpan<GeUint32> keys, const GeCurveOptions& options = GeCurveOptions())
+{
+    assert(a.size == keys.size());
+    (void)options;
+    ge::details::curve::EncodeGeneric(a, box, curve, keys.data());
+}
+
+template <>
+void GeVector3BatchCurveKeys<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint32> keys, const GeCurveOptions& options);
+
+template <>
+void GeVector3BatchCurveKeys<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint32> keys, const GeCurveOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    63-bit curve keys of the points of a.
+*/
+template <typename T>
+void GeVector3BatchCurveKeys(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve,
+                             GeSpan<GeUint64> keys, const GeCurveOptions& options = GeCurveOptions())
+{
+    assert(a.size == keys.size());
+    (void)options;
+    ge::details::curve::EncodeGeneric(a, box, curve, keys.data());
+}
+
+template <>
+void GeVector3BatchCurveKeys<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint64> keys, const GeCurveOptions& options);
+
+template <>
+void GeVector3BatchCurveKeys<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint64> keys, const GeCurveOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Curve order of the points of a: order[k] is the index of the point with
+    the k-th smallest 63-bit key, points sharing a key keeping their input
+    order. Pass it to GeVector3BatchGather and GeGather to reorder the
+    points and their attributes.
+*/
+template <typename T>
+void GeVector3BatchCurveOrder(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve,
+                              GeSpan<GeUint32> order, const GeCurveOptions& options = GeCurveOptions())
+{
+    assert(a.size == order.size());
+    GeArenaVector<GeUint64> keys(a.size, GeArenaAllocator<GeUint64>(options.pArena));
+    GeVector3BatchCurveKeys<T>(a, box, curve, GeSpan<GeUint64>(keys.data(), keys.size()), options);
+    std::iota(order.data(), order.data() + order.size(), GeUint32(0));
+    std::stable_sort(order.data(), order.data() + order.size(),
+                     [&keys](GeUint32 i, GeUint32 j) { return keys[i] < keys[j]; });
+}
+
+template <>
+void GeVector3BatchCurveOrder<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                        GeSpan<GeUint32> order, const GeCurveOptions& options);
+
+template <>
+void GeVector3BatchCurveOrder<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                        GeSpan<GeUint32> order, const GeCurveOptions& options);
+
+//==============================================================================
+// Reordering by a permutation
+
+//------------------------------------------------------------------------------
+/**
+    out[k] = in[order[k]]. out must not overlap in.
+*/
+template <typename A>
+void GeGather(GeSpan<const A> in, GeSpan<const GeUint32> order, GeSpan<A> out)
+{
+    assert(order.size() == out.size());
+    for (GeSize k = 0; k < order.size(); ++k)
+    {
+        assert(order[k] < in.size());
+        out[k] = in[order[k]];
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+    out[k] = in[order[k]] for the three lanes. out must not overlap in.
+*/
+template <typename T>
+void GeVector3BatchGather(GeVector3ArrayCView<T> in, GeSpan<const GeUint32> order, GeVector3ArrayView<T> out)
+{
+    assert(order.size() == out.size);
+    GeGather<T>(GeSpan<const T>(in.x, in.size), order, GeSpan<T>(out.x, out.size));
+    GeGather<T>(GeSpan<const T>(in.y, in.size), order, GeSpan<T>(out.y, out.size));
+    GeGather<T>(GeSpan<const T>(in.z, in.size), order, GeSpan<T>(out.z, out.size));
+}
+
+//------------------------------------------------------------------------------
+/**
+    inverse[order[k]] = k: maps old indices to new ones, e.g. to rewrite
+    an index buffer after gathering the vertices it refers to.
+*/
+inline void GeInvertOrder(GeSpan<const GeUint32> order, GeSpan<GeUint32> inverse)
+{
+    assert(order.size() == inverse.size());
+    for (GeSize k = 0; k < order.size(); ++k)
+    {
+        assert(order[k] < inverse.size());
+        inverse[order[k]] = static_cast<GeUint32>(k);
+    }
+}
+
+namespace ge
+{
+    using space_curve = GeSpaceCurve;
+    using curve_options = GeCurveOptions;
+
+    inline uint32_t morton_encode30(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return GeMortonEncode30(x, y, z);
+    }
+
+    inline uint64_t morton_encode63(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return GeMortonEncode63(x, y, z);
+    }
+
+    inline uint32_t hilbert_encode30(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return GeHilbertEncode30(x, y, z);
+    }
+
+    inline uint64_t hilbert_encode63(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return GeHilbertEncode63(x, y, z);
+    }
+
+    template <typename T, typename Key, typename Allocator>
+    inline void batch_curve_keys(const GeVector3Array<T, Allocator>& a, const GeAabb3<T>& box, GeSpaceCurve curve,
+                                 GeSpan<Key> keys, const GeCurveOptions& options = GeCurveOptions())
+    {
+        GeVector3BatchCurveKeys<T>(a.cview(), box, curve, keys, options);
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_curve_order(const GeVector3Array<T, Allocator>& a, const GeAabb3<T>& box, GeSpaceCurve curve,
+                                  GeSpan<uint32_t> order, const GeCurveOptions& options = GeCurveOptions())
+    {
+        GeVector3BatchCurveOrder<T>(a.cview(), box, curve, order, options);
+    }
+
+    template <typename A>
+    inline void gather(GeSpan<const A> in, GeSpan<const uint32_t> order, GeSpan<A> out)
+    {
+        GeGather<A>(in, order, out);
+    }
+
+    template <typename T, typename InAllocator, typename OutAllocator>
+    inline void batch_gather(const GeVector3Array<T, InAllocator>& in, GeSpan<const uint32_t> order, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(order.size());
+        GeVector3BatchGather<T>(in.cview(), order, out.view());
+    }
+} // eof ge
+
+#endif // GEOMUTILS_CURVE_H
@@ -0,0 +1,182 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_FIXED_H
+#define GEOMUTILS_FIXED_H
+
+#include "gevector3.h"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+/**
+    Signed fixed-point number with Q fractional bits stored in Rep: the value
+    is Raw() / 2^Q. Addition and subtraction are exact and, like integer
+    arithmetic, must not overflow Rep. Multiplication and division go through
+    the next wider integer and round the result to nearest (ties away from
+    zero for products, towards zero for quotients).
+*/
+template <int Q, typename Rep = GeInt32>
+class GeFixed
+{
+    static_assert(std::is_integral<Rep>::value || std::is_same<Rep, GeWide<GeInt32>::dot_type>::value,
+                  "GeFixed: Rep must be a signed integer");
+#ifndef GE_HAS_INT128
+    static_assert(sizeof(Rep) < sizeof(GeInt64), "GeFixed: a 64-bit Rep needs 128-bit integers");
+#endif
+    static_assert(Q >= 0 && Q < 8 * static_cast<int>(sizeof(Rep)) - 1, "GeFixed: Q out of range");
+
+public:
+    using rep_type = Rep;
+    static constexpr int kFractionBits = Q;
+
+    constexpr GeFixed() = default;
+
+    // Integer value, so that GeZero and literals such as GeVector3(0, 0, 0)
+    // work as for the built-in types
+    constexpr GeFixed(int value)
+        : m_raw(static_cast<Rep>(static_cast<Rep>(value) * kOne))
+        {}
+
+    static constexpr GeFixed FromRaw(Rep raw)
+    {
+        GeFixed result;
+        result.m_raw = raw;
+        return result;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Nearest fixed-point value to x, saturated to the range of Rep; NaN
+        gives 0.
+    */
+    template <typename R>
+    static GeFixed FromReal(R x)
+    {
+        static_assert(std::is_floating_point<R>::value, "GeFixed::FromReal: R must be a real type");
+        const R scaled = std::nearbyint(x * static_cast<R>(kOne));
+        if (!(scaled == scaled))
+            return GeFixed();
+        if (scaled >= -static_cast<R>(std::numeric_limits<Rep>::min()))
+            return FromRaw(std::numeric_limits<Rep>::max());
+        if (scaled <= static_cast<R>(std::numeric_limits<Rep>::min()))
+            return FromRaw(std::numeric_limits<Rep>::min());
+        return FromRaw(static_cast<Rep>(scaled));
+    }
+
+    template <typename R>
+    constexpr R ToReal() const
+    {
+        return static_cast<R>(m_raw) / static_cast<R>(kOne);
+    }
+
+    constexpr Rep Raw() const { return m_raw; }
+
+    constexpr GeFixed operator+(GeFixed other) const { return FromRaw(m_raw + other.m_raw); }
+    constexpr GeFixed operator-(GeFixed other) const { return FromRaw(m_raw - other.m_raw); }
+    constexpr GeFixed operator-() const { return FromRaw(-m_raw); }
+
+    constexpr GeFixed operator*(GeFixed other) const
+    {
+        using W = typename GeWide<Rep>::product_type;
+        const W product = static_cast<W>(m_raw) * static_cast<W>(other.m_raw);
+        if constexpr (Q == 0) {
+            return FromRaw(static_cast<Rep>(product));
+        } else {
+            const W half = W(1) << (Q - 1);
+            const W rounded = product >= 0 ? (product + half) >> Q : -((-product + half) >> Q);
+            return FromRaw(static_cast<Rep>(rounded));
+        }
+    }
+
+    constexpr GeFixed operator/(GeFixed other) const
+    {
+        using W = typename GeWide<Rep>::product_type;
+        return FromRaw(static_cast<Rep>((static_cast<W>(m_raw) * kOne) / other.m_raw));
+    }
+
+    GeFixed& operator+=(GeFixed other) { return *this = *this + other; }
+    GeFixed& operator-=(GeFixed other) { return *this = *this - other; }
+    GeFixed& operator*=(GeFixed other) { return *this = *this * other; }
+    GeFixed& operator/=(GeFixed other) { return *this = *this / other; }
+
+    constexpr bool operator==(GeFixed other) const { return m_raw == other.m_raw; }
+    constexpr bool operator!=(GeFixed other) const { return m_raw != other.m_raw; }
+    constexpr bool operator<(GeFixed other) const { return m_raw < other.m_raw; }
+    constexpr bool operator<=(GeFixed other) const { return m_raw <= other.m_raw; }
+    constexpr bool operator>(GeFixed other) const { return m_raw > other.m_raw; }
+    constexpr bool operator>=(GeFixed other) const { return m_raw >= other.m_raw; }
+
+private:
+    static constexpr Rep kOne = static_cast<Rep>(Rep(1) << Q);
+
+    Rep m_raw = 0;
+};
+
+template <int Q, typename Rep>
+inline std::ostream& operator<<(std::ostream& os, GeFixed<Q, Rep> value)
+{
+    return os << value.template ToReal<GeReal64>();
+}
+
+template <int Q, typename Rep>
+constexpr inline GeFixed<Q, Rep> GeIntAbs(GeFixed<Q, Rep> x)
+{
+    return x >= GeFixed<Q, Rep>() ? x : -x;
+}
+
+//------------------------------------------------------------------------------
+/**
+    Exact products of two Q-bit values have 2Q fractional bits in the wide
+    integer of Rep, so GeWideDot and GeWideCross of fixed-point vectors are
+    exact.
+*/
+template <int Q, typename Rep>
+struct GeWide<GeFixed<Q, Rep>>
+{
+    using product_type = GeFixed<2 * Q, typename GeWide<Rep>::product_type>;
+    using dot_type = GeFixed<2 * Q, typename GeWide<Rep>::dot_type>;
+
+    static product_type Product(GeFixed<Q, Rep> a, GeFixed<Q, Rep> b)
+    {
+        using W = typename product_type::rep_type;
+        return product_type::FromRaw(static_cast<W>(a.Raw()) * static_cast<W>(b.Raw()));
+    }
+
+    static dot_type DotProduct(GeFixed<Q, Rep> a, GeFixed<Q, Rep> b)
+    {
+        using W = typename dot_type::rep_type;
+        return dot_type::FromRaw(static_cast<W>(a.Raw()) * static_cast<W>(b.Raw()));
+    }
+};
+
+namespace ge
+{
+    template <int Q, typename Rep = GeInt32>
+    using fixed = GeFixed<Q, Rep>;
+} // eof ge
+
+#endif // GEOMUTILS_FIXED_H
@@ -0,0 +1,198 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_MATRIX3_H
+#define GEOMUTILS_MATRIX3_H
+
+#include "gevector3.h"
+
+#include <cmath>
+#include <iostream>
+
+//------------------------------------------------------------------------------
+/**
+    3x3 matrix, row-major (m[row][column]), acting on column vectors: M * v.
+    Default-constructed as the identity.
+*/
+template <typename T>
+class GeMatrix3
+{
+public:
+    T m[3][3];
+
+    // Constructors
+    GeMatrix3()
+        : m{{T(1), T(0), T(0)}, {T(0), T(1), T(0)}, {T(0), T(0), T(1)}}
+        {}
+
+    GeMatrix3(T m00, T m01, T m02,
+              T m10, T m11, T m12,
+              T m20, T m21, T m22)
+        : m{{m00, m01, m02}, {m10, m11, m12}, {m20, m21, m22}}
+        {}
+
+    static GeMatrix3 Identity() {
+        return GeMatrix3();
+    }
+
+    static GeMatrix3 FromRows(const GeVector3<T>& r0, const GeVector3<T>& r1, const GeVector3<T>& r2) {
+        return GeMatrix3(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+    }
+
+    static GeMatrix3 FromColumns(const GeVector3<T>& c0, const GeVector3<T>& c1, const GeVector3<T>& c2) {
+        return GeMatrix3(c0.x, c1.x, c2.x, c0.y, c1.y, c2.y, c0.z, c1.z, c2.z);
+    }
+
+    static GeMatrix3 Scale(const GeVector3<T>& s) {
+        return GeMatrix3(s.x, T(0), T(0), T(0), s.y, T(0), T(0), T(0), s.z);
+    }
+
+    // Rotation by angle radians about the unit vector axis (right-handed)
+    static GeMatrix3 Rotation(const GeVector3<T>& axis, T angle) {
+        const T c = std::cos(angle);
+        const T s = std::sin(angle);
+        const T t = T(1) - c;
+        const T x = axis.x, y = axis.y, z = axis.z;
+        return GeMatrix3(t * x * x + c,     t * x * y - s * z, t * x * z + s * y,
+                         t * x * y + s * z, t * y * y + c,     t * y * z - s * x,
+                         t * x * z - s * y, t * y * z + s * x, t * z * z + c);
+    }
+
+    // Element access
+    T& operator()(int row, int column) {
+        return m[row][column];
+    }
+
+    T operator()(int row, int column) const {
+        return m[row][column];
+    }
+
+    GeVector3<T> row(int r) const {
+        return GeVector3<T>(m[r][0], m[r][1], m[r][2]);
+    }
+
+    GeVector3<T> column(int c) const {
+        return GeVector3<T>(m[0][c], m[1][c], m[2][c]);
+    }
+
+    // Matrix operations
+    GeMatrix3 operator+(const GeMatrix3& other) const {
+        GeMatrix3 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                r.m[i][j] = m[i][j] + other.m[i][j];
+        return r;
+    }
+
+    GeMatrix3 operator-(const GeMatrix3& other) const {
+        GeMatrix3 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                r.m[i][j] = m[i][j] - other.m[i][j];
+        return r;
+    }
+
+    GeMatrix3 operator*(T scalar) const {
+        GeMatrix3 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                r.m[i][j] = m[i][j] * scalar;
+        return r;
+    }
+
+    GeMatrix3 operator*(const GeMatrix3& other) const {
+        GeMatrix3 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                r.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] + m[i][2] * other.m[2][j];
+        return r;
+    }
+
+    // Same operation order as the batch kernels in getransform.h
+    GeVector3<T> operator*(const GeVector3<T>& v) const {
+        return GeVector3<T>(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                            m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                            m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+    }
+
+    bool operator==(const GeMatrix3& other) const {
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                if (!(m[i][j] == other.m[i][j]))
+                    return false;
+        return true;
+    }
+
+    bool operator!=(const GeMatrix3& other) const {
+        return !(*this == other);
+    }
+
+    GeMatrix3 transpose() const {
+        return GeMatrix3(m[0][0], m[1][0], m[2][0],
+                         m[0][1], m[1][1], m[2][1],
+                         m[0][2], m[1][2], m[2][2]);
+    }
+
+    T determinant() const {
+        return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+             - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+             + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    }
+
+    // Writes the inverse to out; returns false (out untouched) when the
+    // determinant is zero or not finite
+    bool inverse(GeMatrix3& out) const {
+        const T c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+        const T c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+        const T c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+        const T det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+        if (det == T(0) || !std::isfinite(det))
+            return false;
+
+        const T inv = T(1) / det;
+        out = GeMatrix3(c00 * inv,
+                        (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv,
+                        (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv,
+                        c01 * inv,
+                        (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv,
+                        (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv,
+                        c02 * inv,
+                        (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv,
+                        (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv);
+        return true;
+    }
+
+    // Display matrix
+    void print() const {
+        for (int i = 0; i < 3; ++i)
+            std::cout << "(" << m[i][0] << ", " << m[i][1] << ", " << m[i][2] << ")" << std::endl;
+    }
+};
+
+namespace ge
+{
+    template <typename T>
+    using matrix3 = GeMatrix3<T>;
+} // eof ge
+
+#endif // GEOMUTILS_MATRIX3_H
@@ -0,0 +1,231 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_MATRIX4_H
+#define GEOMUTILS_MATRIX4_H
+
+#include "gematrix3.h"
+
+#include <cmath>
+#include <iostream>
+
+//------------------------------------------------------------------------------
+/**
+    4x4 matrix, row-major (m[row][column]), acting on column vectors: M * v.
+    An affine transform keeps its translation in the last column and
+    (0, 0, 0, 1) in the last row. Default-constructed as the identity.
+*/
+template <typename T>
+class GeMatrix4
+{
+public:
+    T m[4][4];
+
+    // Constructors
+    GeMatrix4()
+        : m{{T(1), T(0), T(0), T(0)}, {T(0), T(1), T(0), T(0)}, {T(0), T(0), T(1), T(0)}, {T(0), T(0), T(0), T(1)}}
+        {}
+
+    GeMatrix4(T m00, T m01, T m02, T m03,
+              T m10, T m11, T m12, T m13,
+              T m20, T m21, T m22, T m23,
+              T m30, T m31, T m32, T m33)
+        : m{{m00, m01, m02, m03}, {m10, m11, m12, m13}, {m20, m21, m22, m23}, {m30, m31, m32, m33}}
+        {}
+
+    static GeMatrix4 Identity() {
+        return GeMatrix4();
+    }
+
+    // Affine transform applying linear, then adding translation
+    static GeMatrix4 Affine(const GeMatrix3<T>& linear, const GeVector3<T>& translation) {
+        const auto& l = linear.m;
+        return GeMatrix4(l[0][0], l[0][1], l[0][2], translation.x,
+                         l[1][0], l[1][1], l[1][2], translation.y,
+                         l[2][0], l[2][1], l[2][2], translation.z,
+                         T(0), T(0), T(0), T(1));
+    }
+
+    static GeMatrix4 Translation(const GeVector3<T>& t) {
+        return Affine(GeMatrix3<T>(), t);
+    }
+
+    static GeMatrix4 Scale(const GeVector3<T>& s) {
+        return Affine(GeMatrix3<T>::Scale(s), GeVector3<T>());
+    }
+
+    // Element access
+    T& operator()(int row, int column) {
+        return m[row][column];
+    }
+
+    T operator()(int row, int column) const {
+        return m[row][column];
+    }
+
+    // Upper-left 3x3 block
+    GeMatrix3<T> linear() const {
+        return GeMatrix3<T>(m[0][0], m[0][1], m[0][2],
+                            m[1][0], m[1][1], m[1][2],
+                            m[2][0], m[2][1], m[2][2]);
+    }
+
+    GeVector3<T> translation() const {
+        return GeVector3<T>(m[0][3], m[1][3], m[2][3]);
+    }
+
+    bool is_affine() const {
+        return m[3][0] == T(0) && m[3][1] == T(0) && m[3][2] == T(0) && m[3][3] == T(1);
+    }
+
+    // Matrix operations
+    GeMatrix4 operator*(T scalar) const {
+        GeMatrix4 r;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = m[i][j] * scalar;
+        return r;
+    }
+
+    GeMatrix4 operator*(const GeMatrix4& other) const {
+        GeMatrix4 r;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] +
+                            m[i][2] * other.m[2][j] + m[i][3] * other.m[3][j];
+        return r;
+    }
+
+    bool operator==(const GeMatrix4& other) const {
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                if (!(m[i][j] == other.m[i][j]))
+                    return false;
+        return true;
+    }
+
+    bool operator!=(const GeMatrix4& other) const {
+        return !(*this == other);
+    }
+
+    // Transforms; same operation order as the batch kernels in getransform.h
+
+    // Point with w = 1, ignoring the last row (exact for affine matrices)
+    GeVector3<T> transform_point(const GeVector3<T>& p) const {
+        return GeVector3<T>(m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+                            m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+                            m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]);
+    }
+
+    // Point with w = 1 followed by the perspective divide
+    GeVector3<T> project_point(const GeVector3<T>& p) const {
+        const T w = m[3][0] * p.x + m[3][1] * p.y + m[3][2] * p.z + m[3][3];
+        const GeVector3<T> q = transform_point(p);
+        return GeVector3<T>(q.x / w, q.y / w, q.z / w);
+    }
+
+    // Direction (w = 0): the upper-left 3x3 block only
+    GeVector3<T> transform_direction(const GeVector3<T>& d) const {
+        return GeVector3<T>(m[0][0] * d.x + m[0][1] * d.y + m[0][2] * d.z,
+                            m[1][0] * d.x + m[1][1] * d.y + m[1][2] * d.z,
+                            m[2][0] * d.x + m[2][1] * d.y + m[2][2] * d.z);
+    }
+
+    GeMatrix4 transpose() const {
+        GeMatrix4 r;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = m[j][i];
+        return r;
+    }
+
+    T determinant() const {
+        T s[6], c[6];
+        Minors(s, c);
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+
+    // Writes the inverse to out; returns false (out untouched) when the
+    // determinant is zero or not finite
+    bool inverse(GeMatrix4& out) const {
+        T s[6], c[6];
+        Minors(s, c);
+        const T det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+        if (det == T(0) || !std::isfinite(det))
+            return false;
+
+        const T inv = T(1) / det;
+        out = GeMatrix4(( m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3]) * inv,
+                        (-m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3]) * inv,
+                        ( m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * inv,
+                        (-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * inv,
+
+                        (-m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1]) * inv,
+                        ( m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1]) * inv,
+                        (-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * inv,
+                        ( m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * inv,
+
+                        ( m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0]) * inv,
+                        (-m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0]) * inv,
+                        ( m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * inv,
+                        (-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * inv,
+
+                        (-m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0]) * inv,
+                        ( m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0]) * inv,
+                        (-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * inv,
+                        ( m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * inv);
+        return true;
+    }
+
+    // Display matrix
+    void print() const {
+        for (int i = 0; i < 4; ++i)
+            std::cout << "(" << m[i][0] << ", " << m[i][1] << ", " << m[i][2] << ", " << m[i][3] << ")" << std::endl;
+    }
+
+private:
+    // 2x2 minors of the top two rows (s) and the bottom two rows (c)
+    void Minors(T s[6], T c[6]) const {
+        s[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        s[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        s[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        s[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        s[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        s[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        c[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        c[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        c[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        c[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        c[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        c[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    }
+};
+
+namespace ge
+{
+    template <typename T>
+    using matrix4 = GeMatrix4<T>;
+} // eof ge
+
+#endif // GEOMUTILS_MATRIX4_H
@@ -0,0 +1,448 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_PARALLEL_H
+#define GEOMUTILS_PARALLEL_H
+
+#include "gebasedefs.h"
+#include "gearena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//==============================================================================
+// Scheduler
+//
+// Parallel algorithms run on a pool of worker threads, each with its own
+// deque of tasks. A worker splits the range it is given in halves, keeps
+// the left one and pushes the right one; idle workers steal the oldest,
+// largest halves of the others. The calling thread takes part until its
+// range is done, so nested calls from inside tasks do not deadlock.
+
+//------------------------------------------------------------------------------
+/**
+    Number of hardware threads, at least 1. Queried once; the query itself
+    can cost microseconds.
+*/
+inline GeSize GeGetHardwareConcurrency()
+{
+    static const GeSize s_concurrency = []() {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n > 0 ? static_cast<GeSize>(n) : GeSize(1);
+    }();
+    return s_concurrency;
+}
+
+namespace ge
+{
+namespace details
+{
+namespace parallel
+{
+    class Pool;
+
+    //--------------------------------------------------------------------------
+    /**
+        A range of work shared by the tasks split from it. It lives on the
+        stack of the thread that waits for it.
+    */
+    struct Job
+    {
+        using RunFn = void (*)(Job& job, GeSize begin, GeSize end);
+
+        Job(RunFn run, GeSize grain, GeSize count)
+            : run{run}
+            , grain{grain}
+            , remaining{count}
+            {}
+
+        RunFn run;
+        GeSize grain;                       // ranges this long or shorter are not split
+        std::atomic<GeSize> remaining;      // elements not finished yet
+        std::atomic<bool> failed{false};    // set once; later tasks skip their work
+        std::exception_ptr error;           // first exception thrown by run
+    };
+
+    template <typename F>
+    struct RangeJob : Job
+    {
+        RangeJob(F& f, GeSize grain, GeSize count)
+            : Job(&RangeJob::Run, grain, count)
+            , pF{&f}
+            {}
+
+        static void Run(Job& job, GeSize begin, GeSize end)
+        {
+            (*static_cast<RangeJob&>(job).pF)(begin, end);
+        }
+
+        F* pF;
+    };
+
+    // Runs [begin, end) of the job on the active scheduler, the calling
+    // thread helping, and rethrows the first exception of a task
+    void Run(Job& job, GeSize begin, GeSize end);
+
+    // Ranges are cut in about this many tasks per thread at most, fewer
+    // when the grain size asks for it; stealing balances the rest
+    constexpr GeSize kTasksPerThread = 8;
+} // end of parallel
+} // end of details
+} // end of ge
+
+//------------------------------------------------------------------------------
+/**
+    Pool of threadCount - 1 workers; the thread waiting on a parallel call
+    is the last one. With a count of 1 everything runs on the caller.
+    Parallel algorithms use the scheduler selected with GeSchedulerScope,
+    inside tasks the one running them, and GeDefaultScheduler() otherwise.
+*/
+class GeScheduler
+{
+public:
+    explicit GeScheduler(GeSize threadCount = GeGetHardwareConcurrency());
+    ~GeScheduler();
+
+    GeScheduler(const GeScheduler&) = delete;
+    GeScheduler& operator=(const GeScheduler&) = delete;
+
+    GeSize ThreadCount() const { return m_threadCount; }
+
+private:
+    friend void ge::details::parallel::Run(ge::details::parallel::Job&, GeSize, GeSize);
+
+    GeSize m_threadCount;
+    std::unique_ptr<ge::details::parallel::Pool> m_pPool;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Scheduler sized to the hardware, started on first use.
+*/
+GeScheduler& GeDefaultScheduler();
+
+//------------------------------------------------------------------------------
+/**
+    Runs the parallel algorithms called by this thread on a given scheduler
+    until the scope ends. Scopes nest.
+*/
+class GeSchedulerScope
+{
+public:
+    explicit GeSchedulerScope(GeScheduler& scheduler);
+    ~GeSchedulerScope();
+
+    GeSchedulerScope(const GeSchedulerScope&) = delete;
+    GeSchedulerScope& operator=(const GeSchedulerScope&) = delete;
+
+private:
+    GeScheduler* m_pPrevious;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Thread count of the scheduler parallel algorithms called from this
+    thread would use (the hardware one when it is the default scheduler).
+*/
+GeSize GeGetConcurrency();
+
+//==============================================================================
+// Algorithms
+
+//------------------------------------------------------------------------------
+/**
+    Calls f(chunkBegin, chunkEnd) over [begin, end) split into contiguous
+    chunks of at least grainSize elements, run by the scheduler's threads
+    and the calling one. Chunk boundaries depend on the thread count and
+    on stealing, so f must not rely on them for its results. The first
+    exception thrown by f is rethrown here; chunks not yet started by then
+    are skipped.
+*/
+template <typename F>
+void GeParallelFor(GeSize begin, GeSize end, GeSize grainSize, F&& f)
+{
+    if (end <= begin)
+        return;
+
+    const GeSize count = end - begin;
+    GeSize grain = grainSize > 0 ? grainSize : 1;
+    const GeSize threads = GeGetConcurrency();
+    if (threads <= 1 || count < 2 * grain)
+    {
+        f(begin, end);
+        return;
+    }
+
+    grain = std::max(grain, count / (ge::details::parallel::kTasksPerThread * threads));
+    ge::details::parallel::RangeJob<std::remove_reference_t<F>> job(f, grain, count);
+    ge::details::parallel::Run(job, begin, end);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Runs f1 and f2 concurrently and returns when both have finished. f2
+    runs on the calling thread, f1 on whichever thread gets to it first. An
+    exception thrown by either is rethrown here.
+*/
+template <typename F1, typename F2>
+void GeParallelInvoke(F1&& f1, F2&& f2)
+{
+    GeParallelFor(0, 2, 1, [&](GeSize first, GeSize last) {
+        for (GeSize i = first; i < last; ++i)
+        {
+            if (i == 0)
+                f2();
+            else
+                f1();
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/**
+    Number of chunks the deterministic algorithms cut count elements into:
+    it depends on grainSize only, never on the threads.
+*/
+inline GeSize GeParallelChunkCount(GeSize count, GeSize grainSize)
+{
+    const GeSize grain = grainSize > 0 ? grainSize : 1;
+    return (count + grain - 1) / grain;
+}
+
+//------------------------------------------------------------------------------
+/**
+    Reduces [begin, end): map(chunkBegin, chunkEnd) reduces a chunk to a T,
+    and the chunk results are folded left to right from identity with
+    combine(T, T). Chunks are cut from grainSize alone, so the result is
+    the same for every thread count and schedule - reproducible even when
+    combine is floating-point addition. The chunk results are kept in
+    pArena, or on the heap without one.
+*/
+template <typename T, typename Map, typename Combine>
+T GeParallelReduce(GeSize begin, GeSize end, GeSize grainSize, T identity, Map&& map, Combine&& combine,
+                   GeArena* pArena = nullptr)
+{
+    if (end <= begin)
+        return identity;
+
+    const GeSize count = end - begin;
+    const GeSize chunks = GeParallelChunkCount(count, grainSize);
+    auto chunkBegin = [begin, count, chunks](GeSize c) { return begin + count * c / chunks; };
+
+    GeArenaVector<T> partial(chunks, identity, GeArenaAllocator<T>(pArena));
+    GeParallelFor(0, chunks, 1, [&](GeSize first, GeSize last) {
+        for (GeSize c = first; c < last; ++c)
+            partial[c] = map(chunkBegin(c), chunkBegin(c + 1));
+    });
+
+    T result = identity;
+    for (const T& value : partial)
+        result = combine(result, value);
+    return result;
+}
+
+namespace ge
+{
+namespace details
+{
+namespace parallel
+{
+    // out[i] = op(out[i - 1], in[i]) from seed, chunk by chunk; the chunk
+    // sums are scanned serially in between, so like the reduction the
+    // result does not depend on the threads
+    template <typename T, typename Op>
+    void Scan(const T* in, T* out, GeSize count, T identity, Op& op, GeSize grainSize, bool inclusive,
+              GeArena* pArena)
+    {
+        if (count == 0)
+            return;
+
+        const GeSize chunks = GeParallelChunkCount(count, grainSize);
+        auto chunkBegin = [count, chunks](GeSize c) { return count * c / chunks; };
+
+        GeArenaVector<T> offset(chunks, identity, GeArenaAllocator<T>(pArena));
+        GeParallelFor(0, chunks, 1, [&](GeSize first, GeSize last) {
+            for (GeSize c = first; c < last; ++c)
+            {
+                T sum = identity;
+                for (GeSize i = chunkBegin(c), end = chunkBegin(c + 1); i < end; ++i)
+                    sum = op(sum, in[i]);
+                offset[c] = sum;
+            }
+        });
+
+        T running = identity;
+        for (T& value : offset)
+        {
+            const T sum = value;
+            value = running;
+            running = op(running, sum);
+        }
+
+        GeParallelFor(0, chunks, 1, [&](GeSize first, GeSize last) {
+            for (GeSize c = first; c < last; ++c)
+            {
+                T acc = offset[c];
+                for (GeSize i = chunkBegin(c), end = chunkBegin(c + 1); i < end; ++i)
+                {
+                    const T value = in[i];
+                    if (!inclusive)
+                        out[i] = acc;
+                    acc = op(acc, value);
+                    if (inclusive)
+                        out[i] = acc;
+                }
+            }
+        });
+    }
+} // end of parallel
+} // end of details
+} // end of ge
+
+//------------------------------------------------------------------------------
+/**
+    Inclusive scan, out[i] = in[0] op ... op in[i], with an associative op
+    and its identity. out may be in. Deterministic like GeParallelReduce,
+    though the grouping differs from a serial scan. The chunk sums are kept
+    in pArena, or on the heap without one.
+*/
+template <typename T, typename Op>
+void GeParallelInclusiveScan(const T* in, T* out, GeSize count, T identity, Op op, GeSize grainSize = 1 << 16,
+                             GeArena* pArena = nullptr)
+{
+    ge::details::parallel::Scan(in, out, count, identity, op, grainSize, true, pArena);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Exclusive scan, out[0] = identity and out[i] = in[0] op ... op in[i - 1].
+*/
+template <typename T, typename Op>
+void GeParallelExclusiveScan(const T* in, T* out, GeSize count, T identity, Op op, GeSize grainSize = 1 << 16,
+                             GeArena* pArena = nullptr)
+{
+    ge::details::parallel::Scan(in, out, count, identity, op, grainSize, false, pArena);
+}
+
+namespace ge
+{
+namespace details
+{
+    template <typename RandomIt, typename Compare>
+    void ParallelSort(RandomIt first, RandomIt last, Compare& comp, GeSize grainSize, GeSize depth)
+    {
+        const GeSize count = static_cast<GeSize>(std::distance(first, last));
+        if (count <= grainSize || depth == 0)
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        const RandomIt middle = first + count / 2;
+        GeParallelInvoke([&]() { ParallelSort(first, middle, comp, grainSize, depth - 1); },
+                         [&]() { ParallelSort(middle, last, comp, grainSize, depth - 1); });
+        std::inplace_merge(first, middle, last, comp);
+    }
+} // end of details
+} // end of ge
+
+//------------------------------------------------------------------------------
+/**
+    Sorts [first, last) with a parallel merge sort: one half per task down
+    to about GeGetConcurrency() pieces of at least grainSize elements,
+    merged in place. Not stable.
+*/
+template <typename RandomIt, typename Compare>
+void GeParallelSort(RandomIt first, RandomIt last, Compare comp, GeSize grainSize = 1 << 16)
+{
+    GeSize depth = 0;
+    for (GeSize pieces = 1; pieces < GeGetConcurrency(); pieces *= 2)
+        ++depth;
+    ge::details::ParallelSort(first, last, comp, grainSize, depth);
+}
+
+namespace ge
+{
+    using scheduler = GeScheduler;
+    using scheduler_scope = GeSchedulerScope;
+
+    inline size_t concurrency()
+    {
+        return GeGetConcurrency();
+    }
+
+    inline size_t hardware_concurrency()
+    {
+        return GeGetHardwareConcurrency();
+    }
+
+    template <typename F1, typename F2>
+    inline void parallel_invoke(F1&& f1, F2&& f2)
+    {
+        GeParallelInvoke(std::forward<F1>(f1), std::forward<F2>(f2));
+    }
+
+    template <typename F>
+    inline void parallel_for(size_t begin, size_t end, size_t grainSize, F&& f)
+    {
+        GeParallelFor(begin, end, grainSize, std::forward<F>(f));
+    }
+
+    template <typename T, typename Map, typename Combine>
+    inline T parallel_reduce(size_t begin, size_t end, size_t grainSize, T identity, Map&& map, Combine&& combine,
+                             GeArena* pArena = nullptr)
+    {
+        return GeParallelReduce(begin, end, grainSize, identity, std::forward<Map>(map), std::forward<Combine>(combine),
+                                pArena);
+    }
+
+    template <typename T, typename Op>
+    inline void parallel_inclusive_scan(const T* in, T* out, size_t count, T identity, Op op,
+                                        size_t grainSize = 1 << 16, GeArena* pArena = nullptr)
+    {
+        GeParallelInclusiveScan(in, out, count, identity, op, grainSize, pArena);
+    }
+
+    template <typename T, typename Op>
+    inline void parallel_exclusive_scan(const T* in, T* out, size_t count, T identity, Op op,
+                                        size_t grainSize = 1 << 16, GeArena* pArena = nullptr)
+    {
+        GeParallelExclusiveScan(in, out, count, identity, op, grainSize, pArena);
+    }
+
+    template <typename RandomIt, typename Compare>
+    inline void parallel_sort(RandomIt first, RandomIt last, Compare comp)
+    {
+        GeParallelSort(first, last, comp);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_PARALLEL_H
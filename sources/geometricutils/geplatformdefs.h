@@ -29,13 +29,86 @@ SOFTWARE.
 #define GE_GCC_COMPILER
 #endif
 
-#ifdef GE_GCC_COMPILER
+// Byte order. BYTE_ORDER comes from <endian.h>, which is not always
+// included, so the compiler's own __BYTE_ORDER__ is preferred.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)
+#   if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#       define GE_LITTLE_ENDIAN
+#   elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#       define GE_BIG_ENDIAN
+#   endif
+#elif defined(GE_GCC_COMPILER)
 #   if BYTE_ORDER == LITTLE_ENDIAN
 #       define GE_LITTLE_ENDIAN
 #   elif BYTE_ORDER == BIG_ENDIAN
 #       define GE_BIG_ENDIAN
 #   endif
+#elif defined(_MSC_VER)
+#   define GE_LITTLE_ENDIAN
 #endif
 
+// SIMD instruction sets enabled at compile time
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#   define GE_ARCH_X86
+#endif
+
+#ifdef GE_ARCH_X86
+#   if defined(__SSE2__) || defined(_M_X64)
+#       define GE_SIMD_SSE2
+#   endif
+#   ifdef __AVX2__
+#       define GE_SIMD_AVX2
+#   endif
+#   ifdef __AVX512F__
+#       define GE_SIMD_AVX512
+#   endif
+#endif
+
+// Hardware fused multiply-add enabled at compile time
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA) || (defined(_MSC_VER) && defined(__AVX2__))
+#   define GE_HAS_FMA
+#endif
+
+#define GE_SIMD_ALIGNMENT 64
+
+// Bit casts usable in constant expressions: std::bit_cast (C++20) or the
+// compiler builtin; otherwise GeBitCast falls back to memcpy and is not
+// constexpr.
+#if __cplusplus >= 202002L && defined(__has_include)
+#   if __has_include(<bit>)
+#       define GE_HAS_STD_BIT_CAST
+#   endif
+#endif
+
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_bit_cast)
+#       define GE_HAS_BUILTIN_BIT_CAST
+#   endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1927
+#   define GE_HAS_BUILTIN_BIT_CAST
+#endif
+
+#if defined(GE_HAS_STD_BIT_CAST) || defined(GE_HAS_BUILTIN_BIT_CAST)
+#   define GE_BIT_CAST_CONSTEXPR constexpr
+#else
+#   define GE_BIT_CAST_CONSTEXPR inline
+#endif
+
+// Whether a constexpr function is being constant-evaluated, for side paths
+// that may only run at run time (instrumentation)
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_is_constant_evaluated)
+#       define GE_HAS_IS_CONSTANT_EVALUATED
+#   endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+// GCC 9 has the builtin but not __has_builtin, which arrived in GCC 10
+#   define GE_HAS_IS_CONSTANT_EVALUATED
+#elif defined(_MSC_VER) && _MSC_VER >= 1928
+#   define GE_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+#ifdef GE_HAS_IS_CONSTANT_EVALUATED
+#   define GE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
 
 #endif // GEOMUTILS_PLATFORMDEFS_H
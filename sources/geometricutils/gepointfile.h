@@ -0,0 +1,207 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_POINTFILE_H
+#define GEOMUTILS_POINTFILE_H
+
+#include "gevector3array.h"
+#include "gebaseutl.h"
+#include "gespan.h"
+
+#include <vector>
+
+//==============================================================================
+// Binary point-cloud files
+//
+// Layout (version 1), all fields in the byte order recorded in the header:
+//
+//   offset  size  field
+//        0     8  magic "GEPOINTS"
+//        8     4  byte-order mark 0x01020304
+//       12     2  version
+//       14     1  payload layout (GePointLayout)
+//       15     1  scalar size in bytes (4 or 8)
+//       16     8  point count
+//       24     8  payload offset
+//       32     8  lane stride: bytes from the start of one SoA lane to the
+//                 next, 0 for AoS
+//       40    24  reserved, zero
+//
+// The payload starts at a multiple of GE_SIMD_ALIGNMENT. AoS payloads hold
+// x, y, z per point; SoA payloads hold the x, y and z lanes one after the
+// other, each padded to GE_SIMD_ALIGNMENT bytes.
+
+enum class GePointLayout : GeUint8
+{
+    kAos = 0,
+    kSoa = 1
+};
+
+enum class GeByteOrder : GeUint8
+{
+    kLittle = 0,
+    kBig = 1
+};
+
+//------------------------------------------------------------------------------
+/**
+    Byte order of this machine.
+*/
+inline GeByteOrder GeNativeByteOrder()
+{
+#if defined(GE_LITTLE_ENDIAN)
+    return GeByteOrder::kLittle;
+#elif defined(GE_BIG_ENDIAN)
+    return GeByteOrder::kBig;
+#else
+    return GeIsLittleEndian() ? GeByteOrder::kLittle : GeByteOrder::kBig;
+#endif
+}
+
+//------------------------------------------------------------------------------
+/**
+    Writes points to path. order other than the native one is mainly for
+    producing files for other machines (and testing the swapping path).
+
+    @return false if the file cannot be written
+*/
+template <typename T>
+bool GeWritePointFile(const char* path, GeVector3ArrayCView<T> points,
+                      GePointLayout layout = GePointLayout::kSoa,
+                      GeByteOrder order = GeNativeByteOrder());
+
+template <typename T>
+bool GeWritePointFile(const char* path, GeSpan<const GeVector3<T>> points,
+                      GePointLayout layout = GePointLayout::kAos,
+                      GeByteOrder order = GeNativeByteOrder());
+
+extern template bool GeWritePointFile<GeReal32>(const char*, GeVector3ArrayCView<GeReal32>, GePointLayout, GeByteOrder);
+extern template bool GeWritePointFile<GeReal64>(const char*, GeVector3ArrayCView<GeReal64>, GePointLayout, GeByteOrder);
+extern template bool GeWritePointFile<GeReal32>(const char*, GeSpan<const GeVector3<GeReal32>>, GePointLayout, GeByteOrder);
+extern template bool GeWritePointFile<GeReal64>(const char*, GeSpan<const GeVector3<GeReal64>>, GePointLayout, GeByteOrder);
+
+//------------------------------------------------------------------------------
+/**
+    Read-only memory mapping of a point file.
+
+    When the file is in native byte order its payload is used in place: the
+    View() overloads matching the file's layout and scalar type return
+    pointers straight into the mapping, without reading or copying. Read()
+    copies into caller-owned storage in either layout, reversing the byte
+    order with the SIMD kernels when the file comes from a machine of the
+    other endianness.
+*/
+class GePointFile
+{
+public:
+    GePointFile() = default;
+    ~GePointFile();
+
+    GePointFile(GePointFile&& other) noexcept;
+    GePointFile& operator=(GePointFile&& other) noexcept;
+    GePointFile(const GePointFile&) = delete;
+    GePointFile& operator=(const GePointFile&) = delete;
+
+    //--------------------------------------------------------------------------
+    /**
+        Maps path and validates its header. Any previously open file is
+        closed first.
+
+        @return false if the file cannot be mapped or is not a valid point
+        file
+    */
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const { return m_pData != nullptr; }
+    GeSize Size() const { return m_count; }
+    GeUint16 Version() const { return m_version; }
+    GePointLayout Layout() const { return m_layout; }
+    GeByteOrder ByteOrder() const { return m_order; }
+    GeSize ScalarSize() const { return m_scalarSize; }
+
+    // True when the payload can be used in place
+    bool IsNative() const { return IsOpen() && m_order == GeNativeByteOrder(); }
+
+    //--------------------------------------------------------------------------
+    /**
+        Zero-copy views, valid until Close(). Succeed only for a native file
+        of the matching layout and scalar type.
+    */
+    bool View(GeVector3ArrayCView<GeReal32>& out) const;
+    bool View(GeVector3ArrayCView<GeReal64>& out) const;
+    bool View(GeSpan<const GeVector3<GeReal32>>& out) const;
+    bool View(GeSpan<const GeVector3<GeReal64>>& out) const;
+
+    //--------------------------------------------------------------------------
+    /**
+        Copies the points, converting layout and byte order as needed. The
+        scalar type must match the file's.
+    */
+    bool Read(GeVector3Array<GeReal32>& out) const;
+    bool Read(GeVector3Array<GeReal64>& out) const;
+    bool Read(std::vector<GeVector3<GeReal32>>& out) const;
+    bool Read(std::vector<GeVector3<GeReal64>>& out) const;
+
+private:
+    template <typename T>
+    bool ViewLanes(GeVector3ArrayCView<T>& out) const;
+
+    template <typename T>
+    bool ViewPoints(GeSpan<const GeVector3<T>>& out) const;
+
+    template <typename T>
+    bool ReadLanes(GeVector3Array<T>& out) const;
+
+    template <typename T>
+    bool ReadPoints(std::vector<GeVector3<T>>& out) const;
+
+    template <typename T>
+    const T* Lane(int axis) const;
+
+    const GeByte* m_pData = nullptr;    // start of the mapping
+    GeSize m_mappedSize = 0;
+    GeSize m_count = 0;
+    GeSize m_payloadOffset = 0;
+    GeSize m_laneStride = 0;
+    GeUint16 m_version = 0;
+    GePointLayout m_layout = GePointLayout::kAos;
+    GeByteOrder m_order = GeByteOrder::kLittle;
+    GeUint8 m_scalarSize = 0;
+};
+
+namespace ge
+{
+    using point_layout = GePointLayout;
+    using byte_order = GeByteOrder;
+    using point_file = GePointFile;
+
+    template <typename T, typename Allocator>
+    inline bool write_point_file(const char* path, const GeVector3Array<T, Allocator>& points,
+                                 GePointLayout layout = GePointLayout::kSoa)
+    {
+        return GeWritePointFile<T>(path, points.cview(), layout);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_POINTFILE_H
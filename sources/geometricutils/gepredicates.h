@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_PREDICATES_H
+#define GEOMUTILS_PREDICATES_H
+
+#include "gevector3.h"
+
+//==============================================================================
+// Robust geometric predicates
+//
+// Each predicate returns the sign (-1, 0 or +1) of a determinant, and that
+// sign is always exact for finite inputs whose products neither overflow
+// nor underflow. The determinant is first evaluated in double together with
+// a bound on its rounding error; only when the bound does not separate it
+// from zero is it recomputed with exact floating-point expansion arithmetic
+// (Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust
+// Geometric Predicates", 1997). GeReal32 inputs are widened to double.
+//
+// The orientation conventions are the ones of the paper.
+//
+// With GE_ENABLE_STATS the calls of each predicate and those that needed
+// the exact fallback are counted in gestats.h (GeStatCounter::kOrient2d,
+// kOrient2dExact and so on).
+
+//------------------------------------------------------------------------------
+/**
+    Orientation of c relative to the directed line a -> b in the xy plane;
+    z is ignored.
+
+    @return +1 if a, b, c are counterclockwise, -1 if clockwise, 0 if
+    collinear
+*/
+template <typename T>
+GeInt32 GeOrient2d(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c);
+
+template <>
+GeInt32 GeOrient2d<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b, const GeVector3<GeReal32>& c);
+
+template <>
+GeInt32 GeOrient2d<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b, const GeVector3<GeReal64>& c);
+
+//------------------------------------------------------------------------------
+/**
+    Orientation of d relative to the plane through a, b, c.
+
+    @return +1 if d lies below the plane, "below" meaning the side from
+    which a, b, c appear clockwise; -1 if above, 0 if coplanar
+*/
+template <typename T>
+GeInt32 GeOrient3d(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c, const GeVector3<T>& d);
+
+template <>
+GeInt32 GeOrient3d<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b,
+                             const GeVector3<GeReal32>& c, const GeVector3<GeReal32>& d);
+
+template <>
+GeInt32 GeOrient3d<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b,
+                             const GeVector3<GeReal64>& c, const GeVector3<GeReal64>& d);
+
+//------------------------------------------------------------------------------
+/**
+    Position of d relative to the circle through a, b, c in the xy plane; z
+    is ignored.
+
+    @return +1 if d is inside the circle, -1 if outside, 0 if on it, when
+    a, b, c are counterclockwise; the sign flips when they are clockwise
+*/
+template <typename T>
+GeInt32 GeInCircle(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c, const GeVector3<T>& d);
+
+template <>
+GeInt32 GeInCircle<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b,
+                             const GeVector3<GeReal32>& c, const GeVector3<GeReal32>& d);
+
+template <>
+GeInt32 GeInCircle<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b,
+                             const GeVector3<GeReal64>& c, const GeVector3<GeReal64>& d);
+
+//------------------------------------------------------------------------------
+/**
+    Position of e relative to the sphere through a, b, c, d.
+
+    @return +1 if e is inside the sphere, -1 if outside, 0 if on it, when
+    GeOrient3d(a, b, c, d) is positive; the sign flips when it is negative
+*/
+template <typename T>
+GeInt32 GeInSphere(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c,
+                   const GeVector3<T>& d, const GeVector3<T>& e);
+
+template <>
+GeInt32 GeInSphere<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b, const GeVector3<GeReal32>& c,
+                             const GeVector3<GeReal32>& d, const GeVector3<GeReal32>& e);
+
+template <>
+GeInt32 GeInSphere<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b, const GeVector3<GeReal64>& c,
+                             const GeVector3<GeReal64>& d, const GeVector3<GeReal64>& e);
+
+namespace ge
+{
+    template <typename T>
+    inline int orient2d(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c)
+    {
+        return GeOrient2d(a, b, c);
+    }
+
+    template <typename T>
+    inline int orient3d(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c, const GeVector3<T>& d)
+    {
+        return GeOrient3d(a, b, c, d);
+    }
+
+    template <typename T>
+    inline int incircle(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c, const GeVector3<T>& d)
+    {
+        return GeInCircle(a, b, c, d);
+    }
+
+    template <typename T>
+    inline int insphere(const GeVector3<T>& a, const GeVector3<T>& b, const GeVector3<T>& c,
+                        const GeVector3<T>& d, const GeVector3<T>& e)
+    {
+        return GeInSphere(a, b, c, d, e);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_PREDICATES_H
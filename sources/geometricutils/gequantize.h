@@ -0,0 +1,176 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_QUANTIZE_H
+#define GEOMUTILS_QUANTIZE_H
+
+#include "geaabb.h"
+#include "gevector3array.h"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+//------------------------------------------------------------------------------
+/**
+    Regular grid mapping real coordinates to integer ones:
+    q = round((p - origin) / step) per axis, p = origin + q * step.
+*/
+template <typename T>
+struct GeQuantizeGrid
+{
+    GeVector3<T> origin;
+    GeVector3<T> step{T(1), T(1), T(1)};
+
+    // Multipliers used by the quantizing direction; the batch functions
+    // multiply by these instead of dividing by step
+    GeVector3<T> Scale() const
+    {
+        return GeVector3<T>(T(1) / step.x, T(1) / step.y, T(1) / step.z);
+    }
+
+    /**
+        Grid centered on box whose cells spread its extent over the whole
+        range of I, i.e. the finest grid that holds box without saturating.
+        A flat axis gets a unit step; an empty box gives the identity grid.
+    */
+    template <typename I>
+    static GeQuantizeGrid Fit(const GeAabb3<T>& box)
+    {
+        GeQuantizeGrid grid;
+        if (box.IsEmpty())
+            return grid;
+        const T cells = static_cast<T>(std::numeric_limits<I>::max());
+        const GeVector3<T> e = box.Extent();
+        auto stepFor = [cells](T extent) { return extent > T(0) ? extent / 2 / cells : T(1); };
+        grid.origin = box.Center();
+        grid.step = GeVector3<T>(stepFor(e.x), stepFor(e.y), stepFor(e.z));
+        return grid;
+    }
+};
+
+namespace ge
+{
+namespace details
+{
+    // Rounds r (already scaled) to nearest even and saturates it to I;
+    // NaN maps to 0. Same rule as the batch kernels.
+    template <typename I, typename T>
+    I QuantizeScaled(T r)
+    {
+        if (!(r == r))
+            return I(0);
+        const T rounded = std::nearbyint(r);
+        const T limit = std::ldexp(T(1), std::numeric_limits<I>::digits);
+        if (rounded >= limit)
+            return std::numeric_limits<I>::max();
+        if (rounded <= -limit)
+            return std::numeric_limits<I>::min();
+        return static_cast<I>(rounded);
+    }
+} // end of details
+} // eof ge
+
+//==============================================================================
+// Batch conversion; the GeReal32/GeReal64 x GeInt32/GeInt16 combinations
+// run on the dispatched SIMD kernels
+
+//------------------------------------------------------------------------------
+/**
+    Quantizes in onto grid. Values out of the range of I saturate, NaN
+    becomes 0 and ties round to even.
+*/
+template <typename T, typename I>
+void GeVector3BatchQuantize(GeVector3ArrayCView<T> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<I> out)
+{
+    assert(in.size == out.size);
+    const GeVector3<T> scale = grid.Scale();
+    for (GeSize i = 0; i < in.size; ++i)
+    {
+        out.x[i] = ge::details::QuantizeScaled<I>((in.x[i] - grid.origin.x) * scale.x);
+        out.y[i] = ge::details::QuantizeScaled<I>((in.y[i] - grid.origin.y) * scale.y);
+        out.z[i] = ge::details::QuantizeScaled<I>((in.z[i] - grid.origin.z) * scale.z);
+    }
+}
+
+template <>
+void GeVector3BatchQuantize<GeReal32, GeInt32>(GeVector3ArrayCView<GeReal32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeInt32> out);
+
+template <>
+void GeVector3BatchQuantize<GeReal32, GeInt16>(GeVector3ArrayCView<GeReal32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeInt16> out);
+
+template <>
+void GeVector3BatchQuantize<GeReal64, GeInt32>(GeVector3ArrayCView<GeReal64> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeInt32> out);
+
+template <>
+void GeVector3BatchQuantize<GeReal64, GeInt16>(GeVector3ArrayCView<GeReal64> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeInt16> out);
+
+//------------------------------------------------------------------------------
+/**
+    Maps grid coordinates back to real ones: origin + q * step.
+*/
+template <typename T, typename I>
+void GeVector3BatchDequantize(GeVector3ArrayCView<I> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<T> out)
+{
+    assert(in.size == out.size);
+    for (GeSize i = 0; i < in.size; ++i)
+    {
+        out.x[i] = grid.origin.x + static_cast<T>(in.x[i]) * grid.step.x;
+        out.y[i] = grid.origin.y + static_cast<T>(in.y[i]) * grid.step.y;
+        out.z[i] = grid.origin.z + static_cast<T>(in.z[i]) * grid.step.z;
+    }
+}
+
+template <>
+void GeVector3BatchDequantize<GeReal32, GeInt32>(GeVector3ArrayCView<GeInt32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeReal32> out);
+
+template <>
+void GeVector3BatchDequantize<GeReal32, GeInt16>(GeVector3ArrayCView<GeInt16> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeReal32> out);
+
+template <>
+void GeVector3BatchDequantize<GeReal64, GeInt32>(GeVector3ArrayCView<GeInt32> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeReal64> out);
+
+template <>
+void GeVector3BatchDequantize<GeReal64, GeInt16>(GeVector3ArrayCView<GeInt16> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeReal64> out);
+
+namespace ge
+{
+    template <typename T>
+    using quantize_grid = GeQuantizeGrid<T>;
+
+    template <typename T, typename I, typename InAllocator, typename OutAllocator>
+    inline void batch_quantize(const GeVector3Array<T, InAllocator>& in, const GeQuantizeGrid<T>& grid, GeVector3Array<I, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchQuantize<T, I>(in.cview(), grid, out.view());
+    }
+
+    template <typename T, typename I, typename InAllocator, typename OutAllocator>
+    inline void batch_dequantize(const GeVector3Array<I, InAllocator>& in, const GeQuantizeGrid<T>& grid, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchDequantize<T, I>(in.cview(), grid, out.view());
+    }
+} // eof ge
+
+#endif // GEOMUTILS_QUANTIZE_H
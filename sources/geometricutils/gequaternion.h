@@ -0,0 +1,216 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_QUATERNION_H
+#define GEOMUTILS_QUATERNION_H
+
+#include "gematrix3.h"
+
+#include <cmath>
+#include <iostream>
+
+//------------------------------------------------------------------------------
+/**
+    Quaternion x i + y j + z k + w. Rotations use unit quaternions; the
+    product a * b rotates by b first, then by a. Default-constructed as the
+    identity rotation.
+*/
+template <typename T>
+class GeQuaternion
+{
+public:
+    T x, y, z, w;
+
+    // Constructors
+    GeQuaternion()
+        : x(T(0))
+        , y(T(0))
+        , z(T(0))
+        , w(T(1))
+        {}
+
+    GeQuaternion(T x, T y, T z, T w)
+        : x{x}
+        , y{y}
+        , z{z}
+        , w{w}
+        {}
+
+    static GeQuaternion Identity() {
+        return GeQuaternion();
+    }
+
+    // Rotation by angle radians about the unit vector axis (right-handed)
+    static GeQuaternion FromAxisAngle(const GeVector3<T>& axis, T angle) {
+        const T s = std::sin(angle / 2);
+        return GeQuaternion(axis.x * s, axis.y * s, axis.z * s, std::cos(angle / 2));
+    }
+
+    // Rotation matrix to unit quaternion (Shepperd's method: divides by the
+    // largest of the four candidate magnitudes)
+    static GeQuaternion FromMatrix(const GeMatrix3<T>& r) {
+        const auto& m = r.m;
+        const T trace = m[0][0] + m[1][1] + m[2][2];
+        if (trace > T(0)) {
+            const T s = std::sqrt(trace + T(1)) * 2;
+            return GeQuaternion((m[2][1] - m[1][2]) / s, (m[0][2] - m[2][0]) / s, (m[1][0] - m[0][1]) / s, s / 4);
+        } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+            const T s = std::sqrt(T(1) + m[0][0] - m[1][1] - m[2][2]) * 2;
+            return GeQuaternion(s / 4, (m[0][1] + m[1][0]) / s, (m[0][2] + m[2][0]) / s, (m[2][1] - m[1][2]) / s);
+        } else if (m[1][1] > m[2][2]) {
+            const T s = std::sqrt(T(1) + m[1][1] - m[0][0] - m[2][2]) * 2;
+            return GeQuaternion((m[0][1] + m[1][0]) / s, s / 4, (m[1][2] + m[2][1]) / s, (m[0][2] - m[2][0]) / s);
+        } else {
+            const T s = std::sqrt(T(1) + m[2][2] - m[0][0] - m[1][1]) * 2;
+            return GeQuaternion((m[0][2] + m[2][0]) / s, (m[1][2] + m[2][1]) / s, s / 4, (m[1][0] - m[0][1]) / s);
+        }
+    }
+
+    // Quaternion operations
+    GeQuaternion operator+(const GeQuaternion& other) const {
+        return GeQuaternion(x + other.x, y + other.y, z + other.z, w + other.w);
+    }
+
+    GeQuaternion operator-(const GeQuaternion& other) const {
+        return GeQuaternion(x - other.x, y - other.y, z - other.z, w - other.w);
+    }
+
+    GeQuaternion operator*(T scalar) const {
+        return GeQuaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+    }
+
+    // Hamilton product
+    GeQuaternion operator*(const GeQuaternion& o) const {
+        return GeQuaternion(w * o.x + x * o.w + y * o.z - z * o.y,
+                            w * o.y - x * o.z + y * o.w + z * o.x,
+                            w * o.z + x * o.y - y * o.x + z * o.w,
+                            w * o.w - x * o.x - y * o.y - z * o.z);
+    }
+
+    bool operator==(const GeQuaternion& other) const {
+        return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+
+    bool operator!=(const GeQuaternion& other) const {
+        return !(*this == other);
+    }
+
+    T dot(const GeQuaternion& other) const {
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+
+    T magnitude_square() const {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    T magnitude() const {
+        return GeSqrt(magnitude_square());
+    }
+
+    // Zero stays zero
+    GeQuaternion normalize() const {
+        const T mag = magnitude();
+        if (mag != T(0)) {
+            return GeQuaternion(x / mag, y / mag, z / mag, w / mag);
+        } else {
+            return GeQuaternion(T(0), T(0), T(0), T(0));
+        }
+    }
+
+    GeQuaternion conjugate() const {
+        return GeQuaternion(-x, -y, -z, w);
+    }
+
+    // Zero stays zero; for unit quaternions this is the conjugate
+    GeQuaternion inverse() const {
+        const T sq = magnitude_square();
+        if (sq != T(0)) {
+            return GeQuaternion(-x / sq, -y / sq, -z / sq, w / sq);
+        } else {
+            return GeQuaternion(T(0), T(0), T(0), T(0));
+        }
+    }
+
+    // Rotates v by this unit quaternion: v + 2w (q x v) + 2 q x (q x v)
+    GeVector3<T> rotate(const GeVector3<T>& v) const {
+        const GeVector3<T> q(x, y, z);
+        const GeVector3<T> t = q.cross(v);
+        const GeVector3<T> t2(t.x * 2, t.y * 2, t.z * 2);
+        const GeVector3<T> u = q.cross(t2);
+        return GeVector3<T>(v.x + w * t2.x + u.x, v.y + w * t2.y + u.y, v.z + w * t2.z + u.z);
+    }
+
+    // Rotation matrix of this unit quaternion
+    GeMatrix3<T> to_matrix() const {
+        const T xx = x * x, yy = y * y, zz = z * z;
+        const T xy = x * y, xz = x * z, yz = y * z;
+        const T wx = w * x, wy = w * y, wz = w * z;
+        return GeMatrix3<T>(T(1) - 2 * (yy + zz), 2 * (xy - wz),         2 * (xz + wy),
+                            2 * (xy + wz),         T(1) - 2 * (xx + zz), 2 * (yz - wx),
+                            2 * (xz - wy),         2 * (yz + wx),         T(1) - 2 * (xx + yy));
+    }
+
+    // Display quaternion
+    void print() const {
+        std::cout << "(" << x << ", " << y << ", " << z << ", " << w << ")" << std::endl;
+    }
+};
+
+//------------------------------------------------------------------------------
+/**
+    Spherical linear interpolation between unit quaternions a (t = 0) and b
+    (t = 1) along the shorter arc. Nearly parallel inputs fall back to a
+    normalized linear interpolation.
+*/
+template <typename T>
+GeQuaternion<T> GeSlerp(const GeQuaternion<T>& a, const GeQuaternion<T>& b, T t)
+{
+    GeQuaternion<T> end = b;
+    T cosAngle = a.dot(b);
+    if (cosAngle < T(0)) {
+        end = b * T(-1);
+        cosAngle = -cosAngle;
+    }
+
+    if (cosAngle > T(0.9995)) {
+        return (a + (end - a) * t).normalize();
+    }
+
+    const T angle = std::acos(cosAngle);
+    const T invSin = T(1) / std::sin(angle);
+    return a * (std::sin((T(1) - t) * angle) * invSin) + end * (std::sin(t * angle) * invSin);
+}
+
+namespace ge
+{
+    template <typename T>
+    using quaternion = GeQuaternion<T>;
+
+    template <typename T>
+    inline GeQuaternion<T> slerp(const GeQuaternion<T>& a, const GeQuaternion<T>& b, T t)
+    {
+        return GeSlerp(a, b, t);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_QUATERNION_H
@@ -25,6 +25,9 @@ SOFTWARE.
 #define GEOMUTILS_REALUTL_H
 
 #include "gebasedefs.h"
+#include "gespan.h"
+#include "gestats.h"
+#include "impl/gerealcompare.h"
 #include <limits>
 #include <cmath>
 
@@ -58,28 +61,57 @@ public:
 //==============================================================================
 // Real absolute and sign
 
-template <typename T>
+// Both are constexpr when GE_BIT_CAST_CONSTEXPR is (GE_FLOAT_ABS_STD_IMPL
+// makes GeRealAbs a plain std::fabs call).
+
+template <typename T>
 inline T GeRealAbs(T x);
 
-template <>
-inline GeReal32 GeRealAbs<GeReal32>(GeReal32 x);
+#ifdef GE_FLOAT_ABS_STD_IMPL
+template <>
+inline GeReal32 GeRealAbs<GeReal32>(GeReal32 x)
+{
+    return std::fabs(x);
+}
+
+template <>
+inline GeReal64 GeRealAbs<GeReal64>(GeReal64 x)
+{
+    return std::fabs(x);
+}
+#else
+template <>
+GE_BIT_CAST_CONSTEXPR GeReal32 GeRealAbs<GeReal32>(GeReal32 x)
+{
+    return ge::details::RealBits<GeReal32>::Abs(x);
+}
 
-template <>
-inline GeReal64 GeRealAbs<GeReal64>(GeReal64 x);
+template <>
+GE_BIT_CAST_CONSTEXPR GeReal64 GeRealAbs<GeReal64>(GeReal64 x)
+{
+    return ge::details::RealBits<GeReal64>::Abs(x);
+}
+#endif
 
 template <typename T>
 inline bool GeIsRealNegative(T x);
 
 template <>
-inline bool GeIsRealNegative<GeReal32>(GeReal32 x);
+GE_BIT_CAST_CONSTEXPR bool GeIsRealNegative<GeReal32>(GeReal32 x)
+{
+    return ge::details::RealBits<GeReal32>::Get(x) < 0;
+}
 
 template <>
-inline bool GeIsRealNegative<GeReal64>(GeReal64 x);
+GE_BIT_CAST_CONSTEXPR bool GeIsRealNegative<GeReal64>(GeReal64 x)
+{
+    return ge::details::RealBits<GeReal64>::Get(x) < 0;
+}
 
 namespace ge
 {
-    template <typename T>
-    inline T RealAbs(T x)
+    template <typename T>
+    GE_BIT_CAST_CONSTEXPR T RealAbs(T x)
     {
         return GeRealAbs(x);
     }
@@ -92,52 +124,354 @@ namespace ge
 //------------------------------------------------------------------------------
 /**
 */
-bool GeIsRealEqualByUlps(GeReal32 a, GeReal32 b, GeInt32 tolInUlps);
+GE_BIT_CAST_CONSTEXPR bool GeIsRealEqualByUlps(GeReal32 a, GeReal32 b, GeInt32 tolInUlps)
+{
+    return ge::details::RealEqualByUlps(a, b, tolInUlps);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Double version; the ULP distance is computed in 64 bits.
+*/
+GE_BIT_CAST_CONSTEXPR bool GeIsRealEqualByUlps(GeReal64 a, GeReal64 b, GeInt32 tolInUlps)
+{
+    return ge::details::RealEqualByUlps(a, b, tolInUlps);
+}
+
+//------------------------------------------------------------------------------
+/**
+*/
+GE_BIT_CAST_CONSTEXPR bool GeIsRealLessByUlps(GeReal32 a, GeReal32 b, GeInt32 tolInUlps)
+{
+    return ge::details::RealLessByUlps(a, b, tolInUlps);
+}
+
+GE_BIT_CAST_CONSTEXPR bool GeIsRealLessByUlps(GeReal64 a, GeReal64 b, GeInt32 tolInUlps)
+{
+    return ge::details::RealLessByUlps(a, b, tolInUlps);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Batch forms: out[i] receives the scalar result for (a[i], b[i]).
+    All spans hold a.size() elements.
+*/
+void GeIsRealEqualByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<bool> out);
+
+void GeIsRealLessByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<bool> out);
+
+//------------------------------------------------------------------------------
+/**
+    Bitmask batch forms: the result for element i is bit (i % 64) of
+    outMask[i / 64]; outMask holds (a.size() + 63) / 64 words.
+*/
+void GeIsRealEqualByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<GeUint64> outMask);
+
+void GeIsRealLessByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<GeUint64> outMask);
 
 //------------------------------------------------------------------------------
 /**
     @param tol tolerance
     @return Returns true if reals are equal
 */
-template <typename T>
-bool GeRealEqual(T a, T b, T tol)
+template <typename T>
+constexpr bool GeRealEqual(T a, T b, T tol)
 {
     T absOfA = GeRealAbs(a);
     T absOfB = GeRealAbs(b);
     return GeRealAbs(a - b) <= (tol * (absOfA < absOfB ? absOfB : absOfA));
 }
 
-template <>
-bool GeRealEqual<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol);
+template <>
+GE_BIT_CAST_CONSTEXPR bool GeRealEqual<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol)
+{
+    const ge::details::RealCompareFused<GeReal32> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealEqual, cmp);
+    return cmp.Equal();
+}
 
-template <>
-bool GeRealEqual<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol);
+template <>
+GE_BIT_CAST_CONSTEXPR bool GeRealEqual<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol)
+{
+    const ge::details::RealCompareFused<GeReal64> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealEqual, cmp);
+    return cmp.Equal();
+}
 
 
 //------------------------------------------------------------------------------
 /**
 */
-template <typename T>
-bool GeRealLess(T a, T b, T tol)
+template <typename T>
+constexpr bool GeRealLess(T a, T b, T tol)
 {
     return (b - a) > ( (GeRealAbs(a) < GeRealAbs(b) ? GeRealAbs(b) : GeRealAbs(a)) * tol);
 }
 
-template <>
-bool GeRealLess<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol);
+template <>
+GE_BIT_CAST_CONSTEXPR bool GeRealLess<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol)
+{
+    const ge::details::RealCompareFused<GeReal32> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealLess, cmp);
+    return cmp.Less();
+}
 
 template <>
-bool GeRealLess<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol);
+GE_BIT_CAST_CONSTEXPR bool GeRealLess<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol)
+{
+    const ge::details::RealCompareFused<GeReal64> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealLess, cmp);
+    return cmp.Less();
+}
+
 
+//------------------------------------------------------------------------------
+/**
+    Result of a tolerant three-way comparison. kUnordered is returned when
+    neither relation holds (NaN operands).
+*/
+enum class GeRealOrder : GeInt32
+{
+    kLess = -1,
+    kEqual = 0,
+    kGreater = 1,
+    kUnordered = 2
+};
 
 //------------------------------------------------------------------------------
 /**
+    Equal/less/greater in one evaluation; agrees with GeRealEqual, GeRealLess
+    and GeRealGreater for the same arguments.
 */
-template <typename T>
-inline bool GeRealGreater(T a, T b, T tol)
+template <typename T>
+constexpr GeRealOrder GeRealCompare(T a, T b, T tol)
+{
+    if (GeRealEqual(a, b, tol))
+        return GeRealOrder::kEqual;
+    if (GeRealLess(a, b, tol))
+        return GeRealOrder::kLess;
+    if (GeRealLess(b, a, tol))
+        return GeRealOrder::kGreater;
+    return GeRealOrder::kUnordered;
+}
+
+template <>
+GE_BIT_CAST_CONSTEXPR GeRealOrder GeRealCompare<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol)
+{
+    const ge::details::RealCompareFused<GeReal32> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealCompare, cmp);
+    return static_cast<GeRealOrder>(cmp.Compare());
+}
+
+template <>
+GE_BIT_CAST_CONSTEXPR GeRealOrder GeRealCompare<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol)
+{
+    const ge::details::RealCompareFused<GeReal64> cmp(a, b, tol);
+    GE_STATS_REAL_COMPARE(GeStatCounter::kRealCompare, cmp);
+    return static_cast<GeRealOrder>(cmp.Compare());
+}
+
+//------------------------------------------------------------------------------
+/**
+*/
+template <typename T>
+constexpr bool GeRealGreater(T a, T b, T tol)
 {
     return GeRealLess(b, a, tol);
 }
 
 
+//==============================================================================
+// Comparison against a fixed value
+
+//------------------------------------------------------------------------------
+/**
+    Tolerant comparisons of many values against one fixed value, as in
+    binary searches and filter scans. The bits, magnitude and threshold flag
+    of the fixed value, tol * |value| and its threshold flag are computed
+    once, in the constructor; every call then answers exactly as the free
+    function with x as the first operand:
+
+    - Equal(x) == GeRealEqual(x, value, tol)
+    - Less(x) == GeRealLess(x, value, tol)
+    - Greater(x) == GeRealGreater(x, value, tol)
+    - Compare(x) == GeRealCompare(x, value, tol)
+*/
+template <typename T>
+class GeRealComparator
+{
+    using Operand = ge::details::RealCompareOperand<T>;
+    using Fixed = ge::details::RealCompareFixed<T>;
+    using Fused = ge::details::RealCompareFused<T>;
+
+public:
+    GE_BIT_CAST_CONSTEXPR explicit GeRealComparator(T value, T tol)
+        : m_fixed{value, tol}
+    {
+    }
+
+    explicit GeRealComparator(T value)
+        : GeRealComparator(value, GeDefaultEpsilon<T>::Value())
+    {
+    }
+
+    constexpr T Value() const { return m_fixed.operand.value; }
+    constexpr T Tolerance() const { return m_fixed.tol; }
+
+    // Precomputed state, as passed to the batch kernels
+    constexpr const Fixed& Prepared() const { return m_fixed; }
+
+    GE_BIT_CAST_CONSTEXPR bool Equal(T x) const
+    {
+        const Fused cmp(Operand(x, m_fixed.threshold), m_fixed);
+        GE_STATS_REAL_COMPARE(GeStatCounter::kRealEqual, cmp);
+        return cmp.Equal();
+    }
+
+    GE_BIT_CAST_CONSTEXPR bool Less(T x) const
+    {
+        const Fused cmp(Operand(x, m_fixed.threshold), m_fixed);
+        GE_STATS_REAL_COMPARE(GeStatCounter::kRealLess, cmp);
+        return cmp.Less();
+    }
+
+    GE_BIT_CAST_CONSTEXPR bool Greater(T x) const
+    {
+        // GeRealLess(value, x) is Less of the swapped pair, i.e. Greater
+        const Fused cmp(Operand(x, m_fixed.threshold), m_fixed);
+        GE_STATS_REAL_COMPARE(GeStatCounter::kRealLess, cmp);
+        return cmp.Greater();
+    }
+
+    GE_BIT_CAST_CONSTEXPR GeRealOrder Compare(T x) const
+    {
+        const Fused cmp(Operand(x, m_fixed.threshold), m_fixed);
+        GE_STATS_REAL_COMPARE(GeStatCounter::kRealCompare, cmp);
+        return static_cast<GeRealOrder>(cmp.Compare());
+    }
+
+private:
+    Fixed m_fixed;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Unary predicates over a GeRealComparator for std::partition,
+    std::find_if, std::count_if, std::partition_point and the like.
+*/
+template <typename T>
+struct GeRealLessThan
+{
+    explicit GeRealLessThan(const GeRealComparator<T>& c) : comparator{c} {}
+    GeRealLessThan(T value, T tol) : comparator{value, tol} {}
+
+    bool operator()(T x) const { return comparator.Less(x); }
+
+    GeRealComparator<T> comparator;
+};
+
+template <typename T>
+struct GeRealEqualTo
+{
+    explicit GeRealEqualTo(const GeRealComparator<T>& c) : comparator{c} {}
+    GeRealEqualTo(T value, T tol) : comparator{value, tol} {}
+
+    bool operator()(T x) const { return comparator.Equal(x); }
+
+    GeRealComparator<T> comparator;
+};
+
+template <typename T>
+struct GeRealGreaterThan
+{
+    explicit GeRealGreaterThan(const GeRealComparator<T>& c) : comparator{c} {}
+    GeRealGreaterThan(T value, T tol) : comparator{value, tol} {}
+
+    bool operator()(T x) const { return comparator.Greater(x); }
+
+    GeRealComparator<T> comparator;
+};
+
+//------------------------------------------------------------------------------
+/**
+    GeRealLess as a binary comparator. Against a GeRealComparator it uses
+    the precomputed side, so a search for a value prepares it once:
+
+        const GeRealComparator<float> key(v, tol);
+        auto it = std::lower_bound(first, last, key, GeRealLessOrder<float>(tol));
+
+    lower_bound and upper_bound need the range partitioned by the tolerant
+    relation. A range in GeRadixSort order (-0 before +0) is, except for
+    negative values below the ULP threshold, which GeRealLess orders by
+    magnitude as GeIsRealLessByUlps does. For std::sort, keep in mind that tolerant
+    equality is not transitive: values closer than the tolerance come out
+    in an unspecified relative order.
+*/
+template <typename T>
+struct GeRealLessOrder
+{
+    explicit GeRealLessOrder(T t = GeDefaultEpsilon<T>::Value()) : tol{t} {}
+
+    bool operator()(T a, T b) const { return GeRealLess(a, b, tol); }
+    bool operator()(T x, const GeRealComparator<T>& key) const { return key.Less(x); }
+    bool operator()(const GeRealComparator<T>& key, T x) const { return key.Greater(x); }
+
+    T tol;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Batch filter: the positions i for which GeRealCompare(values[i], value,
+    tol) is order, in increasing order. kUnordered selects NaN values.
+
+    @param outIndices at least values.size() entries
+    @return number of positions written
+*/
+template <typename T>
+GeSize GeRealBatchFilter(GeSpan<const T> values, const GeRealComparator<T>& comparator, GeRealOrder order,
+                         GeSpan<GeUint32> outIndices);
+
+template <>
+GeSize GeRealBatchFilter<GeReal32>(GeSpan<const GeReal32> values, const GeRealComparator<GeReal32>& comparator,
+                                   GeRealOrder order, GeSpan<GeUint32> outIndices);
+
+template <>
+GeSize GeRealBatchFilter<GeReal64>(GeSpan<const GeReal64> values, const GeRealComparator<GeReal64>& comparator,
+                                   GeRealOrder order, GeSpan<GeUint32> outIndices);
+
+//------------------------------------------------------------------------------
+/**
+    Same selection as GeRealBatchFilter as a bit mask: bit i % 64 of word
+    i / 64 is set for a selected position.
+
+    @param outMask at least (values.size() + 63) / 64 words
+*/
+template <typename T>
+void GeRealBatchMask(GeSpan<const T> values, const GeRealComparator<T>& comparator, GeRealOrder order,
+                     GeSpan<GeUint64> outMask);
+
+template <>
+void GeRealBatchMask<GeReal32>(GeSpan<const GeReal32> values, const GeRealComparator<GeReal32>& comparator,
+                               GeRealOrder order, GeSpan<GeUint64> outMask);
+
+template <>
+void GeRealBatchMask<GeReal64>(GeSpan<const GeReal64> values, const GeRealComparator<GeReal64>& comparator,
+                               GeRealOrder order, GeSpan<GeUint64> outMask);
+
+namespace ge
+{
+    template <typename T>
+    using real_comparator = GeRealComparator<T>;
+
+    template <typename T>
+    using real_less_order = GeRealLessOrder<T>;
+
+    template <typename T>
+    inline size_t real_batch_filter(GeSpan<const T> values, const GeRealComparator<T>& comparator,
+                                    GeRealOrder order, GeSpan<uint32_t> outIndices)
+    {
+        return GeRealBatchFilter<T>(values, comparator, order, outIndices);
+    }
+} // eof ge
+
 #endif // GEOMUTILS_REALUTL_H
@@ -0,0 +1,361 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_SORT_H
+#define GEOMUTILS_SORT_H
+
+#include "gearena.h"
+#include "gerealutl.h"
+#include "gevector3array.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+//==============================================================================
+// Sortable integer keys
+//
+// Reals map to unsigned integers of the same width whose integer order is
+// the IEEE-754 total order: -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN.
+// The map is a bijection, so a key converts back to the exact real.
+
+template <typename T>
+struct GeSortableKeyOf;
+
+template <>
+struct GeSortableKeyOf<GeReal32>
+{
+    using type = GeUint32;
+};
+
+template <>
+struct GeSortableKeyOf<GeReal64>
+{
+    using type = GeUint64;
+};
+
+template <typename T>
+using GeSortableKey = typename GeSortableKeyOf<T>::type;
+
+GE_BIT_CAST_CONSTEXPR GeUint32 GeRealToSortableKey(GeReal32 x)
+{
+    return ge::details::RealBits<GeReal32>::ToSortable(x);
+}
+
+GE_BIT_CAST_CONSTEXPR GeUint64 GeRealToSortableKey(GeReal64 x)
+{
+    return ge::details::RealBits<GeReal64>::ToSortable(x);
+}
+
+GE_BIT_CAST_CONSTEXPR GeReal32 GeSortableKeyToReal(GeUint32 key)
+{
+    return ge::details::RealBits<GeReal32>::FromSortable(key);
+}
+
+GE_BIT_CAST_CONSTEXPR GeReal64 GeSortableKeyToReal(GeUint64 key)
+{
+    return ge::details::RealBits<GeReal64>::FromSortable(key);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Vector key ordered lexicographically by x, then y, then z.
+*/
+template <typename T>
+struct GeVector3SortableKey
+{
+    GeSortableKey<T> x;
+    GeSortableKey<T> y;
+    GeSortableKey<T> z;
+
+    bool operator==(const GeVector3SortableKey& other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    bool operator!=(const GeVector3SortableKey& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const GeVector3SortableKey& other) const {
+        if (x != other.x)
+            return x < other.x;
+        if (y != other.y)
+            return y < other.y;
+        return z < other.z;
+    }
+};
+
+template <typename T>
+GE_BIT_CAST_CONSTEXPR GeVector3SortableKey<T> GeVector3ToSortableKey(const GeVector3<T>& v)
+{
+    return {GeRealToSortableKey(v.x), GeRealToSortableKey(v.y), GeRealToSortableKey(v.z)};
+}
+
+//==============================================================================
+// Sorting
+//
+// The GeReal32/GeReal64 versions are stable LSD radix sorts over the
+// sortable keys, so they order by the total order above (-0 before +0,
+// NaNs at the ends) instead of operator<. The generic versions fall back to
+// std::stable_sort with operator<.
+
+//------------------------------------------------------------------------------
+/**
+    Sort parameters.
+*/
+struct GeSortOptions
+{
+    bool parallel = true;               // count and scatter on worker threads
+    GeSize grainSize = 1 << 16;         // smallest chunk handed to a worker
+    GeArena* pArena = nullptr;          // scratch buffers; the heap when null
+};
+
+//------------------------------------------------------------------------------
+/**
+    Sorts values in ascending order.
+*/
+template <typename T>
+void GeRadixSort(GeSpan<T> values, const GeSortOptions& options = GeSortOptions())
+{
+    (void)options;
+    std::stable_sort(values.data(), values.data() + values.size());
+}
+
+template <>
+void GeRadixSort<GeReal32>(GeSpan<GeReal32> values, const GeSortOptions& options);
+
+template <>
+void GeRadixSort<GeReal64>(GeSpan<GeReal64> values, const GeSortOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Stable sorting permutation: order[k] is the index of the k-th smallest
+    value, equal values keeping their input order.
+*/
+template <typename T>
+void GeRadixSortOrder(GeSpan<const T> values, GeSpan<GeUint32> order, const GeSortOptions& options = GeSortOptions())
+{
+    assert(values.size() == order.size());
+    (void)options;
+    std::iota(order.data(), order.data() + order.size(), GeUint32(0));
+    std::stable_sort(order.data(), order.data() + order.size(),
+                     [&values](GeUint32 a, GeUint32 b) { return values[a] < values[b]; });
+}
+
+template <>
+void GeRadixSortOrder<GeReal32>(GeSpan<const GeReal32> values, GeSpan<GeUint32> order, const GeSortOptions& options);
+
+template <>
+void GeRadixSortOrder<GeReal64>(GeSpan<const GeReal64> values, GeSpan<GeUint32> order, const GeSortOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Stable lexicographic (x, then y, then z) sorting permutation of a
+    vector array; order[k] is the index of the k-th smallest vector. The
+    radix versions sort by z, then y, then x.
+*/
+template <typename T>
+void GeVector3BatchSortOrder(GeVector3ArrayCView<T> a, GeSpan<GeUint32> order, const GeSortOptions& options = GeSortOptions())
+{
+    assert(a.size == order.size());
+    (void)options;
+    std::iota(order.data(), order.data() + order.size(), GeUint32(0));
+    std::stable_sort(order.data(), order.data() + order.size(), [&a](GeUint32 i, GeUint32 j) {
+        if (a.x[i] != a.x[j])
+            return a.x[i] < a.x[j];
+        if (a.y[i] != a.y[j])
+            return a.y[i] < a.y[j];
+        return a.z[i] < a.z[j];
+    });
+}
+
+template <>
+void GeVector3BatchSortOrder<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeSpan<GeUint32> order, const GeSortOptions& options);
+
+template <>
+void GeVector3BatchSortOrder<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeSpan<GeUint32> order, const GeSortOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Sorts a vector array lexicographically in place.
+*/
+template <typename T>
+void GeVector3BatchSort(GeVector3ArrayView<T> a, const GeSortOptions& options = GeSortOptions())
+{
+    GeArenaVector<GeUint32> order(a.size, GeArenaAllocator<GeUint32>(options.pArena));
+    GeVector3BatchSortOrder<T>(a, GeSpan<GeUint32>(order.data(), order.size()), options);
+
+    GeArenaVector<T> lane(a.size, GeArenaAllocator<T>(options.pArena));
+    for (T* p : {a.x, a.y, a.z})
+    {
+        for (GeSize k = 0; k < a.size; ++k)
+            lane[k] = p[order[k]];
+        std::copy(lane.begin(), lane.end(), p);
+    }
+}
+
+//==============================================================================
+// Tolerant unique
+//
+// Passes over sorted input that keep the first element of every run of
+// neighbours equal to it, moving the kept elements to the front in order
+// and returning their count (std::unique with a tolerant predicate). Each
+// element is compared with the last kept one, not with its predecessor, so
+// a slow drift does not merge a whole range into one element. Equality is
+// not transitive: a later kept element may still be equal to an earlier
+// one that is not its neighbour. GeWeldVertices does the full search.
+
+//------------------------------------------------------------------------------
+/**
+    Merges neighbours equal by GeIsRealEqualByUlps.
+*/
+template <typename T>
+GeSize GeUniqueByUlps(GeSpan<T> sorted, GeInt32 tolInUlps)
+{
+    GeSize kept = 0;
+    for (GeSize i = 0; i < sorted.size(); ++i)
+    {
+        if (kept == 0 || !GeIsRealEqualByUlps(sorted[kept - 1], sorted[i], tolInUlps))
+            sorted[kept++] = sorted[i];
+    }
+    return kept;
+}
+
+//------------------------------------------------------------------------------
+/**
+    Merges neighbours equal by GeRealEqual with tol.
+*/
+template <typename T>
+GeSize GeUniqueRealEqual(GeSpan<T> sorted, T tol)
+{
+    GeSize kept = 0;
+    for (GeSize i = 0; i < sorted.size(); ++i)
+    {
+        if (kept == 0 || !GeRealEqual(sorted[kept - 1], sorted[i], tol))
+            sorted[kept++] = sorted[i];
+    }
+    return kept;
+}
+
+//------------------------------------------------------------------------------
+/**
+    Merges neighbouring vectors whose three coordinates are pairwise equal
+    by GeIsRealEqualByUlps. The array is not resized.
+*/
+template <typename T>
+GeSize GeVector3BatchUniqueByUlps(GeVector3ArrayView<T> sorted, GeInt32 tolInUlps)
+{
+    GeSize kept = 0;
+    for (GeSize i = 0; i < sorted.size; ++i)
+    {
+        if (kept == 0 ||
+            !GeIsRealEqualByUlps(sorted.x[kept - 1], sorted.x[i], tolInUlps) ||
+            !GeIsRealEqualByUlps(sorted.y[kept - 1], sorted.y[i], tolInUlps) ||
+            !GeIsRealEqualByUlps(sorted.z[kept - 1], sorted.z[i], tolInUlps))
+        {
+            sorted.set(kept++, sorted[i]);
+        }
+    }
+    return kept;
+}
+
+//------------------------------------------------------------------------------
+/**
+    Merges neighbouring vectors whose three coordinates are pairwise equal
+    by GeRealEqual with tol. The array is not resized.
+*/
+template <typename T>
+GeSize GeVector3BatchUniqueRealEqual(GeVector3ArrayView<T> sorted, T tol)
+{
+    GeSize kept = 0;
+    for (GeSize i = 0; i < sorted.size; ++i)
+    {
+        if (kept == 0 ||
+            !GeRealEqual(sorted.x[kept - 1], sorted.x[i], tol) ||
+            !GeRealEqual(sorted.y[kept - 1], sorted.y[i], tol) ||
+            !GeRealEqual(sorted.z[kept - 1], sorted.z[i], tol))
+        {
+            sorted.set(kept++, sorted[i]);
+        }
+    }
+    return kept;
+}
+
+namespace ge
+{
+    using sort_options = GeSortOptions;
+
+    template <typename T>
+    using sortable_key = GeSortableKey<T>;
+
+    template <typename T>
+    inline void radix_sort(GeSpan<T> values, const GeSortOptions& options = GeSortOptions())
+    {
+        GeRadixSort<T>(values, options);
+    }
+
+    template <typename T>
+    inline void radix_sort_order(GeSpan<const T> values, GeSpan<uint32_t> order, const GeSortOptions& options = GeSortOptions())
+    {
+        GeRadixSortOrder<T>(values, order, options);
+    }
+
+    template <typename T>
+    inline void batch_sort(GeVector3ArrayView<T> a, const GeSortOptions& options = GeSortOptions())
+    {
+        GeVector3BatchSort<T>(a, options);
+    }
+
+    template <typename T>
+    inline void batch_sort_order(GeVector3ArrayCView<T> a, GeSpan<uint32_t> order, const GeSortOptions& options = GeSortOptions())
+    {
+        GeVector3BatchSortOrder<T>(a, order, options);
+    }
+
+    template <typename T>
+    inline size_t unique_by_ulps(GeSpan<T> sorted, int32_t tolInUlps)
+    {
+        return GeUniqueByUlps<T>(sorted, tolInUlps);
+    }
+
+    template <typename T>
+    inline size_t unique_real_equal(GeSpan<T> sorted, T tol)
+    {
+        return GeUniqueRealEqual<T>(sorted, tol);
+    }
+
+    template <typename T>
+    inline size_t batch_unique_by_ulps(GeVector3ArrayView<T> sorted, int32_t tolInUlps)
+    {
+        return GeVector3BatchUniqueByUlps<T>(sorted, tolInUlps);
+    }
+
+    template <typename T>
+    inline size_t batch_unique_real_equal(GeVector3ArrayView<T> sorted, T tol)
+    {
+        return GeVector3BatchUniqueRealEqual<T>(sorted, tol);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_SORT_H
@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_SPAN_H
+#define GEOMUTILS_SPAN_H
+
+#include "gebasedefs.h"
+
+#include <type_traits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+/**
+    Non-owning view over a contiguous sequence (pointer + size), used by the
+    batch interfaces.
+*/
+template <typename T>
+class GeSpan
+{
+    template <typename C>
+    using DataOf = decltype(std::declval<C&>().data());
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+
+    constexpr GeSpan() noexcept = default;
+
+    constexpr GeSpan(T* pData, GeSize size) noexcept
+        : m_pData{pData}
+        , m_size{size}
+        {}
+
+    template <GeSize N>
+    constexpr GeSpan(T (&array)[N]) noexcept
+        : m_pData{array}
+        , m_size{N}
+        {}
+
+    // Non-const -> const conversion
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>>
+    constexpr GeSpan(const GeSpan<U>& other) noexcept
+        : m_pData{other.data()}
+        , m_size{other.size()}
+        {}
+
+    // Contiguous containers exposing data() and size()
+    template <typename C,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<C>, GeSpan>::value &&
+                                          std::is_convertible<std::remove_pointer_t<DataOf<C>>(*)[], T(*)[]>::value>>
+    constexpr GeSpan(C& container) noexcept
+        : m_pData{container.data()}
+        , m_size{container.size()}
+        {}
+
+    constexpr T* data() const noexcept { return m_pData; }
+    constexpr GeSize size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    constexpr T& operator[](GeSize i) const { return m_pData[i]; }
+
+    constexpr iterator begin() const noexcept { return m_pData; }
+    constexpr iterator end() const noexcept { return m_pData + m_size; }
+
+    constexpr GeSpan subspan(GeSize offset, GeSize count) const
+    {
+        return GeSpan(m_pData + offset, count);
+    }
+
+    constexpr GeSpan first(GeSize count) const
+    {
+        return GeSpan(m_pData, count);
+    }
+
+private:
+    T* m_pData{nullptr};
+    GeSize m_size{0};
+};
+
+namespace ge
+{
+    template <typename T>
+    using span = GeSpan<T>;
+} // eof ge
+
+#endif // GEOMUTILS_SPAN_H
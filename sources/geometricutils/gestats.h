@@ -0,0 +1,323 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_STATS_H
+#define GEOMUTILS_STATS_H
+
+#include "gebasedefs.h"
+
+#include <string>
+
+#ifdef GE_ENABLE_STATS
+#   include <atomic>
+#   ifdef GE_ENABLE_STATS_TIMERS
+#       if defined(GE_ARCH_X86) && defined(_MSC_VER)
+#           include <intrin.h>
+#       elif defined(GE_ARCH_X86)
+#           include <x86intrin.h>
+#       else
+#           include <chrono>
+#       endif
+#   endif
+#endif
+
+#if defined(GE_ENABLE_STATS) && !defined(GE_HAS_IS_CONSTANT_EVALUATED)
+#   error "GE_ENABLE_STATS needs __builtin_is_constant_evaluated (GCC 9, Clang 9, MSVC 16.8 or later)"
+#endif
+
+//==============================================================================
+// Instrumentation
+//
+// Counters on the tolerant comparisons, the robust predicates and the batch
+// primitives, compiled in only when GE_ENABLE_STATS is defined for the whole
+// build (every translation unit has to agree). GE_ENABLE_STATS_TIMERS adds a
+// cycle count per primitive call: rdtsc on x86, steady-clock nanoseconds
+// elsewhere.
+// Without GE_ENABLE_STATS the recording macros expand to nothing and
+// snapshots are all zeros.
+//
+// Each thread counts into its own block, which it alone writes, so
+// recording takes no lock and no read-modify-write. Blocks are published
+// lock-free to a global list; a snapshot sums them, and a block of an
+// exited thread is folded into a retired total and reused. Snapshots taken
+// while other threads record are approximate; GeResetStats should only run
+// while nothing records.
+
+//------------------------------------------------------------------------------
+/**
+    Event counters.
+*/
+enum class GeStatCounter : GeUint32
+{
+    kRealEqual = 0,                 // GeRealEqual calls (GeReal32/GeReal64)
+    kRealLess,                      // GeRealLess calls, GeRealGreater included
+    kRealCompare,                   // GeRealCompare calls
+    kRealUlpAnyBelow,               // comparisons in ULP mode as |a| or |b| is below the threshold
+    kRealUlpMinBelow,               // in ULP mode as only tol * min(|a|, |b|) is below it
+    kRealRelative,                  // comparisons on the relative-tolerance path
+    kOrient2d,                      // GeOrient2d calls
+    kOrient2dExact,                 // of those, the ones the error filter left to the exact fallback
+    kOrient3d,
+    kOrient3dExact,
+    kInCircle,
+    kInCircleExact,
+    kInSphere,
+    kInSphereExact,
+    kCount
+};
+
+//------------------------------------------------------------------------------
+/**
+    Instrumented batch primitives. A primitive called by another one (the
+    sort under GeVector3BatchCurveOrder) is counted in both.
+*/
+enum class GeStatPrimitive : GeUint32
+{
+    kBatchUlpCompare = 0,           // GeIsRealEqualByUlps/GeIsRealLessByUlps spans
+    kBatchRealFilter,               // GeRealBatchFilter/GeRealBatchMask
+    kBatchDot,
+    kBatchCross,
+    kBatchMagnitude,                // magnitude, squared and inverse magnitude
+    kBatchNormalize,
+    kBatchReduce,                   // bounds, centroid, min/max, extreme point
+    kBatchTransform,
+    kBatchQuantize,
+    kBatchDequantize,
+    kBatchHalf,                     // half encode and decode
+    kBatchOctahedral,
+    kRadixSort,
+    kCurveKeys,
+    kWeld,
+    kBvhBuild,
+    kBvhQuery,                      // nearest, k-nearest, radius search, raycast
+    kCount
+};
+
+struct GeStatTiming
+{
+    GeUint64 calls = 0;
+    GeUint64 elements = 0;
+    GeUint64 cycles = 0;            // zero unless built with GE_ENABLE_STATS_TIMERS
+};
+
+//------------------------------------------------------------------------------
+/**
+    Totals over all threads.
+*/
+struct GeStatsSnapshot
+{
+    static constexpr GeSize kCounterCount = static_cast<GeSize>(GeStatCounter::kCount);
+    static constexpr GeSize kPrimitiveCount = static_cast<GeSize>(GeStatPrimitive::kCount);
+
+    GeUint64 counters[kCounterCount] = {};
+    GeStatTiming primitives[kPrimitiveCount] = {};
+    GeUint64 threads = 0;           // threads currently holding a counter block
+
+    GeUint64 operator[](GeStatCounter counter) const {
+        return counters[static_cast<GeSize>(counter)];
+    }
+
+    const GeStatTiming& operator[](GeStatPrimitive primitive) const {
+        return primitives[static_cast<GeSize>(primitive)];
+    }
+};
+
+constexpr bool GeStatsEnabled()
+{
+#ifdef GE_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+constexpr bool GeStatsTimersEnabled()
+{
+#if defined(GE_ENABLE_STATS) && defined(GE_ENABLE_STATS_TIMERS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+GeStatsSnapshot GeGetStatsSnapshot();
+void GeResetStats();
+
+//------------------------------------------------------------------------------
+/**
+    snake_case names, as used in the JSON dump.
+*/
+const char* GeStatCounterName(GeStatCounter counter);
+const char* GeStatPrimitiveName(GeStatPrimitive primitive);
+
+//------------------------------------------------------------------------------
+/**
+    {"enabled": .., "timers": .., "threads": n, "counters": {name: n, ..},
+     "primitives": {name: {"calls": n, "elements": n, "cycles": n}, ..}}
+*/
+std::string GeStatsToJson(const GeStatsSnapshot& snapshot);
+
+//==============================================================================
+// Recording
+
+#ifdef GE_ENABLE_STATS
+
+namespace ge
+{
+namespace details
+{
+namespace stats
+{
+    struct ThreadBlock
+    {
+        std::atomic<GeUint64> counters[GeStatsSnapshot::kCounterCount];
+        std::atomic<GeUint64> calls[GeStatsSnapshot::kPrimitiveCount];
+        std::atomic<GeUint64> elements[GeStatsSnapshot::kPrimitiveCount];
+        std::atomic<GeUint64> cycles[GeStatsSnapshot::kPrimitiveCount];
+        std::atomic<bool> inUse;
+        ThreadBlock* pNext;         // set before the block is published
+    };
+
+    // Block of the calling thread, claimed on first use (gestats.cpp)
+    ThreadBlock* AcquireThreadBlock();
+
+    inline ThreadBlock& Local()
+    {
+        thread_local ThreadBlock* const s_pBlock = AcquireThreadBlock();
+        return *s_pBlock;
+    }
+
+    // Only the owning thread writes, so a relaxed load and store suffice
+    inline void Bump(std::atomic<GeUint64>& counter, GeUint64 n)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    inline void Add(GeStatCounter counter, GeUint64 n)
+    {
+        Bump(Local().counters[static_cast<GeSize>(counter)], n);
+    }
+
+    inline void RecordRealCompare(GeStatCounter call, bool anyBelow, bool minBelow)
+    {
+        ThreadBlock& block = Local();
+        Bump(block.counters[static_cast<GeSize>(call)], 1);
+        const GeStatCounter path = anyBelow ? GeStatCounter::kRealUlpAnyBelow
+                                 : minBelow ? GeStatCounter::kRealUlpMinBelow
+                                            : GeStatCounter::kRealRelative;
+        Bump(block.counters[static_cast<GeSize>(path)], 1);
+    }
+
+    inline GeUint64 ReadCycles()
+    {
+#if !defined(GE_ENABLE_STATS_TIMERS)
+        return 0;
+#elif defined(GE_ARCH_X86)
+        return __rdtsc();
+#else
+        return static_cast<GeUint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    class Scope
+    {
+    public:
+        Scope(GeStatPrimitive primitive, GeSize elements)
+            : m_index{static_cast<GeSize>(primitive)}
+            , m_elements{elements}
+            , m_start{ReadCycles()}
+            {}
+
+        ~Scope()
+        {
+            ThreadBlock& block = Local();
+            Bump(block.calls[m_index], 1);
+            Bump(block.elements[m_index], m_elements);
+#ifdef GE_ENABLE_STATS_TIMERS
+            Bump(block.cycles[m_index], ReadCycles() - m_start);
+#endif
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        GeSize m_index;
+        GeSize m_elements;
+        GeUint64 m_start;
+    };
+} // end of stats
+} // end of details
+} // end of ge
+
+#   define GE_STATS_CONCAT_IMPL(a, b) a##b
+#   define GE_STATS_CONCAT(a, b) GE_STATS_CONCAT_IMPL(a, b)
+
+// Adds n to a GeStatCounter
+#   define GE_STATS_ADD(counter, n) ge::details::stats::Add((counter), (n))
+
+// Counts a tolerant comparison and its path; cmp is a RealCompareFused.
+// Usable in constexpr functions: skipped during constant evaluation.
+#   define GE_STATS_REAL_COMPARE(call, cmp)                                                             \
+        do {                                                                                            \
+            if (!GE_IS_CONSTANT_EVALUATED())                                                            \
+                ge::details::stats::RecordRealCompare((call), (cmp).IsAnyOfAbsBelowTheshold(),          \
+                                                      (cmp).IsMinOfAbsBelowTheshold());                 \
+        } while (false)
+
+// Counts a primitive call over n elements, timed to the end of the scope
+#   define GE_STATS_SCOPE(primitive, n) \
+        const ge::details::stats::Scope GE_STATS_CONCAT(geStatsScope, __LINE__)((primitive), (n))
+
+#else
+
+#   define GE_STATS_ADD(counter, n) ((void)0)
+#   define GE_STATS_REAL_COMPARE(call, cmp) ((void)0)
+#   define GE_STATS_SCOPE(primitive, n) ((void)0)
+
+#endif // GE_ENABLE_STATS
+
+namespace ge
+{
+    using stat_counter = GeStatCounter;
+    using stat_primitive = GeStatPrimitive;
+    using stats_snapshot = GeStatsSnapshot;
+
+    inline GeStatsSnapshot get_stats_snapshot()
+    {
+        return GeGetStatsSnapshot();
+    }
+
+    inline void reset_stats()
+    {
+        GeResetStats();
+    }
+
+    inline std::string stats_to_json(const GeStatsSnapshot& snapshot)
+    {
+        return GeStatsToJson(snapshot);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_STATS_H
@@ -0,0 +1,317 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_STREAM_H
+#define GEOMUTILS_STREAM_H
+
+#include "gevector3array.h"
+#include "geaabb.h"
+#include "gepointfile.h"
+#include "gerealutl.h"
+
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+
+//==============================================================================
+// Out-of-core point streams
+//
+// A stream pulls fixed-size chunks of points from a reader, passes each chunk
+// through a list of stages and hands what is left to a sink. Chunks live in
+// prefetch + 1 buffers allocated up front and recycled, so memory use depends
+// on the chunk size only, not on the input size. With prefetch > 0 the
+// reader runs on its own thread and fills the next buffers while the calling
+// thread runs the stages on the current one.
+
+//------------------------------------------------------------------------------
+/**
+    Stream parameters.
+*/
+struct GeStreamOptions
+{
+    GeSize chunkSize = 1 << 16;         // points per chunk
+    GeSize prefetch = 2;                // chunks read ahead of the stages; 0 reads inline
+};
+
+namespace ge
+{
+namespace details
+{
+    //--------------------------------------------------------------------------
+    /**
+        Drives slotCount buffers between produce and consume. produce(slot)
+        fills a free buffer and returns its point count, 0 at the end of the
+        input; consume(slot, count) processes a filled one. Buffers are
+        consumed in the order they were produced. With more than one slot,
+        produce runs on a separate thread. An exception from either side
+        stops both and is rethrown here, the consumer's first.
+    */
+    void RunStreamPipeline(GeSize slotCount,
+                           const std::function<GeSize(GeSize slot)>& produce,
+                           const std::function<void(GeSize slot, GeSize count)>& consume);
+} // end of details
+} // end of ge
+
+//------------------------------------------------------------------------------
+/**
+    Chunked pipeline over a point source that may be larger than memory.
+
+    The reader is called with an empty chunk of at most chunkSize points and
+    returns how many it filled; 0 ends the stream. Stages run in the order
+    they were added; each receives the points that survived the previous
+    ones and returns how many it kept at the front of the chunk. A stream
+    reads its source once: Run() and Reduce() consume it.
+*/
+template <typename T>
+class GePointStream
+{
+public:
+    using reader_type = std::function<GeSize(GeVector3ArrayView<T> chunk)>;
+    using stage_type = std::function<GeSize(GeVector3ArrayView<T> chunk)>;
+
+    explicit GePointStream(reader_type reader, const GeStreamOptions& options = GeStreamOptions())
+        : m_reader(std::move(reader))
+        , m_options(options)
+        {}
+
+    //--------------------------------------------------------------------------
+    /**
+        Appends a stage working on whole chunks.
+    */
+    GePointStream& Then(stage_type stage)
+    {
+        m_stages.push_back(std::move(stage));
+        return *this;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Replaces every point p by f(p).
+    */
+    template <typename F>
+    GePointStream& Transform(F f)
+    {
+        return Then([f](GeVector3ArrayView<T> chunk) {
+            for (GeSize i = 0; i < chunk.size; ++i)
+            {
+                chunk.set(i, f(chunk[i]));
+            }
+            return chunk.size;
+        });
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Keeps the points p for which pred(p) holds, in their original order.
+    */
+    template <typename Pred>
+    GePointStream& Filter(Pred pred)
+    {
+        return Then([pred](GeVector3ArrayView<T> chunk) {
+            GeSize kept = 0;
+            for (GeSize i = 0; i < chunk.size; ++i)
+            {
+                const GeVector3<T> p = chunk[i];
+                if (pred(p))
+                {
+                    chunk.set(kept++, p);
+                }
+            }
+            return kept;
+        });
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Keeps the points inside box, a coordinate GeRealEqual with tol to a
+        face counting as inside. Points with a NaN coordinate are dropped.
+    */
+    GePointStream& FilterInBounds(const GeAabb3<T>& box, T tol)
+    {
+        return Filter([box, tol](const GeVector3<T>& p) {
+            return NotBelow(p.x, box.min.x, tol) && NotBelow(box.max.x, p.x, tol) &&
+                   NotBelow(p.y, box.min.y, tol) && NotBelow(box.max.y, p.y, tol) &&
+                   NotBelow(p.z, box.min.z, tol) && NotBelow(box.max.z, p.z, tol);
+        });
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Streams the whole source through the stages and calls sink(chunk)
+        with every non-empty result, in input order. The view is only valid
+        during the call.
+
+        @return number of points passed to sink
+    */
+    template <typename Sink>
+    GeSize Run(Sink&& sink)
+    {
+        const GeSize chunkSize = m_options.chunkSize > 0 ? m_options.chunkSize : 1;
+        std::vector<GeVector3Array<T>> buffers(m_options.prefetch + 1);
+        for (GeVector3Array<T>& buffer : buffers)
+        {
+            buffer.resize(chunkSize);
+        }
+
+        GeSize delivered = 0;
+        ge::details::RunStreamPipeline(buffers.size(),
+            [&](GeSize slot) {
+                const GeSize count = m_reader(buffers[slot].view());
+                return count < chunkSize ? count : chunkSize;
+            },
+            [&](GeSize slot, GeSize count) {
+                GeVector3ArrayView<T> chunk = buffers[slot].view();
+                chunk.size = count;
+                for (const stage_type& stage : m_stages)
+                {
+                    if (chunk.size == 0)
+                        return;
+                    chunk.size = stage(chunk);
+                }
+                if (chunk.size == 0)
+                    return;
+                sink(GeVector3ArrayCView<T>(chunk));
+                delivered += chunk.size;
+            });
+        return delivered;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Folds the stream: f(accumulator, chunk) is called for every chunk Run()
+        would pass to a sink.
+    */
+    template <typename Acc, typename F>
+    Acc Reduce(Acc init, F f)
+    {
+        Run([&](GeVector3ArrayCView<T> chunk) { f(init, chunk); });
+        return init;
+    }
+
+private:
+    // a >= b, or equal within tol; false for NaN
+    static bool NotBelow(T a, T b, T tol)
+    {
+        const GeRealOrder order = GeRealCompare(a, b, tol);
+        return order == GeRealOrder::kEqual || order == GeRealOrder::kGreater;
+    }
+
+    reader_type m_reader;
+    std::vector<stage_type> m_stages;
+    GeStreamOptions m_options;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Sequential reader of a point file (see gepointfile.h) for files too large
+    to map. Each Read() fetches the next points with ordinary buffered reads,
+    converting layout and byte order on the way.
+*/
+class GePointFileReader
+{
+public:
+    GePointFileReader() = default;
+    ~GePointFileReader();
+
+    GePointFileReader(GePointFileReader&& other) noexcept;
+    GePointFileReader& operator=(GePointFileReader&& other) noexcept;
+    GePointFileReader(const GePointFileReader&) = delete;
+    GePointFileReader& operator=(const GePointFileReader&) = delete;
+
+    //--------------------------------------------------------------------------
+    /**
+        Opens path and validates its header. Any previously open file is
+        closed first.
+
+        @return false if the file cannot be opened or is not a valid point
+        file
+    */
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const { return m_pFile != nullptr; }
+    GeSize Size() const { return m_count; }
+    GeSize Position() const { return m_position; }
+    GePointLayout Layout() const { return m_layout; }
+    GeByteOrder ByteOrder() const { return m_order; }
+    GeSize ScalarSize() const { return m_scalarSize; }
+
+    // True once a read has failed, or been attempted with the wrong scalar type
+    bool Failed() const { return m_failed; }
+
+    //--------------------------------------------------------------------------
+    /**
+        Reads up to out.size points following the previous ones. The scalar
+        type must match the file's.
+
+        @return number of points read; 0 at the end of the file or on failure
+    */
+    GeSize Read(GeVector3ArrayView<GeReal32> out);
+    GeSize Read(GeVector3ArrayView<GeReal64> out);
+
+private:
+    template <typename T>
+    GeSize ReadChunk(GeVector3ArrayView<T> out);
+
+    bool ReadAt(GeUint64 offset, void* pData, GeSize size);
+
+    std::FILE* m_pFile = nullptr;
+    std::vector<GeByte> m_scratch;      // interleaved AoS chunk
+    GeSize m_count = 0;
+    GeSize m_position = 0;              // points already read
+    GeUint64 m_payloadOffset = 0;
+    GeUint64 m_laneStride = 0;
+    GePointLayout m_layout = GePointLayout::kAos;
+    GeByteOrder m_order = GeByteOrder::kLittle;
+    GeUint8 m_scalarSize = 0;
+    bool m_failed = false;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Stream over the remaining points of an open reader. The reader must
+    outlive the stream's Run().
+*/
+template <typename T>
+GePointStream<T> GeMakePointStream(GePointFileReader& file, const GeStreamOptions& options = GeStreamOptions())
+{
+    return GePointStream<T>([&file](GeVector3ArrayView<T> chunk) { return file.Read(chunk); }, options);
+}
+
+namespace ge
+{
+    using stream_options = GeStreamOptions;
+    using point_file_reader = GePointFileReader;
+
+    template <typename T>
+    using point_stream = GePointStream<T>;
+
+    template <typename T>
+    inline GePointStream<T> make_point_stream(GePointFileReader& file, const GeStreamOptions& options = GeStreamOptions())
+    {
+        return GeMakePointStream<T>(file, options);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_STREAM_H
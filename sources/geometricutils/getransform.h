@@ -0,0 +1,228 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_TRANSFORM_H
+#define GEOMUTILS_TRANSFORM_H
+
+#include "gematrix3.h"
+#include "gematrix4.h"
+#include "gequaternion.h"
+#include "gevector3array.h"
+
+#include <cassert>
+
+//==============================================================================
+// Batch transforms of structure-of-arrays vectors
+//
+// Each element is computed exactly as by the matching GeMatrix3/GeMatrix4
+// member, so batch and scalar results agree bit for bit. The GeReal32/
+// GeReal64 versions run on the SIMD kernels and split large inputs across
+// threads; out may be the same arrays as in for an in-place transform (the
+// overloads taking a single view do that).
+
+//------------------------------------------------------------------------------
+/**
+    Transform parameters.
+*/
+struct GeTransformOptions
+{
+    bool parallel = true;               // split the input across threads
+    GeSize grainSize = 1 << 16;         // smallest chunk handed to a worker
+};
+
+//------------------------------------------------------------------------------
+/**
+    out[i] = m.transform_point(in[i]): w = 1, the last row of m is ignored.
+*/
+template <typename T>
+void GeVector3BatchTransformPoints(GeVector3ArrayCView<T> in, const GeMatrix4<T>& m, GeVector3ArrayView<T> out,
+                                   const GeTransformOptions& options = GeTransformOptions())
+{
+    assert(in.size == out.size);
+    (void)options;
+    for (GeSize i = 0; i < in.size; ++i)
+    {
+        out.set(i, m.transform_point(in[i]));
+    }
+}
+
+template <>
+void GeVector3BatchTransformPoints<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix4<GeReal32>& m,
+                                             GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options);
+
+template <>
+void GeVector3BatchTransformPoints<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix4<GeReal64>& m,
+                                             GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    out[i] = m.project_point(in[i]): the full 4x4 product divided by w.
+*/
+template <typename T>
+void GeVector3BatchProjectPoints(GeVector3ArrayCView<T> in, const GeMatrix4<T>& m, GeVector3ArrayView<T> out,
+                                 const GeTransformOptions& options = GeTransformOptions())
+{
+    assert(in.size == out.size);
+    (void)options;
+    for (GeSize i = 0; i < in.size; ++i)
+    {
+        out.set(i, m.project_point(in[i]));
+    }
+}
+
+template <>
+void GeVector3BatchProjectPoints<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix4<GeReal32>& m,
+                                           GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options);
+
+template <>
+void GeVector3BatchProjectPoints<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix4<GeReal64>& m,
+                                           GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    out[i] = m * in[i], for directions or any linear map.
+*/
+template <typename T>
+void GeVector3BatchTransformDirections(GeVector3ArrayCView<T> in, const GeMatrix3<T>& m, GeVector3ArrayView<T> out,
+                                       const GeTransformOptions& options = GeTransformOptions())
+{
+    assert(in.size == out.size);
+    (void)options;
+    for (GeSize i = 0; i < in.size; ++i)
+    {
+        out.set(i, m * in[i]);
+    }
+}
+
+template <>
+void GeVector3BatchTransformDirections<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix3<GeReal32>& m,
+                                                 GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options);
+
+template <>
+void GeVector3BatchTransformDirections<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix3<GeReal64>& m,
+                                                 GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options);
+
+// Directions by the upper-left 3x3 block, as GeMatrix4::transform_direction
+template <typename T>
+inline void GeVector3BatchTransformDirections(GeVector3ArrayCView<T> in, const GeMatrix4<T>& m, GeVector3ArrayView<T> out,
+                                              const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchTransformDirections<T>(in, m.linear(), out, options);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Rotates by unit quaternion q through its rotation matrix, so results
+    match q.to_matrix() * v rather than q.rotate(v) (both are within a few
+    ulps of the exact rotation).
+*/
+template <typename T>
+inline void GeVector3BatchRotate(GeVector3ArrayCView<T> in, const GeQuaternion<T>& q, GeVector3ArrayView<T> out,
+                                 const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchTransformDirections<T>(in, q.to_matrix(), out, options);
+}
+
+//------------------------------------------------------------------------------
+// In place
+
+template <typename T>
+inline void GeVector3BatchTransformPoints(GeVector3ArrayView<T> points, const GeMatrix4<T>& m,
+                                          const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchTransformPoints<T>({points.x, points.y, points.z, points.size}, m, points, options);
+}
+
+template <typename T>
+inline void GeVector3BatchProjectPoints(GeVector3ArrayView<T> points, const GeMatrix4<T>& m,
+                                        const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchProjectPoints<T>({points.x, points.y, points.z, points.size}, m, points, options);
+}
+
+template <typename T, typename M>
+inline void GeVector3BatchTransformDirections(GeVector3ArrayView<T> directions, const M& m,
+                                              const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchTransformDirections<T>({directions.x, directions.y, directions.z, directions.size}, m, directions, options);
+}
+
+template <typename T>
+inline void GeVector3BatchRotate(GeVector3ArrayView<T> directions, const GeQuaternion<T>& q,
+                                 const GeTransformOptions& options = GeTransformOptions())
+{
+    GeVector3BatchRotate<T>({directions.x, directions.y, directions.z, directions.size}, q, directions, options);
+}
+
+namespace ge
+{
+    using transform_options = GeTransformOptions;
+
+    template <typename T, typename InAllocator, typename OutAllocator>
+    inline void batch_transform_points(const GeVector3Array<T, InAllocator>& in, const GeMatrix4<T>& m, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchTransformPoints<T>(in.cview(), m, out.view());
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_transform_points(GeVector3Array<T, Allocator>& points, const GeMatrix4<T>& m)
+    {
+        GeVector3BatchTransformPoints<T>(points.view(), m);
+    }
+
+    template <typename T, typename InAllocator, typename OutAllocator>
+    inline void batch_project_points(const GeVector3Array<T, InAllocator>& in, const GeMatrix4<T>& m, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchProjectPoints<T>(in.cview(), m, out.view());
+    }
+
+    template <typename T, typename M, typename InAllocator, typename OutAllocator>
+    inline void batch_transform_directions(const GeVector3Array<T, InAllocator>& in, const M& m, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchTransformDirections<T>(in.cview(), m, out.view());
+    }
+
+    template <typename T, typename M, typename Allocator>
+    inline void batch_transform_directions(GeVector3Array<T, Allocator>& directions, const M& m)
+    {
+        GeVector3BatchTransformDirections<T>(directions.view(), m);
+    }
+
+    template <typename T, typename InAllocator, typename OutAllocator>
+    inline void batch_rotate(const GeVector3Array<T, InAllocator>& in, const GeQuaternion<T>& q, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(in.size());
+        GeVector3BatchRotate<T>(in.cview(), q, out.view());
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_rotate(GeVector3Array<T, Allocator>& directions, const GeQuaternion<T>& q)
+    {
+        GeVector3BatchRotate<T>(directions.view(), q);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_TRANSFORM_H
@@ -26,6 +26,68 @@ SOFTWARE.
 
 #include "gebaseutl.h"
 
+#include <iostream>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+/**
+    Exact-arithmetic widening of GeVector3 components: product_type holds the
+    product of two T values and the difference of two such products
+    (GeWideCross), dot_type the sum of three (GeWideDot). Real types widen to
+    double, which holds float products exactly. GeFixed specializes this in
+    gefixed.h.
+*/
+template <typename T>
+struct GeWide
+{
+    static_assert(std::is_floating_point<T>::value, "GeWide: no wide type for T");
+
+    using product_type = GeReal64;
+    using dot_type = GeReal64;
+
+    static product_type Product(T a, T b) { return product_type(a) * product_type(b); }
+    static dot_type DotProduct(T a, T b) { return dot_type(a) * dot_type(b); }
+};
+
+namespace ge
+{
+namespace details
+{
+    template <typename T, typename P, typename D>
+    struct IntWide
+    {
+        using product_type = P;
+        using dot_type = D;
+
+        static product_type Product(T a, T b) { return product_type(a) * product_type(b); }
+        static dot_type DotProduct(T a, T b) { return dot_type(a) * dot_type(b); }
+    };
+} // end of details
+} // end of ge
+
+template <>
+struct GeWide<GeInt8> : ge::details::IntWide<GeInt8, GeInt32, GeInt32> {};
+
+template <>
+struct GeWide<GeInt16> : ge::details::IntWide<GeInt16, GeInt64, GeInt64> {};
+
+// Without 128-bit integers, int32 dot products are exact only while every
+// component stays within +-2^30
+#ifdef GE_HAS_INT128
+template <>
+struct GeWide<GeInt32> : ge::details::IntWide<GeInt32, GeInt64, GeInt128> {};
+#else
+template <>
+struct GeWide<GeInt32> : ge::details::IntWide<GeInt32, GeInt64, GeInt64> {};
+#endif
+
+// int64 products need 128-bit integers; dot products are exact while every
+// component stays within +-2^62
+#ifdef GE_HAS_INT128
+template <>
+struct GeWide<GeInt64> : ge::details::IntWide<GeInt64, GeInt128, GeInt128> {};
+#endif
+
 template <typename T>
 class GeVector3 
 {
@@ -33,57 +95,120 @@ public:
     T x, y, z;
 
     // Constructors
-    Vector3D() 
-        : x(GetZero<T>())
-        , y(GetZero<T>())
-        , z(GetZero<T>()) 
+    GeVector3() 
+        : x(GeZero<T>())
+        , y(GeZero<T>())
+        , z(GeZero<T>()) 
         {}
 
-    Vector3D(T x, T y, T z) 
+    GeVector3(T x, T y, T z) 
         : x{x}
         , y{y}
         , z{z}
         {}
 
     // Vector operations
-    Vector3D operator+(const Vector3D& other) const {
-        return Vector3D(x + other.x, y + other.y, z + other.z);
+    GeVector3 operator+(const GeVector3& other) const {
+        return GeVector3(x + other.x, y + other.y, z + other.z);
+    }
+
+    GeVector3 operator-(const GeVector3& other) const {
+        return GeVector3(x - other.x, y - other.y, z - other.z);
     }
 
-    Vector3D operator-(const Vector3D& other) const {
-        return Vector3D(x - other.x, y - other.y, z - other.z);
+    template <typename U = T, std::enable_if_t<std::is_floating_point<U>::value, int> = 0>
+    GeVector3 operator*(double scalar) const {
+        return GeVector3(x * scalar, y * scalar, z * scalar);
     }
 
-    Vector3D operator*(double scalar) const {
-        return Vector3D(x * scalar, y * scalar, z * scalar);
+    // Integer and fixed-point vectors scale by their own type
+    template <typename U = T, std::enable_if_t<!std::is_floating_point<U>::value, int> = 0>
+    GeVector3 operator*(T scalar) const {
+        return GeVector3(x * scalar, y * scalar, z * scalar);
     }
 
-    double dot(const Vector3D& other) const {
-        return x * other.x + y * other.y + z * other.z;
+    // double for real types; for integer and fixed-point types the exact
+    // GeWideDot, since products in T would overflow
+    auto dot(const GeVector3& other) const {
+        if constexpr (std::is_floating_point<T>::value) {
+            return static_cast<double>(x * other.x + y * other.y + z * other.z);
+        } else {
+            return GeWideDot(*this, other);
+        }
     }
 
-    Vector3D cross(const Vector3D& other) const {
-        return Vector3D(
+    // Computed in T; see GeWideCross for integer and fixed-point types
+    GeVector3 cross(const GeVector3& other) const {
+        return GeVector3(
             y * other.z - z * other.y,
             z * other.x - x * other.z,
             x * other.y - y * other.x
         );
     }
 
-    T magnitude_square() const {
-        return (x * x + y * y + z * z);
+    // T for real types; for integer and fixed-point types the exact
+    // GeWideDot, since the squares in T would overflow
+    auto magnitude_square() const {
+        if constexpr (std::is_floating_point<T>::value) {
+            return (x * x + y * y + z * z);
+        } else {
+            return GeWideDot(*this, *this);
+        }
     }
 
+    // The members below are for real T only: an integer or fixed-point
+    // vector has no unit length in T. Use magnitude_square, or convert the
+    // components to a real type first.
     T magnitude() const {
+        static_assert(std::is_floating_point<T>::value, "GeVector3::magnitude: T must be a real type");
         return GeSqrt(x * x + y * y + z * z);
     }
 
-    Vector3D normalize() const {
+    T inv_magnitude() const {
+        static_assert(std::is_floating_point<T>::value, "GeVector3::inv_magnitude: T must be a real type");
+        return GeRsqrt(magnitude_square());
+    }
+
+    GeVector3 normalize() const {
+        static_assert(std::is_floating_point<T>::value, "GeVector3::normalize: T must be a real type");
         double mag = magnitude();
         if (mag != 0.0) {
-            return Vector3D(x / mag, y / mag, z / mag);
+            return GeVector3(x / mag, y / mag, z / mag);
         } else {
-            return Vector3D(0, 0, 0);
+            return GeVector3(0, 0, 0);
+        }
+    }
+
+    // Precision-selectable variants, see GePrecision for error bounds.
+    // kExact (and types without a fast rsqrt) forwards to the members above.
+    template <GePrecision P>
+    T magnitude() const {
+        if constexpr (P == GePrecision::kExact || !GeHasFastRsqrt<T>()) {
+            return magnitude();
+        } else {
+            const T sq = magnitude_square();
+            return (sq != 0) ? sq * GeRsqrt<P>(sq) : T(0);
+        }
+    }
+
+    template <GePrecision P>
+    T inv_magnitude() const {
+        static_assert(std::is_floating_point<T>::value, "GeVector3::inv_magnitude: T must be a real type");
+        return GeRsqrt<P>(magnitude_square());
+    }
+
+    template <GePrecision P>
+    GeVector3 normalize() const {
+        if constexpr (P == GePrecision::kExact || !GeHasFastRsqrt<T>()) {
+            return normalize();
+        } else {
+            const T sq = magnitude_square();
+            if (sq != 0) {
+                const T inv = GeRsqrt<P>(sq);
+                return GeVector3(x * inv, y * inv, z * inv);
+            } else {
+                return GeVector3(0, 0, 0);
+            }
         }
     }
 
@@ -93,14 +218,54 @@ public:
     }
 };
 
+//------------------------------------------------------------------------------
+/**
+    Dot product without overflow or rounding for integer and fixed-point T
+    (see GeWide); for real T, in double.
+*/
+template <typename T>
+inline typename GeWide<T>::dot_type GeWideDot(const GeVector3<T>& a, const GeVector3<T>& b)
+{
+    using W = GeWide<T>;
+    return W::DotProduct(a.x, b.x) + W::DotProduct(a.y, b.y) + W::DotProduct(a.z, b.z);
+}
+
+//------------------------------------------------------------------------------
+/**
+    Cross product in GeWide<T>::product_type, exact for integer and
+    fixed-point T.
+*/
+template <typename T>
+inline GeVector3<typename GeWide<T>::product_type> GeWideCross(const GeVector3<T>& a, const GeVector3<T>& b)
+{
+    using W = GeWide<T>;
+    return GeVector3<typename W::product_type>(
+        W::Product(a.y, b.z) - W::Product(a.z, b.y),
+        W::Product(a.z, b.x) - W::Product(a.x, b.z),
+        W::Product(a.x, b.y) - W::Product(a.y, b.x)
+    );
+}
+
 namespace ge
 {
     template <typename T>
     using vector3 = GeVector3<T>;
+
+    template <typename T>
+    inline auto wide_dot(const GeVector3<T>& a, const GeVector3<T>& b)
+    {
+        return GeWideDot(a, b);
+    }
+
+    template <typename T>
+    inline auto wide_cross(const GeVector3<T>& a, const GeVector3<T>& b)
+    {
+        return GeWideCross(a, b);
+    }
     
 } // eof gu
 
 
 
 
-#endif // GEOMUTILS_VECTOR3_H
\ No newline at end of file
+#endif // GEOMUTILS_VECTOR3_H
@@ -0,0 +1,382 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_VECTOR3ARRAY_H
+#define GEOMUTILS_VECTOR3ARRAY_H
+
+#include "gevector3.h"
+#include "gealignedallocator.h"
+#include "gearena.h"
+
+#include <cassert>
+#include <vector>
+
+//==============================================================================
+// Structure-of-arrays views
+
+template <typename T>
+struct GeVector3ArrayCView
+{
+    const T* x;
+    const T* y;
+    const T* z;
+    GeSize size;
+
+    GeVector3<T> operator[](GeSize i) const
+    {
+        return GeVector3<T>(x[i], y[i], z[i]);
+    }
+};
+
+template <typename T>
+struct GeVector3ArrayView
+{
+    T* x;
+    T* y;
+    T* z;
+    GeSize size;
+
+    GeVector3<T> operator[](GeSize i) const
+    {
+        return GeVector3<T>(x[i], y[i], z[i]);
+    }
+
+    void set(GeSize i, const GeVector3<T>& v) const
+    {
+        x[i] = v.x;
+        y[i] = v.y;
+        z[i] = v.z;
+    }
+
+    operator GeVector3ArrayCView<T>() const
+    {
+        return {x, y, z, size};
+    }
+};
+
+//==============================================================================
+// Structure-of-arrays container
+
+//------------------------------------------------------------------------------
+/**
+    Stores GeVector3 components in three separate SIMD-aligned lanes so the
+    batch kernels can process whole registers of x, y and z at once.
+
+    The lanes are allocated with Allocator, e.g. GeArenaAllocator for
+    transient arrays (GeVector3ArenaArray); it must keep the SIMD alignment.
+*/
+template <typename T, typename Allocator = GeAlignedAllocator<T>>
+class GeVector3Array
+{
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using lane_type = std::vector<T, Allocator>;
+
+    GeVector3Array() = default;
+
+    explicit GeVector3Array(const Allocator& allocator)
+        : m_x(allocator)
+        , m_y(allocator)
+        , m_z(allocator)
+        {}
+
+    explicit GeVector3Array(GeSize n, const Allocator& allocator = Allocator())
+        : m_x(n, allocator)
+        , m_y(n, allocator)
+        , m_z(n, allocator)
+        {}
+
+    GeVector3Array(const GeVector3<T>* pVectors, GeSize n, const Allocator& allocator = Allocator())
+        : GeVector3Array(allocator)
+    {
+        reserve(n);
+        for (GeSize i = 0; i < n; ++i)
+        {
+            push_back(pVectors[i]);
+        }
+    }
+
+    GeSize size() const { return m_x.size(); }
+    bool empty() const { return m_x.empty(); }
+    Allocator get_allocator() const { return m_x.get_allocator(); }
+
+    void resize(GeSize n)
+    {
+        m_x.resize(n);
+        m_y.resize(n);
+        m_z.resize(n);
+    }
+
+    void reserve(GeSize n)
+    {
+        m_x.reserve(n);
+        m_y.reserve(n);
+        m_z.reserve(n);
+    }
+
+    void clear()
+    {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+    }
+
+    void push_back(const GeVector3<T>& v)
+    {
+        m_x.push_back(v.x);
+        m_y.push_back(v.y);
+        m_z.push_back(v.z);
+    }
+
+    GeVector3<T> operator[](GeSize i) const
+    {
+        return GeVector3<T>(m_x[i], m_y[i], m_z[i]);
+    }
+
+    void set(GeSize i, const GeVector3<T>& v)
+    {
+        m_x[i] = v.x;
+        m_y[i] = v.y;
+        m_z[i] = v.z;
+    }
+
+    T* x() { return m_x.data(); }
+    T* y() { return m_y.data(); }
+    T* z() { return m_z.data(); }
+    const T* x() const { return m_x.data(); }
+    const T* y() const { return m_y.data(); }
+    const T* z() const { return m_z.data(); }
+
+    GeVector3ArrayView<T> view()
+    {
+        return {x(), y(), z(), size()};
+    }
+
+    GeVector3ArrayCView<T> cview() const
+    {
+        return {x(), y(), z(), size()};
+    }
+
+private:
+    lane_type m_x;
+    lane_type m_y;
+    lane_type m_z;
+};
+
+// Lanes from an arena, or the heap when the allocator has none
+template <typename T>
+using GeVector3ArenaArray = GeVector3Array<T, GeArenaAllocator<T>>;
+
+//==============================================================================
+// Batch operations
+//
+// Each function applies the GeVector3 member of the same name lane by lane
+// with identical operation order, so results match the scalar version
+// bit for bit. Outputs may alias inputs.
+
+//------------------------------------------------------------------------------
+/**
+    @param out receives a.size dot products
+*/
+template <typename T>
+void GeVector3BatchDot(GeVector3ArrayCView<T> a, GeVector3ArrayCView<T> b, T* out)
+{
+    assert(a.size == b.size);
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    }
+}
+
+template <>
+void GeVector3BatchDot<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayCView<GeReal32> b, GeReal32* out);
+
+template <>
+void GeVector3BatchDot<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayCView<GeReal64> b, GeReal64* out);
+
+//------------------------------------------------------------------------------
+/**
+*/
+template <typename T>
+void GeVector3BatchCross(GeVector3ArrayCView<T> a, GeVector3ArrayCView<T> b, GeVector3ArrayView<T> out)
+{
+    assert(a.size == b.size && a.size == out.size);
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        out.set(i, a[i].cross(b[i]));
+    }
+}
+
+template <>
+void GeVector3BatchCross<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayCView<GeReal32> b, GeVector3ArrayView<GeReal32> out);
+
+template <>
+void GeVector3BatchCross<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayCView<GeReal64> b, GeVector3ArrayView<GeReal64> out);
+
+//------------------------------------------------------------------------------
+/**
+*/
+template <typename T>
+void GeVector3BatchMagnitudeSquare(GeVector3ArrayCView<T> a, T* out)
+{
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        out[i] = a[i].magnitude_square();
+    }
+}
+
+template <>
+void GeVector3BatchMagnitudeSquare<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out);
+
+template <>
+void GeVector3BatchMagnitudeSquare<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out);
+
+//------------------------------------------------------------------------------
+/**
+    precision selects the rsqrt tier for GeReal32, see GePrecision.
+*/
+template <typename T>
+void GeVector3BatchMagnitude(GeVector3ArrayCView<T> a, T* out,
+                             GePrecision precision = GePrecision::kExact)
+{
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        switch (precision)
+        {
+        case GePrecision::kRefined:     out[i] = a[i].template magnitude<GePrecision::kRefined>(); break;
+        case GePrecision::kApproximate: out[i] = a[i].template magnitude<GePrecision::kApproximate>(); break;
+        default:                        out[i] = a[i].magnitude(); break;
+        }
+    }
+}
+
+template <>
+void GeVector3BatchMagnitude<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out, GePrecision precision);
+
+template <>
+void GeVector3BatchMagnitude<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out, GePrecision precision);
+
+//------------------------------------------------------------------------------
+/**
+    1 / |a[i]|; zero-magnitude vectors give +inf.
+*/
+template <typename T>
+void GeVector3BatchInvMagnitude(GeVector3ArrayCView<T> a, T* out,
+                                GePrecision precision = GePrecision::kExact)
+{
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        switch (precision)
+        {
+        case GePrecision::kRefined:     out[i] = a[i].template inv_magnitude<GePrecision::kRefined>(); break;
+        case GePrecision::kApproximate: out[i] = a[i].template inv_magnitude<GePrecision::kApproximate>(); break;
+        default:                        out[i] = a[i].inv_magnitude(); break;
+        }
+    }
+}
+
+template <>
+void GeVector3BatchInvMagnitude<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out, GePrecision precision);
+
+template <>
+void GeVector3BatchInvMagnitude<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out, GePrecision precision);
+
+//------------------------------------------------------------------------------
+/**
+    Zero-magnitude vectors normalize to (0, 0, 0), as GeVector3::normalize().
+    precision selects the rsqrt tier for GeReal32, see GePrecision.
+*/
+template <typename T>
+void GeVector3BatchNormalize(GeVector3ArrayCView<T> a, GeVector3ArrayView<T> out,
+                             GePrecision precision = GePrecision::kExact)
+{
+    assert(a.size == out.size);
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        switch (precision)
+        {
+        case GePrecision::kRefined:     out.set(i, a[i].template normalize<GePrecision::kRefined>()); break;
+        case GePrecision::kApproximate: out.set(i, a[i].template normalize<GePrecision::kApproximate>()); break;
+        default:                        out.set(i, a[i].normalize()); break;
+        }
+    }
+}
+
+template <>
+void GeVector3BatchNormalize<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayView<GeReal32> out, GePrecision precision);
+
+template <>
+void GeVector3BatchNormalize<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayView<GeReal64> out, GePrecision precision);
+
+namespace ge
+{
+    template <typename T, typename Allocator = GeAlignedAllocator<T>>
+    using vector3_array = GeVector3Array<T, Allocator>;
+
+    template <typename T>
+    using vector3_arena_array = GeVector3ArenaArray<T>;
+
+    template <typename T, typename AllocatorA, typename AllocatorB>
+    inline void batch_dot(const GeVector3Array<T, AllocatorA>& a, const GeVector3Array<T, AllocatorB>& b, T* out)
+    {
+        GeVector3BatchDot<T>(a.cview(), b.cview(), out);
+    }
+
+    template <typename T, typename AllocatorA, typename AllocatorB, typename OutAllocator>
+    inline void batch_cross(const GeVector3Array<T, AllocatorA>& a, const GeVector3Array<T, AllocatorB>& b, GeVector3Array<T, OutAllocator>& out)
+    {
+        out.resize(a.size());
+        GeVector3BatchCross<T>(a.cview(), b.cview(), out.view());
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_magnitude_square(const GeVector3Array<T, Allocator>& a, T* out)
+    {
+        GeVector3BatchMagnitudeSquare<T>(a.cview(), out);
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_magnitude(const GeVector3Array<T, Allocator>& a, T* out,
+                                GePrecision precision = GePrecision::kExact)
+    {
+        GeVector3BatchMagnitude<T>(a.cview(), out, precision);
+    }
+
+    template <typename T, typename Allocator>
+    inline void batch_inv_magnitude(const GeVector3Array<T, Allocator>& a, T* out,
+                                    GePrecision precision = GePrecision::kExact)
+    {
+        GeVector3BatchInvMagnitude<T>(a.cview(), out, precision);
+    }
+
+    template <typename T, typename Allocator, typename OutAllocator>
+    inline void batch_normalize(const GeVector3Array<T, Allocator>& a, GeVector3Array<T, OutAllocator>& out,
+                                GePrecision precision = GePrecision::kExact)
+    {
+        out.resize(a.size());
+        GeVector3BatchNormalize<T>(a.cview(), out.view(), precision);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_VECTOR3ARRAY_H
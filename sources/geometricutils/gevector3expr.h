@@ -0,0 +1,578 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_VECTOR3EXPR_H
+#define GEOMUTILS_VECTOR3EXPR_H
+
+#include "gevector3array.h"
+#include "gebaseutl.h"
+
+#include <cassert>
+#include <limits>
+
+//==============================================================================
+// Lazy GeVector3 expressions
+//
+// GeLazy() wraps a vector, or the lanes of a structure-of-arrays container,
+// in an expression. Arithmetic on expressions builds a tree of small value
+// objects instead of computing intermediate vectors; the tree is evaluated
+// component by component when it is converted to a GeVector3 or passed to
+// GeVector3BatchEval, so a + b * s - GeCross(c, d) is one pass without
+// temporaries:
+//
+//     GeVector3<float> r = ge::lazy(a) + ge::lazy(b) * s - ge::cross(ge::lazy(c), d);
+//     GeVector3BatchEval(out.view(), ge::lazy(p) + ge::lazy(v) * dt);
+//
+// Scalars keep the element type T (GeVector3::operator* and dot go through
+// double). Products that feed an addition, the cross product terms and dot
+// products are computed with GeFusedMultiplyAdd, so with GE_HAS_FMA they
+// round once per multiply-add and may differ from the eager GeVector3
+// operators in the last bit; without it they match them exactly.
+//
+// Expressions hold their operands by value (vectors are copied, lanes are
+// views), so one may outlive the temporaries it was built from, but not the
+// containers its lanes point into.
+
+//------------------------------------------------------------------------------
+/**
+    Base of every expression node. E provides
+
+        template <int A> T Get(GeSize i) const;     // component A of element i
+        GeSize Size() const;                        // elements, kBroadcast for single vectors
+*/
+template <typename T, typename E>
+struct GeVector3Expr
+{
+    using value_type = T;
+
+    // Size() of an expression that reads no lanes
+    static constexpr GeSize kBroadcast = std::numeric_limits<GeSize>::max();
+
+    const E& Self() const { return static_cast<const E&>(*this); }
+
+    GeVector3<T> Eval(GeSize i = 0) const
+    {
+        return GeVector3<T>(Self().template Get<0>(i), Self().template Get<1>(i), Self().template Get<2>(i));
+    }
+
+    operator GeVector3<T>() const
+    {
+        return Eval();
+    }
+};
+
+namespace ge
+{
+namespace details
+{
+    template <typename T>
+    struct Identity
+    {
+        using type = T;
+    };
+
+    template <typename T>
+    using NonDeduced = typename Identity<T>::type;
+
+    inline GeSize CommonSize(GeSize a, GeSize b)
+    {
+        return a < b ? a : b;
+    }
+
+    //--------------------------------------------------------------------------
+    // Leaves
+
+    template <typename T>
+    struct Vector3Leaf : GeVector3Expr<T, Vector3Leaf<T>>
+    {
+        GeVector3<T> v;
+
+        explicit Vector3Leaf(const GeVector3<T>& value)
+            : v(value)
+            {}
+
+        template <int A>
+        T Get(GeSize) const
+        {
+            return A == 0 ? v.x : (A == 1 ? v.y : v.z);
+        }
+
+        GeSize Size() const { return GeVector3Expr<T, Vector3Leaf<T>>::kBroadcast; }
+    };
+
+    template <typename T>
+    struct Vector3Lanes : GeVector3Expr<T, Vector3Lanes<T>>
+    {
+        GeVector3ArrayCView<T> lanes;
+
+        explicit Vector3Lanes(GeVector3ArrayCView<T> view)
+            : lanes(view)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const
+        {
+            return A == 0 ? lanes.x[i] : (A == 1 ? lanes.y[i] : lanes.z[i]);
+        }
+
+        GeSize Size() const { return lanes.size; }
+    };
+
+    //--------------------------------------------------------------------------
+    // Nodes
+
+    template <typename T, typename L, typename R>
+    struct Vector3Add : GeVector3Expr<T, Vector3Add<T, L, R>>
+    {
+        L l;
+        R r;
+
+        Vector3Add(const L& left, const R& right)
+            : l(left)
+            , r(right)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return l.template Get<A>(i) + r.template Get<A>(i); }
+
+        GeSize Size() const { return CommonSize(l.Size(), r.Size()); }
+    };
+
+    template <typename T, typename L, typename R>
+    struct Vector3Sub : GeVector3Expr<T, Vector3Sub<T, L, R>>
+    {
+        L l;
+        R r;
+
+        Vector3Sub(const L& left, const R& right)
+            : l(left)
+            , r(right)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return l.template Get<A>(i) - r.template Get<A>(i); }
+
+        GeSize Size() const { return CommonSize(l.Size(), r.Size()); }
+    };
+
+    template <typename T, typename E>
+    struct Vector3Negate : GeVector3Expr<T, Vector3Negate<T, E>>
+    {
+        E e;
+
+        explicit Vector3Negate(const E& operand)
+            : e(operand)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return -e.template Get<A>(i); }
+
+        GeSize Size() const { return e.Size(); }
+    };
+
+    template <typename T, typename E>
+    struct Vector3Scale : GeVector3Expr<T, Vector3Scale<T, E>>
+    {
+        E e;
+        T s;
+
+        Vector3Scale(const E& operand, T scalar)
+            : e(operand)
+            , s(scalar)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return e.template Get<A>(i) * s; }
+
+        GeSize Size() const { return e.Size(); }
+    };
+
+    template <typename T, typename E>
+    struct Vector3Divide : GeVector3Expr<T, Vector3Divide<T, E>>
+    {
+        E e;
+        T s;
+
+        Vector3Divide(const E& operand, T scalar)
+            : e(operand)
+            , s(scalar)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return e.template Get<A>(i) / s; }
+
+        GeSize Size() const { return e.Size(); }
+    };
+
+    // e * s + c with a single rounding where FMA is available
+    template <typename T, typename E, typename C>
+    struct Vector3MulAdd : GeVector3Expr<T, Vector3MulAdd<T, E, C>>
+    {
+        E e;
+        T s;
+        C c;
+
+        Vector3MulAdd(const E& operand, T scalar, const C& addend)
+            : e(operand)
+            , s(scalar)
+            , c(addend)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const { return GeFusedMultiplyAdd(e.template Get<A>(i), s, c.template Get<A>(i)); }
+
+        GeSize Size() const { return CommonSize(e.Size(), c.Size()); }
+    };
+
+    template <typename T, typename L, typename R>
+    struct Vector3Cross : GeVector3Expr<T, Vector3Cross<T, L, R>>
+    {
+        L l;
+        R r;
+
+        Vector3Cross(const L& left, const R& right)
+            : l(left)
+            , r(right)
+            {}
+
+        template <int A>
+        T Get(GeSize i) const
+        {
+            constexpr int kB = (A + 1) % 3;
+            constexpr int kC = (A + 2) % 3;
+            return GeFusedMultiplyAdd(l.template Get<kB>(i), r.template Get<kC>(i),
+                                      -(l.template Get<kC>(i) * r.template Get<kB>(i)));
+        }
+
+        GeSize Size() const { return CommonSize(l.Size(), r.Size()); }
+    };
+
+    template <typename T, typename L, typename R>
+    T Dot(const L& l, const R& r, GeSize i)
+    {
+        const T xx = l.template Get<0>(i) * r.template Get<0>(i);
+        const T xy = GeFusedMultiplyAdd(l.template Get<1>(i), r.template Get<1>(i), xx);
+        return GeFusedMultiplyAdd(l.template Get<2>(i), r.template Get<2>(i), xy);
+    }
+} // end of details
+} // end of ge
+
+//==============================================================================
+// Building expressions
+
+template <typename T>
+inline ge::details::Vector3Leaf<T> GeLazy(const GeVector3<T>& v)
+{
+    return ge::details::Vector3Leaf<T>(v);
+}
+
+template <typename T>
+inline ge::details::Vector3Lanes<T> GeLazy(GeVector3ArrayCView<T> lanes)
+{
+    return ge::details::Vector3Lanes<T>(lanes);
+}
+
+template <typename T>
+inline ge::details::Vector3Lanes<T> GeLazy(GeVector3ArrayView<T> lanes)
+{
+    return ge::details::Vector3Lanes<T>(lanes);
+}
+
+template <typename T, typename Allocator>
+inline ge::details::Vector3Lanes<T> GeLazy(const GeVector3Array<T, Allocator>& lanes)
+{
+    return ge::details::Vector3Lanes<T>(lanes.cview());
+}
+
+//------------------------------------------------------------------------------
+// Sums. A scaled operand is folded into a multiply-add.
+
+template <typename T, typename L, typename R>
+inline ge::details::Vector3Add<T, L, R> operator+(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, R>& r)
+{
+    return ge::details::Vector3Add<T, L, R>(l.Self(), r.Self());
+}
+
+template <typename T, typename L, typename E>
+inline ge::details::Vector3MulAdd<T, E, L> operator+(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, L>(r.Self().e, r.Self().s, l.Self());
+}
+
+template <typename T, typename E, typename R>
+inline ge::details::Vector3MulAdd<T, E, R> operator+(const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& l, const GeVector3Expr<T, R>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, R>(l.Self().e, l.Self().s, r.Self());
+}
+
+template <typename T, typename E, typename F>
+inline ge::details::Vector3MulAdd<T, E, ge::details::Vector3Scale<T, F>>
+operator+(const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& l, const GeVector3Expr<T, ge::details::Vector3Scale<T, F>>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, ge::details::Vector3Scale<T, F>>(l.Self().e, l.Self().s, r.Self());
+}
+
+template <typename T, typename L, typename R>
+inline ge::details::Vector3Sub<T, L, R> operator-(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, R>& r)
+{
+    return ge::details::Vector3Sub<T, L, R>(l.Self(), r.Self());
+}
+
+template <typename T, typename L, typename E>
+inline ge::details::Vector3MulAdd<T, E, L> operator-(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, L>(r.Self().e, -r.Self().s, l.Self());
+}
+
+template <typename T, typename E, typename R>
+inline ge::details::Vector3MulAdd<T, E, ge::details::Vector3Negate<T, R>>
+operator-(const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& l, const GeVector3Expr<T, R>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, ge::details::Vector3Negate<T, R>>(
+        l.Self().e, l.Self().s, ge::details::Vector3Negate<T, R>(r.Self()));
+}
+
+template <typename T, typename E, typename F>
+inline ge::details::Vector3MulAdd<T, E, ge::details::Vector3Scale<T, F>>
+operator-(const GeVector3Expr<T, ge::details::Vector3Scale<T, E>>& l, const GeVector3Expr<T, ge::details::Vector3Scale<T, F>>& r)
+{
+    return ge::details::Vector3MulAdd<T, E, ge::details::Vector3Scale<T, F>>(
+        l.Self().e, l.Self().s, ge::details::Vector3Scale<T, F>(r.Self().e, -r.Self().s));
+}
+
+// mixed with plain vectors
+
+template <typename T, typename R>
+inline auto operator+(const GeVector3<T>& l, const GeVector3Expr<T, R>& r)
+{
+    return GeLazy(l) + r;
+}
+
+template <typename T, typename L>
+inline auto operator+(const GeVector3Expr<T, L>& l, const GeVector3<T>& r)
+{
+    return l + GeLazy(r);
+}
+
+template <typename T, typename R>
+inline auto operator-(const GeVector3<T>& l, const GeVector3Expr<T, R>& r)
+{
+    return GeLazy(l) - r;
+}
+
+template <typename T, typename L>
+inline auto operator-(const GeVector3Expr<T, L>& l, const GeVector3<T>& r)
+{
+    return l - GeLazy(r);
+}
+
+//------------------------------------------------------------------------------
+// Negation and scaling
+
+template <typename T, typename E>
+inline ge::details::Vector3Negate<T, E> operator-(const GeVector3Expr<T, E>& e)
+{
+    return ge::details::Vector3Negate<T, E>(e.Self());
+}
+
+template <typename T, typename E>
+inline ge::details::Vector3Scale<T, E> operator*(const GeVector3Expr<T, E>& e, ge::details::NonDeduced<T> s)
+{
+    return ge::details::Vector3Scale<T, E>(e.Self(), s);
+}
+
+template <typename T, typename E>
+inline ge::details::Vector3Scale<T, E> operator*(ge::details::NonDeduced<T> s, const GeVector3Expr<T, E>& e)
+{
+    return ge::details::Vector3Scale<T, E>(e.Self(), s);
+}
+
+template <typename T, typename E>
+inline ge::details::Vector3Divide<T, E> operator/(const GeVector3Expr<T, E>& e, ge::details::NonDeduced<T> s)
+{
+    return ge::details::Vector3Divide<T, E>(e.Self(), s);
+}
+
+//------------------------------------------------------------------------------
+// Cross and dot products
+
+template <typename T, typename L, typename R>
+inline ge::details::Vector3Cross<T, L, R> GeCross(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, R>& r)
+{
+    return ge::details::Vector3Cross<T, L, R>(l.Self(), r.Self());
+}
+
+template <typename T, typename R>
+inline auto GeCross(const GeVector3<T>& l, const GeVector3Expr<T, R>& r)
+{
+    return GeCross(GeLazy(l), r);
+}
+
+template <typename T, typename L>
+inline auto GeCross(const GeVector3Expr<T, L>& l, const GeVector3<T>& r)
+{
+    return GeCross(l, GeLazy(r));
+}
+
+//------------------------------------------------------------------------------
+/**
+    Dot product of element i (0 for single vectors), in T.
+*/
+template <typename T, typename L, typename R>
+inline T GeDot(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, R>& r, GeSize i = 0)
+{
+    return ge::details::Dot<T>(l.Self(), r.Self(), i);
+}
+
+template <typename T, typename R>
+inline T GeDot(const GeVector3<T>& l, const GeVector3Expr<T, R>& r, GeSize i = 0)
+{
+    return GeDot(GeLazy(l), r, i);
+}
+
+template <typename T, typename L>
+inline T GeDot(const GeVector3Expr<T, L>& l, const GeVector3<T>& r, GeSize i = 0)
+{
+    return GeDot(l, GeLazy(r), i);
+}
+
+//==============================================================================
+// Evaluating over structure-of-arrays containers
+
+//------------------------------------------------------------------------------
+/**
+    Writes element i of e to out for every i < out.size; vectors in e are
+    broadcast. out may be one of the lanes e reads: each element is read
+    completely before it is written.
+*/
+template <typename T, typename E>
+void GeVector3BatchEval(GeVector3ArrayView<T> out, const GeVector3Expr<T, E>& e)
+{
+    const E& expr = e.Self();
+    assert(out.size <= expr.Size());
+
+    // Blocks are evaluated into locals, which cannot alias the lanes, with a
+    // fixed trip count, so the compiler vectorizes the inner loops
+    constexpr GeSize kBlock = 16;
+    T x[kBlock];
+    T y[kBlock];
+    T z[kBlock];
+    GeSize i = 0;
+    for (; i + kBlock <= out.size; i += kBlock)
+    {
+        for (GeSize j = 0; j < kBlock; ++j)
+        {
+            x[j] = expr.template Get<0>(i + j);
+            y[j] = expr.template Get<1>(i + j);
+            z[j] = expr.template Get<2>(i + j);
+        }
+        for (GeSize j = 0; j < kBlock; ++j)
+        {
+            out.x[i + j] = x[j];
+            out.y[i + j] = y[j];
+            out.z[i + j] = z[j];
+        }
+    }
+    for (; i < out.size; ++i)
+    {
+        const GeVector3<T> v = expr.Eval(i);
+        out.x[i] = v.x;
+        out.y[i] = v.y;
+        out.z[i] = v.z;
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+    Resizes out to the size of e, which must read at least one lane, and
+    evaluates e into it.
+*/
+template <typename T, typename E, typename Allocator>
+void GeVector3BatchEval(GeVector3Array<T, Allocator>& out, const GeVector3Expr<T, E>& e)
+{
+    assert((e.Self().Size() != GeVector3Expr<T, E>::kBroadcast));
+    out.resize(e.Self().Size());
+    GeVector3BatchEval(out.view(), e);
+}
+
+//------------------------------------------------------------------------------
+/**
+    out[i] = GeDot(l, r, i) for every element of the lanes l and r read.
+*/
+template <typename T, typename L, typename R>
+void GeVector3BatchEvalDot(const GeVector3Expr<T, L>& l, const GeVector3Expr<T, R>& r, T* out)
+{
+    const GeSize n = ge::details::CommonSize(l.Self().Size(), r.Self().Size());
+    assert((n != GeVector3Expr<T, L>::kBroadcast));
+    for (GeSize i = 0; i < n; ++i)
+    {
+        out[i] = ge::details::Dot<T>(l.Self(), r.Self(), i);
+    }
+}
+
+namespace ge
+{
+    template <typename T>
+    inline auto lazy(const GeVector3<T>& v)
+    {
+        return GeLazy(v);
+    }
+
+    template <typename T, typename Allocator>
+    inline auto lazy(const GeVector3Array<T, Allocator>& lanes)
+    {
+        return GeLazy(lanes);
+    }
+
+    template <typename T>
+    inline auto lazy(GeVector3ArrayCView<T> lanes)
+    {
+        return GeLazy(lanes);
+    }
+
+    template <typename A, typename B>
+    inline auto cross(const A& a, const B& b)
+    {
+        return GeCross(a, b);
+    }
+
+    template <typename A, typename B>
+    inline auto dot(const A& a, const B& b)
+    {
+        return GeDot(a, b);
+    }
+
+    template <typename T, typename E>
+    inline GeVector3<T> eval(const GeVector3Expr<T, E>& e)
+    {
+        return e.Eval();
+    }
+
+    template <typename T, typename E, typename Allocator>
+    inline void batch_eval(GeVector3Array<T, Allocator>& out, const GeVector3Expr<T, E>& e)
+    {
+        GeVector3BatchEval(out, e);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_VECTOR3EXPR_H
@@ -0,0 +1,510 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_VECTOR3HASH_H
+#define GEOMUTILS_VECTOR3HASH_H
+
+#include "gevector3.h"
+#include "gerealutl.h"
+#include "gespan.h"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//==============================================================================
+// Tolerance
+
+//------------------------------------------------------------------------------
+/**
+    How two GeVector3 keys match: every coordinate pair GeRealEqual with
+    tol, or GeIsRealEqualByUlps with tolInUlps.
+*/
+template <typename T>
+struct GeVector3Tolerance
+{
+    GeVector3Tolerance(T relative = GeDefaultEpsilon<T>::Value())
+        : tol{relative}
+        {}
+
+    static GeVector3Tolerance Ulps(GeInt32 tolInUlps)
+    {
+        GeVector3Tolerance tolerance(0);
+        tolerance.byUlps = true;
+        tolerance.tolInUlps = tolInUlps;
+        return tolerance;
+    }
+
+    bool Equal(const GeVector3<T>& a, const GeVector3<T>& b) const
+    {
+        if (byUlps)
+        {
+            return GeIsRealEqualByUlps(a.x, b.x, tolInUlps) &&
+                   GeIsRealEqualByUlps(a.y, b.y, tolInUlps) &&
+                   GeIsRealEqualByUlps(a.z, b.z, tolInUlps);
+        }
+        return GeRealEqual(a.x, b.x, tol) && GeRealEqual(a.y, b.y, tol) && GeRealEqual(a.z, b.z, tol);
+    }
+
+    T tol = 0;                          // relative tolerance, in [0, 0.5)
+    GeInt32 tolInUlps = 0;              // used when byUlps is set
+    bool byUlps = false;
+};
+
+namespace ge
+{
+namespace details
+{
+namespace vector3hash
+{
+    //--------------------------------------------------------------------------
+    // Keys are gridded in the sortable-integer domain of each coordinate
+    // (RealBits::ToSortable), where the distance of two values is their
+    // distance in ULPs. Two coordinates equal under the tolerance are at
+    // most kReach ULPs apart:
+    //
+    // - ULP mode (near zero, or a tiny relative tolerance): 1 ULP, and
+    //   -0/+0 are adjacent.
+    // - Relative mode: |a - b| <= tol * max(|a|, |b|) needs the same sign
+    //   for tol < 1, and spans less than tol * 2^(digits + 1) ULPs when the
+    //   pair straddles a binade, where the lower ULP is half the upper one.
+    //
+    // Cells are a power of two of at least four reaches, so most keys sit
+    // farther than a reach from both borders and probe a single cell.
+
+    const GeUint32 kEmpty = ~GeUint32(0);
+
+    struct Slot
+    {
+        GeUint32 tag;                   // high half of the cell hash
+        GeUint32 index;                 // position of the entry, kEmpty if free
+    };
+
+    inline GeUint64 Mix(GeUint64 h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    inline GeUint64 HashCell(GeUint64 x, GeUint64 y, GeUint64 z)
+    {
+        return Mix(Mix(Mix(x) ^ y) ^ z);
+    }
+
+    struct Cell
+    {
+        GeUint64 c[3];
+        int lo[3];                      // first neighbour offset to visit, -1 or 0
+        int hi[3];                      // last neighbour offset to visit, 0 or 1
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+        Open-addressed index over a dense key array. Each key is filed under
+        the hash of its cell with linear probing, so the slots of one cell
+        form a run of 8-byte entries that ends at the first free slot; keys
+        themselves stay in insertion order, compact for iteration. Removal
+        uses backward-shift deletion, so no tombstones accumulate.
+    */
+    template <typename T>
+    class Table
+    {
+        using Bits = RealBits<T>;
+
+    public:
+        static constexpr GeSize kNotFound = ~GeSize(0);
+
+        explicit Table(const GeVector3Tolerance<T>& tolerance)
+            : m_tolerance{tolerance}
+        {
+            GeUint64 reach = 1;
+            if (tolerance.byUlps)
+            {
+                assert(tolerance.tolInUlps >= 0);
+                reach = tolerance.tolInUlps > 1 ? GeUint64(tolerance.tolInUlps) : 1;
+            }
+            else
+            {
+                assert(tolerance.tol >= 0 && tolerance.tol < T(0.5));
+                // one ULP of slack for the rounding of tol * max
+                const double ulps = std::ldexp(double(tolerance.tol), std::numeric_limits<T>::digits + 1);
+                reach = static_cast<GeUint64>(std::ceil(ulps)) + 1;
+            }
+            m_shift = 2;
+            while ((GeUint64(1) << m_shift) < reach * 4)
+                ++m_shift;
+            m_reach = reach;
+        }
+
+        GeSize Size() const { return m_keys.size(); }
+
+        const GeVector3Tolerance<T>& Tolerance() const { return m_tolerance; }
+
+        const std::vector<GeVector3<T>>& Keys() const { return m_keys; }
+
+        void Reserve(GeSize count)
+        {
+            m_keys.reserve(count);
+            m_hashes.reserve(count);
+            if (count * 2 > m_slots.size())
+                Rehash(count);
+        }
+
+        void Clear()
+        {
+            m_keys.clear();
+            m_hashes.clear();
+            for (Slot& slot : m_slots)
+                slot.index = kEmpty;
+        }
+
+        //----------------------------------------------------------------------
+        /**
+            @return the lowest position whose key equals key, or kNotFound;
+            non-finite keys never match
+        */
+        GeSize Find(const GeVector3<T>& key) const
+        {
+            if (m_keys.empty() || !IsFinite(key))
+                return kNotFound;
+
+            const Cell cell = Locate(key);
+            GeSize found = kNotFound;
+            for (int dz = cell.lo[2]; dz <= cell.hi[2]; ++dz)
+            {
+                for (int dy = cell.lo[1]; dy <= cell.hi[1]; ++dy)
+                {
+                    for (int dx = cell.lo[0]; dx <= cell.hi[0]; ++dx)
+                    {
+                        const GeUint64 hash = HashCell(cell.c[0] + dx, cell.c[1] + dy, cell.c[2] + dz);
+                        const GeUint32 tag = static_cast<GeUint32>(hash >> 32);
+                        for (GeSize s = hash & m_mask; m_slots[s].index != kEmpty; s = (s + 1) & m_mask)
+                        {
+                            const Slot slot = m_slots[s];
+                            if (slot.tag == tag && slot.index < found && m_tolerance.Equal(m_keys[slot.index], key))
+                                found = slot.index;
+                        }
+                    }
+                }
+            }
+            return found;
+        }
+
+        //----------------------------------------------------------------------
+        /**
+            Appends key unless an equal key is stored.
+
+            @return the position of key or of the equal key (as Find), and
+            whether key was appended; non-finite keys are rejected with
+            {kNotFound, false}
+        */
+        std::pair<GeSize, bool> Insert(const GeVector3<T>& key)
+        {
+            if (!IsFinite(key))
+                return {kNotFound, false};
+
+            const GeSize found = Find(key);
+            if (found != kNotFound)
+                return {found, false};
+
+            assert(m_keys.size() < kEmpty);
+            if ((m_keys.size() + 1) * 2 > m_slots.size())
+                Rehash(m_keys.size() + 1);
+
+            const Cell cell = Locate(key);
+            const GeUint64 hash = HashCell(cell.c[0], cell.c[1], cell.c[2]);
+            const GeSize position = m_keys.size();
+            m_keys.push_back(key);
+            m_hashes.push_back(hash);
+            Place(hash, static_cast<GeUint32>(position));
+            return {position, true};
+        }
+
+        //----------------------------------------------------------------------
+        /**
+            Removes the entry at position; the last entry moves into it.
+
+            @return the former position of the moved entry (the last one)
+        */
+        GeSize Erase(GeSize position)
+        {
+            assert(position < m_keys.size());
+            const GeSize last = m_keys.size() - 1;
+
+            GeSize hole = SlotOf(position);
+            for (GeSize next = (hole + 1) & m_mask; m_slots[next].index != kEmpty; next = (next + 1) & m_mask)
+            {
+                // an entry may fill the hole unless its home lies cyclically in (hole, next]
+                const GeSize home = m_hashes[m_slots[next].index] & m_mask;
+                if (((next - home) & m_mask) >= ((next - hole) & m_mask))
+                {
+                    m_slots[hole] = m_slots[next];
+                    hole = next;
+                }
+            }
+            m_slots[hole].index = kEmpty;
+
+            if (position != last)
+            {
+                m_slots[SlotOf(last)].index = static_cast<GeUint32>(position);
+                m_keys[position] = m_keys[last];
+                m_hashes[position] = m_hashes[last];
+            }
+            m_keys.pop_back();
+            m_hashes.pop_back();
+            return last;
+        }
+
+    private:
+        static bool IsFinite(const GeVector3<T>& v)
+        {
+            return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+        }
+
+        Cell Locate(const GeVector3<T>& v) const
+        {
+            const GeUint64 mask = (GeUint64(1) << m_shift) - 1;
+            const GeUint64 keys[3] = {Bits::ToSortable(v.x), Bits::ToSortable(v.y), Bits::ToSortable(v.z)};
+            Cell cell;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const GeUint64 offset = keys[axis] & mask;
+                cell.c[axis] = keys[axis] >> m_shift;
+                cell.lo[axis] = offset < m_reach ? -1 : 0;
+                cell.hi[axis] = offset + m_reach > mask ? 1 : 0;
+            }
+            return cell;
+        }
+
+        GeSize SlotOf(GeSize position) const
+        {
+            GeSize s = m_hashes[position] & m_mask;
+            while (m_slots[s].index != position)
+                s = (s + 1) & m_mask;
+            return s;
+        }
+
+        void Place(GeUint64 hash, GeUint32 index)
+        {
+            GeSize s = hash & m_mask;
+            while (m_slots[s].index != kEmpty)
+                s = (s + 1) & m_mask;
+            m_slots[s] = {static_cast<GeUint32>(hash >> 32), index};
+        }
+
+        void Rehash(GeSize count)
+        {
+            GeSize capacity = 16;
+            while (capacity < count * 2)
+                capacity *= 2;
+            m_slots.assign(capacity, Slot{0, kEmpty});
+            m_mask = capacity - 1;
+            for (GeSize i = 0; i < m_keys.size(); ++i)
+                Place(m_hashes[i], static_cast<GeUint32>(i));
+        }
+
+        GeVector3Tolerance<T> m_tolerance;
+        GeUint64 m_reach = 1;           // largest ULP distance of equal coordinates
+        int m_shift = 2;                // log2 of the cell width in ULPs
+        GeSize m_mask = 0;
+        std::vector<Slot> m_slots;
+        std::vector<GeVector3<T>> m_keys;
+        std::vector<GeUint64> m_hashes; // cell hash of each key, for rehash and erase
+    };
+
+} // end of vector3hash
+} // end of details
+} // end of ge
+
+//==============================================================================
+// Hash set / map
+
+//------------------------------------------------------------------------------
+/**
+    Set of GeVector3 keys matched within a tolerance (GeVector3Tolerance).
+
+    Keys are hashed on a grid sized from the tolerance and a lookup probes
+    the neighbouring cells it may reach, then confirms candidates with the
+    tolerant comparison: O(1) expected, whatever the magnitude of the keys.
+    As tolerant equality is not transitive, a key may match several stored
+    keys; the lowest position wins, which is the earliest insertion as long
+    as nothing was erased. Keys with a non-finite coordinate are never
+    stored.
+
+    Keys are kept dense in insertion order: a position stays valid until
+    an erase, which moves the last key into the freed position.
+*/
+template <typename T>
+class GeVector3HashSet
+{
+    using Table = ge::details::vector3hash::Table<T>;
+
+public:
+    static constexpr GeSize kNotFound = Table::kNotFound;
+
+    explicit GeVector3HashSet(const GeVector3Tolerance<T>& tolerance = GeVector3Tolerance<T>())
+        : m_table{tolerance}
+        {}
+
+    GeSize Size() const { return m_table.Size(); }
+    bool Empty() const { return m_table.Size() == 0; }
+    const GeVector3Tolerance<T>& Tolerance() const { return m_table.Tolerance(); }
+
+    void Reserve(GeSize count) { m_table.Reserve(count); }
+    void Clear() { m_table.Clear(); }
+
+    // @return the position of the matching key, or kNotFound
+    GeSize Find(const GeVector3<T>& key) const { return m_table.Find(key); }
+    bool Contains(const GeVector3<T>& key) const { return m_table.Find(key) != kNotFound; }
+
+    // @return the position of key or of its match, and whether key was added
+    std::pair<GeSize, bool> Insert(const GeVector3<T>& key) { return m_table.Insert(key); }
+
+    // @return whether a matching key was removed
+    bool Erase(const GeVector3<T>& key)
+    {
+        const GeSize position = m_table.Find(key);
+        if (position == kNotFound)
+            return false;
+        m_table.Erase(position);
+        return true;
+    }
+
+    const GeVector3<T>& Key(GeSize position) const { return m_table.Keys()[position]; }
+    GeSpan<const GeVector3<T>> Keys() const { return GeSpan<const GeVector3<T>>(m_table.Keys()); }
+
+private:
+    Table m_table;
+};
+
+//------------------------------------------------------------------------------
+/**
+    Map from GeVector3 keys matched within a tolerance to values of type V;
+    lookup, ordering and positions are those of GeVector3HashSet. Values
+    are stored densely alongside the keys.
+*/
+template <typename T, typename V>
+class GeVector3HashMap
+{
+    using Table = ge::details::vector3hash::Table<T>;
+
+public:
+    static constexpr GeSize kNotFound = Table::kNotFound;
+
+    explicit GeVector3HashMap(const GeVector3Tolerance<T>& tolerance = GeVector3Tolerance<T>())
+        : m_table{tolerance}
+        {}
+
+    GeSize Size() const { return m_table.Size(); }
+    bool Empty() const { return m_table.Size() == 0; }
+    const GeVector3Tolerance<T>& Tolerance() const { return m_table.Tolerance(); }
+
+    void Reserve(GeSize count)
+    {
+        m_table.Reserve(count);
+        m_values.reserve(count);
+    }
+
+    void Clear()
+    {
+        m_table.Clear();
+        m_values.clear();
+    }
+
+    // @return the position of the matching key, or kNotFound
+    GeSize Find(const GeVector3<T>& key) const { return m_table.Find(key); }
+    bool Contains(const GeVector3<T>& key) const { return m_table.Find(key) != kNotFound; }
+
+    // @return the value of the matching key, or nullptr
+    V* FindValue(const GeVector3<T>& key)
+    {
+        const GeSize position = m_table.Find(key);
+        return position != kNotFound ? &m_values[position] : nullptr;
+    }
+
+    const V* FindValue(const GeVector3<T>& key) const
+    {
+        const GeSize position = m_table.Find(key);
+        return position != kNotFound ? &m_values[position] : nullptr;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Adds key with value unless a matching key is stored, whose value is
+        then left unchanged.
+
+        @return the position of key or of its match, and whether key was added
+    */
+    std::pair<GeSize, bool> Insert(const GeVector3<T>& key, V value)
+    {
+        const std::pair<GeSize, bool> result = m_table.Insert(key);
+        if (result.second)
+            m_values.push_back(std::move(value));
+        return result;
+    }
+
+    // @return whether a matching key was removed
+    bool Erase(const GeVector3<T>& key)
+    {
+        const GeSize position = m_table.Find(key);
+        if (position == kNotFound)
+            return false;
+        const GeSize moved = m_table.Erase(position);
+        if (moved != position)
+            m_values[position] = std::move(m_values[moved]);
+        m_values.pop_back();
+        return true;
+    }
+
+    const GeVector3<T>& Key(GeSize position) const { return m_table.Keys()[position]; }
+    V& Value(GeSize position) { return m_values[position]; }
+    const V& Value(GeSize position) const { return m_values[position]; }
+
+    GeSpan<const GeVector3<T>> Keys() const { return GeSpan<const GeVector3<T>>(m_table.Keys()); }
+    GeSpan<V> Values() { return GeSpan<V>(m_values); }
+    GeSpan<const V> Values() const { return GeSpan<const V>(m_values); }
+
+private:
+    Table m_table;
+    std::vector<V> m_values;
+};
+
+namespace ge
+{
+    template <typename T>
+    using vector3_tolerance = GeVector3Tolerance<T>;
+
+    template <typename T>
+    using vector3_hash_set = GeVector3HashSet<T>;
+
+    template <typename T, typename V>
+    using vector3_hash_map = GeVector3HashMap<T, V>;
+} // eof ge
+
+#endif // GEOMUTILS_VECTOR3HASH_H
@@ -0,0 +1,223 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_VECTOR3REDUCE_H
+#define GEOMUTILS_VECTOR3REDUCE_H
+
+#include "gevector3array.h"
+#include "gearena.h"
+#include "geaabb.h"
+#include "gebaseutl.h"
+#include "gerealutl.h"
+
+#include <limits>
+
+//==============================================================================
+// Reductions over structure-of-arrays vectors
+//
+// The GeReal32/GeReal64 versions split the input into fixed-size blocks,
+// reduce each block with the SIMD kernels and combine the block results in
+// block order. The block layout does not depend on the thread count, so
+// neither do the results.
+
+//------------------------------------------------------------------------------
+/**
+    Reduction parameters.
+*/
+struct GeReduceOptions
+{
+    bool parallel = true;               // reduce blocks on worker threads
+    GeSize grainSize = 1 << 16;         // smallest chunk handed to a worker
+    GeArena* pArena = nullptr;          // per-block partials; the heap when null
+};
+
+//------------------------------------------------------------------------------
+/**
+    Bounding box of the points, as if each were passed to GeAabb3::Expand:
+    NaN components are skipped and an empty input gives an empty box.
+*/
+template <typename T>
+GeAabb3<T> GeVector3BatchBounds(GeVector3ArrayCView<T> a, const GeReduceOptions& options = GeReduceOptions())
+{
+    (void)options;
+    GeAabb3<T> box;
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        box.Expand(a[i]);
+    }
+    return box;
+}
+
+template <>
+GeAabb3<GeReal32> GeVector3BatchBounds<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeReduceOptions& options);
+
+template <>
+GeAabb3<GeReal64> GeVector3BatchBounds<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeReduceOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Mean of the points; (0, 0, 0) for an empty input. Partial sums are
+    carried in double, except that the GeReal32 specialization sums blocks
+    of 4096 points in float and adds the block sums in double.
+*/
+template <typename T>
+GeVector3<T> GeVector3BatchCentroid(GeVector3ArrayCView<T> a, const GeReduceOptions& options = GeReduceOptions())
+{
+    (void)options;
+    if (a.size == 0)
+        return GeVector3<T>();
+
+    double sum[3] = {0.0, 0.0, 0.0};
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        sum[0] += a.x[i];
+        sum[1] += a.y[i];
+        sum[2] += a.z[i];
+    }
+    const double n = static_cast<double>(a.size);
+    return GeVector3<T>(static_cast<T>(sum[0] / n), static_cast<T>(sum[1] / n), static_cast<T>(sum[2] / n));
+}
+
+template <>
+GeVector3<GeReal32> GeVector3BatchCentroid<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeReduceOptions& options);
+
+template <>
+GeVector3<GeReal64> GeVector3BatchCentroid<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeReduceOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Per-axis tolerant minimum and maximum. For each axis the exact extreme
+    m is found first (NaN skipped); the value reported is the first element
+    in index order that is GeRealEqual to m with tol. This is what folding
+    GeRealMin(a[i], acc, tol) / GeRealMax(a[i], acc, tol) in index order
+    returns whenever the elements tolerantly equal to the extreme are also
+    equal to each other, but it cannot drift along a chain of near-equal
+    values and it does not depend on how the input is split.
+
+    @return false (outputs untouched) when an axis has no non-NaN value
+*/
+template <typename T>
+bool GeVector3BatchRealMinMax(GeVector3ArrayCView<T> a, T tol, GeVector3<T>& outMin, GeVector3<T>& outMax,
+                              const GeReduceOptions& options = GeReduceOptions())
+{
+    const GeAabb3<T> box = GeVector3BatchBounds<T>(a, options);
+    if (box.IsEmpty())
+        return false;
+
+    const T* lanes[3] = {a.x, a.y, a.z};
+    const T exact[6] = {box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z};
+    T found[6];
+    for (int k = 0; k < 6; ++k)
+    {
+        found[k] = exact[k];
+        for (GeSize i = 0; i < a.size; ++i)
+        {
+            if (GeRealEqual(lanes[k % 3][i], exact[k], tol))
+            {
+                found[k] = lanes[k % 3][i];
+                break;
+            }
+        }
+    }
+    outMin = GeVector3<T>(found[0], found[1], found[2]);
+    outMax = GeVector3<T>(found[3], found[4], found[5]);
+    return true;
+}
+
+template <>
+bool GeVector3BatchRealMinMax<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32 tol,
+                                        GeVector3<GeReal32>& outMin, GeVector3<GeReal32>& outMax,
+                                        const GeReduceOptions& options);
+
+template <>
+bool GeVector3BatchRealMinMax<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64 tol,
+                                        GeVector3<GeReal64>& outMin, GeVector3<GeReal64>& outMax,
+                                        const GeReduceOptions& options);
+
+//------------------------------------------------------------------------------
+/**
+    Index of the point furthest along direction: the largest
+    x * d.x + y * d.y + z * d.z, evaluated in T in that order. Ties go to
+    the lowest index and NaN products are skipped.
+
+    @return a.size when the input is empty or every product is NaN
+*/
+template <typename T>
+GeSize GeVector3BatchExtreme(GeVector3ArrayCView<T> a, const GeVector3<T>& direction,
+                             const GeReduceOptions& options = GeReduceOptions())
+{
+    (void)options;
+    GeSize best = a.size;
+    T bestDot = -std::numeric_limits<T>::infinity();
+    for (GeSize i = 0; i < a.size; ++i)
+    {
+        const T d = a.x[i] * direction.x + a.y[i] * direction.y + a.z[i] * direction.z;
+        if (d > bestDot || (best == a.size && d == bestDot))
+        {
+            best = i;
+            bestDot = d;
+        }
+    }
+    return best;
+}
+
+template <>
+GeSize GeVector3BatchExtreme<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeVector3<GeReal32>& direction,
+                                       const GeReduceOptions& options);
+
+template <>
+GeSize GeVector3BatchExtreme<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeVector3<GeReal64>& direction,
+                                       const GeReduceOptions& options);
+
+namespace ge
+{
+    using reduce_options = GeReduceOptions;
+
+    template <typename T, typename Allocator>
+    inline GeAabb3<T> batch_bounds(const GeVector3Array<T, Allocator>& a, const GeReduceOptions& options = GeReduceOptions())
+    {
+        return GeVector3BatchBounds<T>(a.cview(), options);
+    }
+
+    template <typename T, typename Allocator>
+    inline GeVector3<T> batch_centroid(const GeVector3Array<T, Allocator>& a, const GeReduceOptions& options = GeReduceOptions())
+    {
+        return GeVector3BatchCentroid<T>(a.cview(), options);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool batch_min_max(const GeVector3Array<T, Allocator>& a, T tol, GeVector3<T>& outMin, GeVector3<T>& outMax,
+                              const GeReduceOptions& options = GeReduceOptions())
+    {
+        return GeVector3BatchRealMinMax<T>(a.cview(), tol, outMin, outMax, options);
+    }
+
+    template <typename T, typename Allocator>
+    inline size_t batch_extreme(const GeVector3Array<T, Allocator>& a, const GeVector3<T>& direction,
+                                const GeReduceOptions& options = GeReduceOptions())
+    {
+        return GeVector3BatchExtreme<T>(a.cview(), direction, options);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_VECTOR3REDUCE_H
@@ -0,0 +1,87 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_WELD_H
+#define GEOMUTILS_WELD_H
+
+#include "gevector3.h"
+#include "gespan.h"
+
+#include <vector>
+
+//------------------------------------------------------------------------------
+/**
+    GeWeldVertices parameters.
+*/
+struct GeWeldOptions
+{
+    bool parallel = true;               // hash and search on worker threads
+    GeSize grainSize = 1 << 16;         // smallest chunk handed to a worker
+};
+
+//------------------------------------------------------------------------------
+/**
+    Merges vertices whose three coordinates are pairwise GeRealEqual with tol.
+
+    The result is the one of the sequential pairwise loop: vertices are
+    visited in index order and each one is mapped to the lowest-index
+    earlier unique vertex equal to it, or becomes unique itself. Positions
+    are hashed into a grid of cells no smaller than the tolerance at the
+    largest coordinate, so only neighbouring cells are compared; hashing
+    and the neighbour search run in parallel and the outcome does not
+    depend on the thread count. Vertices with a non-finite coordinate are
+    never merged.
+
+    @param remap receives, for every input vertex, its index in unique
+    @param unique receives the unique vertices in order of first appearance
+    @return number of unique vertices
+*/
+template <typename T>
+GeSize GeWeldVertices(GeSpan<const GeVector3<T>> vertices, T tol,
+                      std::vector<GeUint32>& remap, std::vector<GeVector3<T>>& unique,
+                      const GeWeldOptions& options = GeWeldOptions());
+
+template <>
+GeSize GeWeldVertices<GeReal32>(GeSpan<const GeVector3<GeReal32>> vertices, GeReal32 tol,
+                                std::vector<GeUint32>& remap, std::vector<GeVector3<GeReal32>>& unique,
+                                const GeWeldOptions& options);
+
+template <>
+GeSize GeWeldVertices<GeReal64>(GeSpan<const GeVector3<GeReal64>> vertices, GeReal64 tol,
+                                std::vector<GeUint32>& remap, std::vector<GeVector3<GeReal64>>& unique,
+                                const GeWeldOptions& options);
+
+namespace ge
+{
+    using weld_options = GeWeldOptions;
+
+    template <typename T>
+    inline size_t weld_vertices(GeSpan<const GeVector3<T>> vertices, T tol,
+                                std::vector<uint32_t>& remap, std::vector<GeVector3<T>>& unique,
+                                const GeWeldOptions& options = GeWeldOptions())
+    {
+        return GeWeldVertices<T>(vertices, tol, remap, unique, options);
+    }
+} // eof ge
+
+#endif // GEOMUTILS_WELD_H
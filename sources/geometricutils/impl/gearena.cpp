@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gearena.h"
+
+#include <algorithm>
+
+GeArena::GeArena(GeSize blockSize)
+    : m_blockSize{blockSize}
+{
+}
+
+GeArena::~GeArena()
+{
+    Release();
+}
+
+char* GeArena::NewBlock(GeSize size)
+{
+    return static_cast<char*>(::operator new(size, std::align_val_t{GE_SIMD_ALIGNMENT}));
+}
+
+void GeArena::DeleteBlock(const Block& block)
+{
+    ::operator delete(block.pData, std::align_val_t{GE_SIMD_ALIGNMENT});
+}
+
+void GeArena::Enter(GeSize block)
+{
+    m_block = block;
+    m_cursor = reinterpret_cast<std::uintptr_t>(m_blocks[block].pData);
+    m_end = m_cursor + m_blocks[block].size;
+}
+
+void* GeArena::AllocateSlow(GeSize size, GeSize alignment)
+{
+    // Worst-case padding included, so the request fits wherever the block starts
+    const GeSize need = size + alignment - 1;
+
+    // Blocks kept from earlier rounds come first; those too small are
+    // skipped until the next reset
+    GeSize next = m_end != 0 ? m_block + 1 : 0;
+    while (next < m_blocks.size() && m_blocks[next].size < need)
+        ++next;
+
+    if (next == m_blocks.size())
+    {
+        const GeSize blockSize = std::max(need, m_blocks.empty() ? m_blockSize : 2 * m_blocks.back().size);
+        m_blocks.push_back({NewBlock(blockSize), blockSize});
+    }
+
+    Enter(next);
+    return Allocate(size, alignment);
+}
+
+void GeArena::Rewind(const Marker& marker)
+{
+    if (marker.cursor == 0)
+    {
+        m_block = 0;
+        m_cursor = 0;
+        m_end = 0;
+        return;
+    }
+    assert(marker.block < m_blocks.size());
+    Enter(marker.block);
+    m_cursor = marker.cursor;
+}
+
+void GeArena::Reset()
+{
+    if (m_blocks.size() > 1)
+    {
+        const GeSize total = Capacity();
+        for (const Block& block : m_blocks)
+            DeleteBlock(block);
+        m_blocks.clear();
+        m_blocks.push_back({NewBlock(total), total});
+    }
+    Rewind(Marker());
+}
+
+void GeArena::Release()
+{
+    for (const Block& block : m_blocks)
+        DeleteBlock(block);
+    m_blocks.clear();
+    Rewind(Marker());
+}
+
+GeSize GeArena::Capacity() const
+{
+    GeSize total = 0;
+    for (const Block& block : m_blocks)
+        total += block.size;
+    return total;
+}
+
+GeArena& GeThreadArena()
+{
+    thread_local GeArena s_arena;
+    return s_arena;
+}
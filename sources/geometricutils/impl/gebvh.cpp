@@ -0,0 +1,838 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "gebvh.h"
+#include "geparallel.h"
+#include "gestats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <memory>
+
+namespace ge
+{
+namespace details
+{
+namespace bvh
+{
+    // Deeper than this the builder stops evaluating the SAH and splits at the
+    // median, which bounds the depth for degenerate inputs
+    const GeSize kMaxSahDepth = 64;
+    // Traversal stack entries; a tree at most this many levels deep never
+    // needs more, so the builder turns nodes at the last level into leaves
+    // (with median splits below kMaxSahDepth they hold a single primitive)
+    const GeSize kStackSize = 128;
+    const GeSize kMaxBins = 64;
+
+    template <typename T>
+    inline T Component(const GeVector3<T>& v, int axis)
+    {
+        return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+    }
+
+    template <typename T>
+    inline T Dot(const GeVector3<T>& a, const GeVector3<T>& b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    template <typename T>
+    inline GeVector3<T> Scale(const GeVector3<T>& v, T s)
+    {
+        return GeVector3<T>(v.x * s, v.y * s, v.z * s);
+    }
+
+    //--------------------------------------------------------------------------
+    // Build
+
+    template <typename T>
+    struct BuildPrim
+    {
+        GeAabb3<T> bounds;
+        GeVector3<T> centroid;
+        GeUint32 index;
+    };
+
+    template <typename T>
+    struct BuildNode
+    {
+        GeAabb3<T> bounds;
+        std::unique_ptr<BuildNode> left;
+        std::unique_ptr<BuildNode> right;
+        GeSize first = 0;
+        GeSize count = 0;
+        int axis = 0;
+    };
+
+    template <typename T>
+    class Builder
+    {
+    public:
+        Builder(std::vector<BuildPrim<T>>& prims, const GeBvhBuildOptions& options)
+            : m_prims(prims)
+            , m_maxLeafSize{std::min<GeSize>(std::max<GeSize>(options.maxLeafSize, 1), 0xFFFF)}
+            , m_binCount{std::min(std::max<GeSize>(options.binCount, 2), kMaxBins)}
+            , m_parallel{options.parallel}
+            , m_parallelGrainSize{std::max<GeSize>(options.parallelGrainSize, 2)}
+        {
+            // a couple of levels beyond log2(threads) to balance uneven splits
+            GeSize depth = 0;
+            for (GeSize n = 1; n < GeGetConcurrency(); n *= 2)
+                ++depth;
+            m_parallelDepth = depth + 2;
+        }
+
+        std::unique_ptr<BuildNode<T>> Build()
+        {
+            return BuildRange(0, m_prims.size(), 0);
+        }
+
+        GeSize NodeCount() const { return m_nodeCount.load(); }
+        GeSize Depth() const { return m_depth.load(); }
+
+    private:
+        std::unique_ptr<BuildNode<T>> BuildRange(GeSize begin, GeSize end, GeSize depth)
+        {
+            std::unique_ptr<BuildNode<T>> node(new BuildNode<T>);
+            ++m_nodeCount;
+            GeSize maxDepth = m_depth.load();
+            while (depth + 1 > maxDepth && !m_depth.compare_exchange_weak(maxDepth, depth + 1))
+            {
+            }
+
+            GeAabb3<T> centroidBounds;
+            for (GeSize i = begin; i < end; ++i)
+            {
+                node->bounds.Expand(m_prims[i].bounds);
+                centroidBounds.Expand(m_prims[i].centroid);
+            }
+
+            const GeSize count = end - begin;
+            if (count <= m_maxLeafSize || depth + 1 >= kStackSize)
+            {
+                node->first = begin;
+                node->count = count;
+                return node;
+            }
+
+            const int axis = centroidBounds.LongestAxis();
+            GeSize mid = end;
+            if (depth < kMaxSahDepth && Component(centroidBounds.Extent(), axis) > T(0))
+            {
+                mid = SplitSah(begin, end, centroidBounds, axis);
+            }
+            if (mid == begin || mid == end)
+            {
+                mid = begin + count / 2;
+                std::nth_element(m_prims.begin() + begin, m_prims.begin() + mid, m_prims.begin() + end,
+                                 [axis](const BuildPrim<T>& a, const BuildPrim<T>& b)
+                                 {
+                                     return Component(a.centroid, axis) < Component(b.centroid, axis);
+                                 });
+            }
+            node->axis = axis;
+
+            auto buildLeft = [&]() { node->left = BuildRange(begin, mid, depth + 1); };
+            auto buildRight = [&]() { node->right = BuildRange(mid, end, depth + 1); };
+            if (m_parallel && count >= m_parallelGrainSize && depth < m_parallelDepth)
+            {
+                GeParallelInvoke(buildLeft, buildRight);
+            }
+            else
+            {
+                buildLeft();
+                buildRight();
+            }
+            return node;
+        }
+
+        // Binned SAH split along axis; returns the partition point, or end
+        // when no bin boundary separates the primitives
+        GeSize SplitSah(GeSize begin, GeSize end, const GeAabb3<T>& centroidBounds, int axis)
+        {
+            struct Bin
+            {
+                GeAabb3<T> bounds;
+                GeSize count = 0;
+            };
+
+            const T lo = Component(centroidBounds.min, axis);
+            const T scale = static_cast<T>(m_binCount) / Component(centroidBounds.Extent(), axis);
+            const GeSize lastBin = m_binCount - 1;
+            auto binOf = [&](const BuildPrim<T>& prim)
+            {
+                const GeSize b = static_cast<GeSize>((Component(prim.centroid, axis) - lo) * scale);
+                return b < lastBin ? b : lastBin;
+            };
+
+            Bin bins[kMaxBins];
+            for (GeSize i = begin; i < end; ++i)
+            {
+                Bin& bin = bins[binOf(m_prims[i])];
+                ++bin.count;
+                bin.bounds.Expand(m_prims[i].bounds);
+            }
+
+            // rightArea/rightCount[i] describe bins (i, lastBin]
+            T rightArea[kMaxBins];
+            GeSize rightCount[kMaxBins];
+            GeAabb3<T> acc;
+            GeSize accCount = 0;
+            for (GeSize i = lastBin; i > 0; --i)
+            {
+                acc.Expand(bins[i].bounds);
+                accCount += bins[i].count;
+                rightArea[i - 1] = acc.SurfaceArea();
+                rightCount[i - 1] = accCount;
+            }
+
+            GeAabb3<T> leftBounds;
+            GeSize leftCount = 0;
+            T bestCost = std::numeric_limits<T>::infinity();
+            GeSize bestSplit = m_binCount;
+            for (GeSize i = 0; i < lastBin; ++i)
+            {
+                leftBounds.Expand(bins[i].bounds);
+                leftCount += bins[i].count;
+                if (leftCount == 0 || rightCount[i] == 0)
+                    continue;
+                const T cost = static_cast<T>(leftCount) * leftBounds.SurfaceArea() +
+                               static_cast<T>(rightCount[i]) * rightArea[i];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSplit = i;
+                }
+            }
+            if (bestSplit == m_binCount)
+                return end;
+
+            auto it = std::partition(m_prims.begin() + begin, m_prims.begin() + end,
+                                     [&](const BuildPrim<T>& prim) { return binOf(prim) <= bestSplit; });
+            return static_cast<GeSize>(it - m_prims.begin());
+        }
+
+    private:
+        std::vector<BuildPrim<T>>& m_prims;
+        GeSize m_maxLeafSize;
+        GeSize m_binCount;
+        bool m_parallel;
+        GeSize m_parallelGrainSize;
+        GeSize m_parallelDepth = 0;
+        std::atomic<GeSize> m_nodeCount{0};
+        std::atomic<GeSize> m_depth{0};
+    };
+
+    // Depth-first flattening, left child right after its parent
+    template <typename T>
+    GeUint32 Flatten(const BuildNode<T>& buildNode, std::vector<BvhNode<T>>& nodes)
+    {
+        const GeUint32 index = static_cast<GeUint32>(nodes.size());
+        BvhNode<T> node;
+        node.boundsMin[0] = buildNode.bounds.min.x;
+        node.boundsMin[1] = buildNode.bounds.min.y;
+        node.boundsMin[2] = buildNode.bounds.min.z;
+        node.boundsMax[0] = buildNode.bounds.max.x;
+        node.boundsMax[1] = buildNode.bounds.max.y;
+        node.boundsMax[2] = buildNode.bounds.max.z;
+        node.offset = static_cast<GeUint32>(buildNode.first);
+        node.count = static_cast<GeUint16>(buildNode.count);
+        node.axis = static_cast<GeUint16>(buildNode.axis);
+        nodes.push_back(node);
+
+        if (buildNode.count == 0)
+        {
+            Flatten(*buildNode.left, nodes);
+            nodes[index].offset = Flatten(*buildNode.right, nodes);
+        }
+        return index;
+    }
+
+    //--------------------------------------------------------------------------
+    // Queries
+
+    template <typename T>
+    inline T BoxDistanceSquare(const BvhNode<T>& node, const GeVector3<T>& p)
+    {
+        const T q[3] = {p.x, p.y, p.z};
+        T result = T(0);
+        for (int a = 0; a < 3; ++a)
+        {
+            const T d = q[a] < node.boundsMin[a] ? node.boundsMin[a] - q[a]
+                                                 : (q[a] > node.boundsMax[a] ? q[a] - node.boundsMax[a] : T(0));
+            result += d * d;
+        }
+        return result;
+    }
+
+    // Ray parameter where the ray enters the node box inflated by radius, or
+    // +inf when it misses the box within [0, tMax]. NaN slabs (zero direction
+    // component with the origin on the slab plane) are ignored.
+    template <typename T>
+    inline T BoxEntry(const BvhNode<T>& node, const T origin[3], const T invDir[3], T radius, T tMax)
+    {
+        T tNear = T(0);
+        T tFar = tMax;
+        for (int a = 0; a < 3; ++a)
+        {
+            const T t1 = (node.boundsMin[a] - radius - origin[a]) * invDir[a];
+            const T t2 = (node.boundsMax[a] + radius - origin[a]) * invDir[a];
+            tNear = std::max(tNear, std::min(t1, t2));
+            tFar = std::min(tFar, std::max(t1, t2) * (1 + 4 * std::numeric_limits<T>::epsilon()));
+        }
+        return tNear <= tFar ? tNear : std::numeric_limits<T>::infinity();
+    }
+
+    template <typename T>
+    GeVector3<T> ClosestPointOnSegment(const GeVector3<T>& p, const GeVector3<T>& a, const GeVector3<T>& b)
+    {
+        const GeVector3<T> ab = b - a;
+        const T len2 = Dot(ab, ab);
+        if (len2 <= T(0))
+            return a;
+        const T t = std::min(std::max(Dot(p - a, ab) / len2, T(0)), T(1));
+        return a + Scale(ab, t);
+    }
+
+    // Ericson, Real-Time Collision Detection, 5.1.5
+    template <typename T>
+    GeVector3<T> ClosestPointOnTriangle(const GeVector3<T>& p, const GeVector3<T>& a,
+                                        const GeVector3<T>& b, const GeVector3<T>& c)
+    {
+        const GeVector3<T> ab = b - a;
+        const GeVector3<T> ac = c - a;
+        const GeVector3<T> ap = p - a;
+        const T d1 = Dot(ab, ap);
+        const T d2 = Dot(ac, ap);
+        if (d1 <= T(0) && d2 <= T(0))
+            return a;
+
+        const GeVector3<T> bp = p - b;
+        const T d3 = Dot(ab, bp);
+        const T d4 = Dot(ac, bp);
+        if (d3 >= T(0) && d4 <= d3)
+            return b;
+
+        const T vc = d1 * d4 - d3 * d2;
+        if (vc <= T(0) && d1 >= T(0) && d3 <= T(0))
+            return a + Scale(ab, d1 / (d1 - d3));
+
+        const GeVector3<T> cp = p - c;
+        const T d5 = Dot(ab, cp);
+        const T d6 = Dot(ac, cp);
+        if (d6 >= T(0) && d5 <= d6)
+            return c;
+
+        const T vb = d5 * d2 - d1 * d6;
+        if (vb <= T(0) && d2 >= T(0) && d6 <= T(0))
+            return a + Scale(ac, d2 / (d2 - d6));
+
+        const T va = d3 * d6 - d5 * d4;
+        if (va <= T(0) && (d4 - d3) >= T(0) && (d5 - d6) >= T(0))
+            return b + Scale(c - b, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+        const T sum = va + vb + vc;
+        if (!(sum > T(0)))
+        {
+            // degenerate (zero-area) triangle: nearest of the edges
+            const GeVector3<T> candidates[3] = {ClosestPointOnSegment(p, a, b),
+                                                ClosestPointOnSegment(p, b, c),
+                                                ClosestPointOnSegment(p, c, a)};
+            GeVector3<T> best = candidates[0];
+            for (int i = 1; i < 3; ++i)
+            {
+                if ((candidates[i] - p).magnitude_square() < (best - p).magnitude_square())
+                    best = candidates[i];
+            }
+            return best;
+        }
+        const T denom = T(1) / sum;
+        return a + Scale(ab, vb * denom) + Scale(ac, vc * denom);
+    }
+
+    // Moller-Trumbore; false for rays parallel to the triangle plane
+    template <typename T>
+    bool IntersectTriangle(const GeVector3<T>& origin, const GeVector3<T>& dir,
+                           const GeVector3<T>& v0, const GeVector3<T>& v1, const GeVector3<T>& v2,
+                           T& t, T& u, T& v)
+    {
+        const GeVector3<T> e1 = v1 - v0;
+        const GeVector3<T> e2 = v2 - v0;
+        const GeVector3<T> p = dir.cross(e2);
+        const T det = Dot(e1, p);
+        if (det == T(0))
+            return false;
+
+        const T invDet = T(1) / det;
+        const GeVector3<T> s = origin - v0;
+        u = Dot(s, p) * invDet;
+        if (u < T(0) || u > T(1))
+            return false;
+
+        const GeVector3<T> q = s.cross(e1);
+        v = Dot(dir, q) * invDet;
+        if (v < T(0) || u + v > T(1))
+            return false;
+
+        t = Dot(e2, q) * invDet;
+        return t >= T(0);
+    }
+
+    // First non-negative parameter where the ray meets the sphere; 0 when the
+    // origin is inside
+    template <typename T>
+    bool IntersectSphere(const GeVector3<T>& origin, const GeVector3<T>& dir,
+                         const GeVector3<T>& center, T radius, T& t)
+    {
+        const GeVector3<T> oc = origin - center;
+        const T c = Dot(oc, oc) - radius * radius;
+        if (c <= T(0))
+        {
+            t = T(0);
+            return true;
+        }
+
+        const T a = Dot(dir, dir);
+        const T b = Dot(oc, dir);
+        const T disc = b * b - a * c;
+        if (b >= T(0) || disc < T(0))
+            return false;
+
+        t = (-b - std::sqrt(disc)) / a;
+        return t >= T(0);
+    }
+
+} // end of bvh
+} // end of details
+} // end of ge
+
+//==============================================================================
+// Build
+
+template <typename T>
+template <typename TBounds>
+void GeBvh<T>::Build(const TBounds& primBounds, GeSize count, const GeBvhBuildOptions& options)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBvhBuild, count);
+    using namespace ge::details::bvh;
+
+    assert(count <= 0xFFFFFFFFu);
+    if (count == 0)
+        return;
+
+    std::vector<BuildPrim<T>> prims(count);
+    for (GeSize i = 0; i < count; ++i)
+    {
+        prims[i].bounds = primBounds(i);
+        prims[i].centroid = prims[i].bounds.Center();
+        prims[i].index = static_cast<GeUint32>(i);
+    }
+
+    Builder<T> builder(prims, options);
+    const std::unique_ptr<BuildNode<T>> root = builder.Build();
+
+    m_nodes.reserve(builder.NodeCount());
+    Flatten(*root, m_nodes);
+    m_depth = builder.Depth();
+
+    m_primIndices.resize(count);
+    for (GeSize slot = 0; slot < count; ++slot)
+    {
+        m_primIndices[slot] = prims[slot].index;
+    }
+}
+
+template <typename T>
+void GeBvh<T>::BuildFromPoints(GeSpan<const GeVector3<T>> points, const GeBvhBuildOptions& options)
+{
+    Clear();
+    m_triangleSet = false;
+    Build([&](GeSize i) { return GeAabb3<T>(points[i], points[i]); }, points.size(), options);
+
+    m_points.resize(m_primIndices.size());
+    for (GeSize slot = 0; slot < m_points.size(); ++slot)
+    {
+        m_points[slot] = points[m_primIndices[slot]];
+    }
+}
+
+template <typename T>
+void GeBvh<T>::BuildFromTriangles(GeSpan<const GeVector3<T>> vertices, GeSpan<const GeUint32> indices,
+                                  const GeBvhBuildOptions& options)
+{
+    assert(indices.size() % 3 == 0);
+
+    Clear();
+    m_triangleSet = true;
+    Build([&](GeSize i)
+    {
+        GeAabb3<T> bounds;
+        bounds.Expand(vertices[indices[3 * i]]);
+        bounds.Expand(vertices[indices[3 * i + 1]]);
+        bounds.Expand(vertices[indices[3 * i + 2]]);
+        return bounds;
+    }, indices.size() / 3, options);
+
+    m_triangles.resize(3 * m_primIndices.size());
+    for (GeSize slot = 0; slot < m_primIndices.size(); ++slot)
+    {
+        const GeSize tri = m_primIndices[slot];
+        for (GeSize k = 0; k < 3; ++k)
+        {
+            m_triangles[3 * slot + k] = vertices[indices[3 * tri + k]];
+        }
+    }
+}
+
+template <typename T>
+void GeBvh<T>::BuildFromTriangles(GeSpan<const GeVector3<T>> vertices, const GeBvhBuildOptions& options)
+{
+    assert(vertices.size() % 3 == 0);
+
+    std::vector<GeUint32> indices(vertices.size());
+    for (GeSize i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = static_cast<GeUint32>(i);
+    }
+    BuildFromTriangles(vertices, GeSpan<const GeUint32>(indices), options);
+}
+
+template <typename T>
+void GeBvh<T>::Clear()
+{
+    m_nodes.clear();
+    m_primIndices.clear();
+    m_points.clear();
+    m_triangles.clear();
+    m_depth = 0;
+}
+
+template <typename T>
+GeAabb3<T> GeBvh<T>::Bounds() const
+{
+    if (m_nodes.empty())
+        return GeAabb3<T>();
+
+    const Node& root = m_nodes[0];
+    return GeAabb3<T>(GeVector3<T>(root.boundsMin[0], root.boundsMin[1], root.boundsMin[2]),
+                      GeVector3<T>(root.boundsMax[0], root.boundsMax[1], root.boundsMax[2]));
+}
+
+template <typename T>
+void GeBvh<T>::SetTolerance(T tolerance)
+{
+    assert(tolerance >= T(0) && tolerance < T(0.25));
+    m_tolerance = tolerance;
+}
+
+//==============================================================================
+// Queries
+
+template <typename T>
+T GeBvh<T>::PrimitiveDistanceSquare(GeSize slot, const GeVector3<T>& query) const
+{
+    if (m_triangleSet)
+    {
+        const GeVector3<T>* tri = &m_triangles[3 * slot];
+        return (ge::details::bvh::ClosestPointOnTriangle(query, tri[0], tri[1], tri[2]) - query).magnitude_square();
+    }
+    return (m_points[slot] - query).magnitude_square();
+}
+
+// Every distance above the returned bound is GeRealLess-greater than
+// bestDistance, so it can neither beat nor tie it. Tolerances below 0.25
+// keep the relative slack inside the 4 * tol margin; 4 * epsilon covers
+// the one-ULP ties of GeRealLess's ULP mode.
+template <typename T>
+T GeBvh<T>::RejectBound(T bestDistance) const
+{
+    const T floor = std::numeric_limits<T>::min();
+    return (bestDistance > floor ? bestDistance : floor) *
+           (T(1) + 4 * m_tolerance + 4 * std::numeric_limits<T>::epsilon());
+}
+
+template <typename T>
+bool GeBvh<T>::IsBetter(T distance, GeSize index, T bestDistance, GeSize bestIndex) const
+{
+    if (GeRealLess(distance, bestDistance, m_tolerance))
+        return true;
+    return !GeRealLess(bestDistance, distance, m_tolerance) && index < bestIndex;
+}
+
+template <typename T>
+typename GeBvh<T>::Hit GeBvh<T>::Nearest(const GeVector3<T>& query, T maxDistance) const
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBvhQuery, 1);
+    using namespace ge::details::bvh;
+
+    Hit best;
+    if (m_nodes.empty())
+        return best;
+
+    const T limit = maxDistance * maxDistance;
+    T bound = RejectBound(limit);
+    bool found = false;
+
+    GeUint32 stack[kStackSize];
+    GeSize top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const GeUint32 nodeIndex = stack[--top];
+        const Node& node = m_nodes[nodeIndex];
+        if (BoxDistanceSquare(node, query) > bound)
+            continue;
+
+        if (node.count > 0)
+        {
+            for (GeSize slot = node.offset; slot < node.offset + node.count; ++slot)
+            {
+                const T d = PrimitiveDistanceSquare(slot, query);
+                if (d > bound)
+                    continue;
+                const GeSize index = m_primIndices[slot];
+                if (found ? IsBetter(d, index, best.distanceSquare, best.index)
+                          : !GeRealLess(limit, d, m_tolerance))
+                {
+                    best.index = index;
+                    best.distanceSquare = d;
+                    bound = RejectBound(d);
+                    found = true;
+                }
+            }
+            continue;
+        }
+
+        // nearer child on top of the stack
+        const GeUint32 left = nodeIndex + 1;
+        const GeUint32 right = node.offset;
+        const T dLeft = BoxDistanceSquare(m_nodes[left], query);
+        const T dRight = BoxDistanceSquare(m_nodes[right], query);
+        const bool leftFirst = dLeft <= dRight;
+        const GeUint32 first = leftFirst ? left : right;
+        const GeUint32 second = leftFirst ? right : left;
+        const T dSecond = leftFirst ? dRight : dLeft;
+        assert(top + 2 <= kStackSize);
+        if (dSecond <= bound)
+            stack[top++] = second;
+        stack[top++] = first;
+    }
+    return best;
+}
+
+template <typename T>
+void GeBvh<T>::KNearest(const GeVector3<T>& query, GeSize k, std::vector<Hit>& out, T maxDistance) const
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBvhQuery, 1);
+    using namespace ge::details::bvh;
+
+    out.clear();
+    if (m_nodes.empty() || k == 0)
+        return;
+    out.reserve(std::min(k, PrimitiveCount()));
+
+    const T limit = maxDistance * maxDistance;
+    T bound = RejectBound(limit);
+
+    GeUint32 stack[kStackSize];
+    GeSize top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const GeUint32 nodeIndex = stack[--top];
+        const Node& node = m_nodes[nodeIndex];
+        if (BoxDistanceSquare(node, query) > bound)
+            continue;
+
+        if (node.count > 0)
+        {
+            for (GeSize slot = node.offset; slot < node.offset + node.count; ++slot)
+            {
+                const T d = PrimitiveDistanceSquare(slot, query);
+                if (d > bound)
+                    continue;
+                const GeSize index = m_primIndices[slot];
+                if (out.size() < k)
+                {
+                    if (GeRealLess(limit, d, m_tolerance))
+                        continue;
+                }
+                else
+                {
+                    if (!IsBetter(d, index, out.back().distanceSquare, out.back().index))
+                        continue;
+                    out.pop_back();
+                }
+
+                // insertion keeps the list ordered nearest first
+                Hit hit;
+                hit.index = index;
+                hit.distanceSquare = d;
+                GeSize pos = out.size();
+                out.push_back(hit);
+                while (pos > 0 && IsBetter(d, index, out[pos - 1].distanceSquare, out[pos - 1].index))
+                {
+                    out[pos] = out[pos - 1];
+                    --pos;
+                }
+                out[pos] = hit;
+
+                if (out.size() == k)
+                    bound = RejectBound(out.back().distanceSquare);
+            }
+            continue;
+        }
+
+        const GeUint32 left = nodeIndex + 1;
+        const GeUint32 right = node.offset;
+        const T dLeft = BoxDistanceSquare(m_nodes[left], query);
+        const T dRight = BoxDistanceSquare(m_nodes[right], query);
+        const bool leftFirst = dLeft <= dRight;
+        const GeUint32 first = leftFirst ? left : right;
+        const GeUint32 second = leftFirst ? right : left;
+        const T dSecond = leftFirst ? dRight : dLeft;
+        assert(top + 2 <= kStackSize);
+        if (dSecond <= bound)
+            stack[top++] = second;
+        stack[top++] = first;
+    }
+}
+
+template <typename T>
+void GeBvh<T>::RadiusSearch(const GeVector3<T>& query, T radius, std::vector<Hit>& out) const
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBvhQuery, 1);
+    using namespace ge::details::bvh;
+
+    out.clear();
+    if (m_nodes.empty())
+        return;
+
+    const T limit = radius * radius;
+    const T bound = RejectBound(limit);
+
+    GeUint32 stack[kStackSize];
+    GeSize top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const GeUint32 nodeIndex = stack[--top];
+        const Node& node = m_nodes[nodeIndex];
+        if (BoxDistanceSquare(node, query) > bound)
+            continue;
+
+        if (node.count > 0)
+        {
+            for (GeSize slot = node.offset; slot < node.offset + node.count; ++slot)
+            {
+                const T d = PrimitiveDistanceSquare(slot, query);
+                if (d > bound || GeRealLess(limit, d, m_tolerance))
+                    continue;
+                Hit hit;
+                hit.index = m_primIndices[slot];
+                hit.distanceSquare = d;
+                out.push_back(hit);
+            }
+            continue;
+        }
+
+        assert(top + 2 <= kStackSize);
+        stack[top++] = node.offset;
+        stack[top++] = nodeIndex + 1;
+    }
+
+    std::sort(out.begin(), out.end(), [](const Hit& a, const Hit& b) { return a.index < b.index; });
+}
+
+template <typename T>
+bool GeBvh<T>::Raycast(const GeVector3<T>& origin, const GeVector3<T>& direction, RayHit& hit,
+                       T tMax, T pointRadius) const
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBvhQuery, 1);
+    using namespace ge::details::bvh;
+
+    hit = RayHit();
+    if (m_nodes.empty() || (!m_triangleSet && !(pointRadius > T(0))))
+        return false;
+
+    const T o[3] = {origin.x, origin.y, origin.z};
+    const T invDir[3] = {T(1) / direction.x, T(1) / direction.y, T(1) / direction.z};
+    const T boxRadius = m_triangleSet ? T(0) : pointRadius;
+    T bound = RejectBound(tMax);
+    bool found = false;
+
+    GeUint32 stack[kStackSize];
+    GeSize top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const GeUint32 nodeIndex = stack[--top];
+        const Node& node = m_nodes[nodeIndex];
+        if (BoxEntry(node, o, invDir, boxRadius, bound) > bound)
+            continue;
+
+        if (node.count > 0)
+        {
+            for (GeSize slot = node.offset; slot < node.offset + node.count; ++slot)
+            {
+                T t = T(0);
+                T u = T(0);
+                T v = T(0);
+                const bool intersects = m_triangleSet
+                    ? IntersectTriangle(origin, direction, m_triangles[3 * slot], m_triangles[3 * slot + 1],
+                                        m_triangles[3 * slot + 2], t, u, v)
+                    : IntersectSphere(origin, direction, m_points[slot], pointRadius, t);
+                if (!intersects || t > bound)
+                    continue;
+                const GeSize index = m_primIndices[slot];
+                if (found ? IsBetter(t, index, hit.t, hit.index)
+                          : !GeRealLess(tMax, t, m_tolerance))
+                {
+                    hit.index = index;
+                    hit.t = t;
+                    hit.u = u;
+                    hit.v = v;
+                    bound = RejectBound(t);
+                    found = true;
+                }
+            }
+            continue;
+        }
+
+        // visit the child on the near side of the split plane first
+        const GeUint32 left = nodeIndex + 1;
+        const GeUint32 right = node.offset;
+        const bool leftFirst = invDir[node.axis] >= T(0);
+        assert(top + 2 <= kStackSize);
+        stack[top++] = leftFirst ? right : left;
+        stack[top++] = leftFirst ? left : right;
+    }
+    return found;
+}
+
+template class GeBvh<GeReal32>;
+template class GeBvh<GeReal64>;
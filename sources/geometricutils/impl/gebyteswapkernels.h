@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_BYTESWAPKERNELS_H
+#define GEOMUTILS_IMPL_BYTESWAPKERNELS_H
+
+// Byte-order reversal of 32- and 64-bit words, used to load data written on
+// a machine of the other endianness. Each kernel swaps kBytes bytes per call;
+// in and out may be the same buffer.
+
+#include "gebaseutl.h"
+#include "impl/gesimd.h"
+
+#include <cstring>
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace byteswapkernels
+{
+    //--------------------------------------------------------------------------
+    struct BswapScalar
+    {
+        static constexpr size_t kBytes = 8;
+
+        static void Swap32(const uint8_t* in, uint8_t* out)
+        {
+            uint32_t w[2];
+            std::memcpy(w, in, sizeof(w));
+            w[0] = GeByteSwap(w[0]);
+            w[1] = GeByteSwap(w[1]);
+            std::memcpy(out, w, sizeof(w));
+        }
+
+        static void Swap64(const uint8_t* in, uint8_t* out)
+        {
+            uint64_t w;
+            std::memcpy(&w, in, sizeof(w));
+            w = GeByteSwap(w);
+            std::memcpy(out, &w, sizeof(w));
+        }
+    };
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    // No byte shuffle before SSSE3: swap the bytes of every 16-bit word, then
+    // reorder the words
+    struct BswapSse2
+    {
+        static constexpr size_t kBytes = 16;
+
+        static __m128i SwapBytesOfWords(__m128i v)
+        {
+            return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        }
+
+        static void Swap32(const uint8_t* in, uint8_t* out)
+        {
+            __m128i v = SwapBytesOfWords(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        }
+
+        static void Swap64(const uint8_t* in, uint8_t* out)
+        {
+            __m128i v = SwapBytesOfWords(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        }
+    };
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_AVX2
+    //--------------------------------------------------------------------------
+    // Also used by the AVX-512 tier: AVX512F has no byte shuffle of its own
+    struct BswapAvx2
+    {
+        static constexpr size_t kBytes = 32;
+
+        static void Shuffle(const uint8_t* in, uint8_t* out, __m256i order)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_shuffle_epi8(v, order));
+        }
+
+        static void Swap32(const uint8_t* in, uint8_t* out)
+        {
+            Shuffle(in, out, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+        }
+
+        static void Swap64(const uint8_t* in, uint8_t* out)
+        {
+            Shuffle(in, out, _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                              7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+        }
+    };
+#endif // GE_KERNEL_HAS_AVX2
+
+    //--------------------------------------------------------------------------
+    // Drivers over n words: kernel blocks for the bulk, scalar for the tail
+
+    template <typename K>
+    void Swap32(const void* in, void* out, size_t n)
+    {
+        const uint8_t* src = static_cast<const uint8_t*>(in);
+        uint8_t* dst = static_cast<uint8_t*>(out);
+        const size_t bytes = n * sizeof(uint32_t);
+        size_t i = 0;
+        for (; i + K::kBytes <= bytes; i += K::kBytes)
+            K::Swap32(src + i, dst + i);
+        for (; i < bytes; i += sizeof(uint32_t))
+        {
+            uint32_t w;
+            std::memcpy(&w, src + i, sizeof(w));
+            w = GeByteSwap(w);
+            std::memcpy(dst + i, &w, sizeof(w));
+        }
+    }
+
+    template <typename K>
+    void Swap64(const void* in, void* out, size_t n)
+    {
+        const uint8_t* src = static_cast<const uint8_t*>(in);
+        uint8_t* dst = static_cast<uint8_t*>(out);
+        const size_t bytes = n * sizeof(uint64_t);
+        size_t i = 0;
+        for (; i + K::kBytes <= bytes; i += K::kBytes)
+            K::Swap64(src + i, dst + i);
+        for (; i < bytes; i += sizeof(uint64_t))
+            BswapScalar::Swap64(src + i, dst + i);
+    }
+
+} // end of byteswapkernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_BYTESWAPKERNELS_H
@@ -0,0 +1,104 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gecompressed.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+
+namespace
+{
+    const ge::details::dispatch::HalfKernelTable& HalfKernels()
+    {
+        return ge::details::dispatch::ActiveKernelTable().half;
+    }
+
+    const ge::details::dispatch::OctahedralKernelTable& OctKernels()
+    {
+        return ge::details::dispatch::ActiveKernelTable().octahedral;
+    }
+} // end of anonymous
+
+//==============================================================================
+// Half
+
+void GeBatchEncodeHalf(const GeReal32* in, GeUint16* out, GeSize n)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchHalf, n);
+    HalfKernels().encode(in, out, n);
+}
+
+void GeBatchDecodeHalf(const GeUint16* in, GeReal32* out, GeSize n)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchHalf, n);
+    HalfKernels().decode(in, out, n);
+}
+
+void GeVector3BatchEncodeHalf(GeVector3ArrayCView<GeReal32> in, GeVector3ArrayView<GeUint16> out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchHalf, in.size);
+    assert(in.size == out.size);
+    const auto& k = HalfKernels();
+    k.encode(in.x, out.x, in.size);
+    k.encode(in.y, out.y, in.size);
+    k.encode(in.z, out.z, in.size);
+}
+
+void GeVector3BatchDecodeHalf(GeVector3ArrayCView<GeUint16> in, GeVector3ArrayView<GeReal32> out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchHalf, in.size);
+    assert(in.size == out.size);
+    const auto& k = HalfKernels();
+    k.decode(in.x, out.x, in.size);
+    k.decode(in.y, out.y, in.size);
+    k.decode(in.z, out.z, in.size);
+}
+
+//==============================================================================
+// Octahedral
+
+GeUint32 GeOctahedralEncode(const GeVector3<GeReal32>& n)
+{
+    GeUint32 code;
+    OctKernels().encode(&n.x, &n.y, &n.z, &code, 1);
+    return code;
+}
+
+GeVector3<GeReal32> GeOctahedralDecode(GeUint32 code)
+{
+    GeReal32 x, y, z;
+    OctKernels().decode(&code, &x, &y, &z, 1);
+    return GeVector3<GeReal32>(x, y, z);
+}
+
+void GeVector3BatchEncodeOctahedral(GeVector3ArrayCView<GeReal32> in, GeUint32* out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchOctahedral, in.size);
+    OctKernels().encode(in.x, in.y, in.z, out, in.size);
+}
+
+void GeVector3BatchDecodeOctahedral(const GeUint32* in, GeVector3ArrayView<GeReal32> out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchOctahedral, out.size);
+    OctKernels().decode(in, out.x, out.y, out.z, out.size);
+}
@@ -0,0 +1,264 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_COMPRESSEDKERNELS_H
+#define GEOMUTILS_IMPL_COMPRESSEDKERNELS_H
+
+// Encoders and decoders behind gecompressed.h. The half kernels reproduce
+// GeFloatToHalf/GeHalfToFloat bit for bit; the octahedral ones are written
+// once over the lane packs, so every tier matches its scalar tail.
+
+#include "gebaseutl.h"
+#include "impl/gesimd.h"
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace compressedkernels
+{
+    //==========================================================================
+    // Half precision
+
+    struct HalfScalar
+    {
+        static constexpr size_t kLanes = 1;
+
+        static void Encode(const real32_t* in, uint16_t* out) { *out = GeFloatToHalf(*in); }
+        static void Decode(const uint16_t* in, real32_t* out) { *out = GeHalfToFloat(*in); }
+    };
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    // Integer emulation of the conversions, same steps as the scalar code
+    struct HalfSse2
+    {
+        static constexpr size_t kLanes = 8;
+
+        static __m128i Select(__m128i m, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+        }
+
+        // Four halves, sign-extended in 32-bit lanes so that packs keeps them
+        static __m128i ToHalf4(__m128 f)
+        {
+            const __m128i bits = _mm_castps_si128(f);
+            const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+            const __m128i a = _mm_xor_si128(bits, sign);
+
+            const __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(a, 13), _mm_set1_epi32(1));
+            const __m128i rebiased = _mm_sub_epi32(a, _mm_set1_epi32(0x38000000));
+            __m128i h = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(rebiased, _mm_set1_epi32(0xfff)), mantOdd), 13);
+
+            const __m128i magic = _mm_set1_epi32(0x3f000000);
+            const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(magic))), magic);
+            h = Select(_mm_cmplt_epi32(a, _mm_set1_epi32(0x38800000)), subnormal, h);
+            h = Select(_mm_cmpgt_epi32(a, _mm_set1_epi32(0x477fffff)), _mm_set1_epi32(0x7c00), h);
+            const __m128i nan = _mm_or_si128(_mm_set1_epi32(0x7e00), _mm_and_si128(_mm_srli_epi32(a, 13), _mm_set1_epi32(0x3ff)));
+            h = Select(_mm_cmpgt_epi32(a, _mm_set1_epi32(0x7f800000)), nan, h);
+
+            h = _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+            return _mm_srai_epi32(_mm_slli_epi32(h, 16), 16);
+        }
+
+        // Four zero-extended halves in 32-bit lanes
+        static __m128 FromHalf4(__m128i h)
+        {
+            const __m128i shifted = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+            const __m128i exponent = _mm_and_si128(shifted, _mm_set1_epi32(0x0f800000));
+            const __m128i rebias = _mm_set1_epi32(112 << 23);
+            __m128i o = _mm_add_epi32(shifted, rebias);
+
+            // infinity and NaN take the float maximum exponent; NaN is made quiet
+            o = _mm_add_epi32(o, _mm_and_si128(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0f800000)), rebias));
+            o = _mm_or_si128(o, _mm_and_si128(_mm_cmpgt_epi32(shifted, _mm_set1_epi32(0x0f800000)), _mm_set1_epi32(0x400000)));
+
+            // zero and subnormals: renormalize through a float subtraction
+            const __m128 subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))),
+                                                _mm_castsi128_ps(_mm_set1_epi32(113 << 23)));
+            o = Select(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()), _mm_castps_si128(subnormal), o);
+
+            const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+            return _mm_castsi128_ps(_mm_or_si128(o, sign));
+        }
+
+        static void Encode(const real32_t* in, uint16_t* out)
+        {
+            const __m128i h = _mm_packs_epi32(ToHalf4(_mm_loadu_ps(in)), ToHalf4(_mm_loadu_ps(in + 4)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), h);
+        }
+
+        static void Decode(const uint16_t* in, real32_t* out)
+        {
+            const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            _mm_storeu_ps(out, FromHalf4(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+            _mm_storeu_ps(out + 4, FromHalf4(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+        }
+    };
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_F16C
+    //--------------------------------------------------------------------------
+    struct HalfF16c
+    {
+        static constexpr size_t kLanes = 8;
+
+        static void Encode(const real32_t* in, uint16_t* out)
+        {
+            const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), h);
+        }
+
+        static void Decode(const uint16_t* in, real32_t* out)
+        {
+            _mm256_storeu_ps(out, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in))));
+        }
+    };
+#endif // GE_KERNEL_HAS_F16C
+
+#ifdef GE_KERNEL_HAS_AVX512
+    //--------------------------------------------------------------------------
+    struct HalfAvx512
+    {
+        static constexpr size_t kLanes = 16;
+
+        static void Encode(const real32_t* in, uint16_t* out)
+        {
+            const __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), h);
+        }
+
+        static void Decode(const uint16_t* in, real32_t* out)
+        {
+            _mm512_storeu_ps(out, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in))));
+        }
+    };
+#endif // GE_KERNEL_HAS_AVX512
+
+    template <typename K>
+    void EncodeHalf(const real32_t* in, uint16_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + K::kLanes <= n; i += K::kLanes)
+            K::Encode(in + i, out + i);
+        for (; i < n; ++i)
+            HalfScalar::Encode(in + i, out + i);
+    }
+
+    template <typename K>
+    void DecodeHalf(const uint16_t* in, real32_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + K::kLanes <= n; i += K::kLanes)
+            K::Decode(in + i, out + i);
+        for (; i < n; ++i)
+            HalfScalar::Decode(in + i, out + i);
+    }
+
+    //==========================================================================
+    // Octahedral unit vectors: the direction is projected onto the octahedron
+    // |x| + |y| + |z| = 1, the lower half is folded over the upper one, and
+    // the resulting (u, v) in [-1, 1]^2 is stored as two snorm16 values, u in
+    // the low half of the code
+
+    template <typename P>
+    inline void OctEncodeBlock(const real32_t* x, const real32_t* y, const real32_t* z, uint32_t* out)
+    {
+        const P zero = P::Broadcast(0.0f);
+        const P one = P::Broadcast(1.0f);
+        const P px = P::Load(x);
+        const P py = P::Load(y);
+        const P pz = P::Load(z);
+
+        const P sum = Abs(px) + Abs(py) + Abs(pz);
+        const P inv = Select(NotEqualZero(sum), one / sum, zero);
+        P u = px * inv;
+        P v = py * inv;
+        const auto lower = LessThan(pz, zero);
+        const P foldedU = CopySign(one - Abs(v), u);
+        const P foldedV = CopySign(one - Abs(u), v);
+        u = Select(lower, foldedU, u);
+        v = Select(lower, foldedV, v);
+
+        // Min first so that NaN lanes end up at 1 in every tier
+        const P scale = P::Broadcast(32767.0f);
+        const P minusOne = P::Broadcast(-1.0f);
+        int32_t qu[P::kLanes];
+        int32_t qv[P::kLanes];
+        (Max(Min(u, one), minusOne) * scale).StoreInt32(qu);
+        (Max(Min(v, one), minusOne) * scale).StoreInt32(qv);
+        for (size_t k = 0; k < P::kLanes; ++k)
+        {
+            out[k] = static_cast<uint32_t>(static_cast<uint16_t>(qu[k])) |
+                     (static_cast<uint32_t>(static_cast<uint16_t>(qv[k])) << 16);
+        }
+    }
+
+    template <typename P>
+    inline void OctDecodeBlock(const uint32_t* in, real32_t* x, real32_t* y, real32_t* z)
+    {
+        const P zero = P::Broadcast(0.0f);
+        const P one = P::Broadcast(1.0f);
+        const P scale = P::Broadcast(32767.0f);
+        const P u = P::FromInt16Low(in) / scale;
+        const P v = P::FromInt16High(in) / scale;
+        const P pz = one - Abs(u) - Abs(v);
+        const P fold = Max(zero - pz, zero);
+        const P px = u - CopySign(fold, u);
+        const P py = v - CopySign(fold, v);
+
+        const P invLength = one / Sqrt(px * px + py * py + pz * pz);
+        (px * invLength).Store(x);
+        (py * invLength).Store(y);
+        (pz * invLength).Store(z);
+    }
+
+    template <typename P>
+    void OctEncode(const real32_t* x, const real32_t* y, const real32_t* z, uint32_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + P::kLanes <= n; i += P::kLanes)
+            OctEncodeBlock<P>(x + i, y + i, z + i, out + i);
+        for (; i < n; ++i)
+            OctEncodeBlock<simd::ScalarPack<real32_t>>(x + i, y + i, z + i, out + i);
+    }
+
+    template <typename P>
+    void OctDecode(const uint32_t* in, real32_t* x, real32_t* y, real32_t* z, size_t n)
+    {
+        size_t i = 0;
+        for (; i + P::kLanes <= n; i += P::kLanes)
+            OctDecodeBlock<P>(in + i, x + i, y + i, z + i);
+        for (; i < n; ++i)
+            OctDecodeBlock<simd::ScalarPack<real32_t>>(in + i, x + i, y + i, z + i);
+    }
+
+} // end of compressedkernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_COMPRESSEDKERNELS_H
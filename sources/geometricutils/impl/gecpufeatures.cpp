@@ -0,0 +1,245 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "gecpufeatures.h"
+#include "impl/gekernels.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   include <cpuid.h>
+#elif defined(GE_ARCH_X86) && defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
+namespace
+{
+    struct CpuidRegisters
+    {
+        ge::uint32_t eax{};
+        ge::uint32_t ebx{};
+        ge::uint32_t ecx{};
+        ge::uint32_t edx{};
+    };
+
+    bool Cpuid(ge::uint32_t leaf, ge::uint32_t subleaf, CpuidRegisters& regs)
+    {
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+        if (__get_cpuid_max(leaf & 0x80000000u, nullptr) < leaf)
+        {
+            return false;
+        }
+        __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+        return true;
+#elif defined(GE_ARCH_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, static_cast<int>(leaf & 0x80000000u));
+        if (static_cast<ge::uint32_t>(info[0]) < leaf)
+        {
+            return false;
+        }
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+        regs.eax = static_cast<ge::uint32_t>(info[0]);
+        regs.ebx = static_cast<ge::uint32_t>(info[1]);
+        regs.ecx = static_cast<ge::uint32_t>(info[2]);
+        regs.edx = static_cast<ge::uint32_t>(info[3]);
+        return true;
+#else
+        GE_UNUSED(leaf);
+        GE_UNUSED(subleaf);
+        GE_UNUSED(regs);
+        return false;
+#endif
+    }
+
+    // XCR0: register state the OS saves on context switch
+    ge::uint64_t ReadXcr0()
+    {
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+        ge::uint32_t eax = 0;
+        ge::uint32_t edx = 0;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<ge::uint64_t>(edx) << 32) | eax;
+#elif defined(GE_ARCH_X86) && defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        return 0;
+#endif
+    }
+
+    bool HasBit(ge::uint32_t reg, int bit)
+    {
+        return (reg >> bit) & 1u;
+    }
+
+    GeCpuFeatures DetectCpuFeatures()
+    {
+        GeCpuFeatures features;
+
+        CpuidRegisters leaf1;
+        if (!Cpuid(1, 0, leaf1))
+        {
+            return features;
+        }
+
+        features.sse2 = HasBit(leaf1.edx, 26);
+        features.sse42 = HasBit(leaf1.ecx, 20);
+
+        const bool osxsave = HasBit(leaf1.ecx, 27);
+        const ge::uint64_t xcr0 = osxsave ? ReadXcr0() : 0;
+        const bool osYmm = (xcr0 & 0x6) == 0x6;           // XMM | YMM
+        const bool osZmm = osYmm && (xcr0 & 0xE0) == 0xE0; // opmask | ZMM_Hi256 | Hi16_ZMM
+
+        features.avx = osYmm && HasBit(leaf1.ecx, 28);
+        features.fma = features.avx && HasBit(leaf1.ecx, 12);
+        features.f16c = features.avx && HasBit(leaf1.ecx, 29);
+
+        CpuidRegisters leaf7;
+        if (Cpuid(7, 0, leaf7))
+        {
+            features.avx2 = features.avx && HasBit(leaf7.ebx, 5);
+            features.bmi2 = HasBit(leaf7.ebx, 8);
+            features.avx512f = osZmm && HasBit(leaf7.ebx, 16);
+            features.avx512bw = features.avx512f && HasBit(leaf7.ebx, 30);
+            features.avx512vl = features.avx512f && HasBit(leaf7.ebx, 31);
+        }
+
+        return features;
+    }
+
+    const ge::details::dispatch::KernelTable* TableForTier(GeSimdTier tier)
+    {
+        namespace dispatch = ge::details::dispatch;
+
+        const GeCpuFeatures& features = GeGetCpuFeatures();
+        switch (tier)
+        {
+        case GeSimdTier::kScalar:
+            return dispatch::GetScalarKernelTable();
+        case GeSimdTier::kSse2:
+            return features.sse2 ? dispatch::GetSse2KernelTable() : nullptr;
+        case GeSimdTier::kAvx2:
+            return features.avx2 && features.f16c && features.bmi2 ? dispatch::GetAvx2KernelTable() : nullptr;
+        case GeSimdTier::kAvx512:
+            return features.avx512f && features.bmi2 ? dispatch::GetAvx512KernelTable() : nullptr;
+        }
+        return nullptr;
+    }
+
+    bool ParseTier(const char* pName, GeSimdTier& tier)
+    {
+        const GeSimdTier kTiers[] = {GeSimdTier::kScalar, GeSimdTier::kSse2, GeSimdTier::kAvx2, GeSimdTier::kAvx512};
+        for (GeSimdTier candidate : kTiers)
+        {
+            if (std::strcmp(pName, GeSimdTierName(candidate)) == 0)
+            {
+                tier = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const ge::details::dispatch::KernelTable* SelectInitialTable()
+    {
+        GeSimdTier tier = GeGetMaxSupportedSimdTier();
+
+        GeSimdTier requested;
+        const char* pEnv = std::getenv("GE_SIMD_TIER");
+        if (pEnv != nullptr && ParseTier(pEnv, requested) && TableForTier(requested) != nullptr)
+        {
+            tier = requested;
+        }
+
+        return TableForTier(tier);
+    }
+
+    std::atomic<const ge::details::dispatch::KernelTable*>& ActiveTableSlot()
+    {
+        static std::atomic<const ge::details::dispatch::KernelTable*> s_pTable{SelectInitialTable()};
+        return s_pTable;
+    }
+} // end of anonymous
+
+//==============================================================================
+// CPU features
+
+const GeCpuFeatures& GeGetCpuFeatures()
+{
+    static const GeCpuFeatures s_features = DetectCpuFeatures();
+    return s_features;
+}
+
+//==============================================================================
+// Kernel dispatch
+
+GeSimdTier GeGetMaxSupportedSimdTier()
+{
+    const GeSimdTier kTiersWidestFirst[] = {GeSimdTier::kAvx512, GeSimdTier::kAvx2, GeSimdTier::kSse2};
+    for (GeSimdTier tier : kTiersWidestFirst)
+    {
+        if (TableForTier(tier) != nullptr)
+        {
+            return tier;
+        }
+    }
+    return GeSimdTier::kScalar;
+}
+
+GeSimdTier GeGetSimdTier()
+{
+    return ge::details::dispatch::ActiveKernelTable().tier;
+}
+
+bool GeSetSimdTier(GeSimdTier tier)
+{
+    const ge::details::dispatch::KernelTable* pTable = TableForTier(tier);
+    if (pTable == nullptr)
+    {
+        return false;
+    }
+
+    ActiveTableSlot().store(pTable, std::memory_order_release);
+    return true;
+}
+
+const char* GeSimdTierName(GeSimdTier tier)
+{
+    switch (tier)
+    {
+    case GeSimdTier::kScalar: return "scalar";
+    case GeSimdTier::kSse2: return "sse2";
+    case GeSimdTier::kAvx2: return "avx2";
+    case GeSimdTier::kAvx512: return "avx512";
+    }
+    return "unknown";
+}
+
+const ge::details::dispatch::KernelTable& ge::details::dispatch::ActiveKernelTable()
+{
+    return *ActiveTableSlot().load(std::memory_order_acquire);
+}
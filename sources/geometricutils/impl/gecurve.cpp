@@ -0,0 +1,146 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gecurve.h"
+#include "geparallel.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+#include "impl/geradixsort.h"
+
+#include <limits>
+
+namespace
+{
+    template <typename T>
+    const ge::details::dispatch::CurveKernelTable<T>& Kernels();
+
+    template <>
+    const ge::details::dispatch::CurveKernelTable<GeReal32>& Kernels<GeReal32>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().curvef;
+    }
+
+    template <>
+    const ge::details::dispatch::CurveKernelTable<GeReal64>& Kernels<GeReal64>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().curved;
+    }
+
+    template <typename T>
+    typename ge::details::dispatch::CurveKernelTable<T>::Encode30Fn Encoder(GeUint32*, GeSpaceCurve curve)
+    {
+        return curve == GeSpaceCurve::kHilbert ? Kernels<T>().hilbert30 : Kernels<T>().morton30;
+    }
+
+    template <typename T>
+    typename ge::details::dispatch::CurveKernelTable<T>::Encode63Fn Encoder(GeUint64*, GeSpaceCurve curve)
+    {
+        return curve == GeSpaceCurve::kHilbert ? Kernels<T>().hilbert63 : Kernels<T>().morton63;
+    }
+
+    // Points are independent, so the chunking does not affect the keys
+    template <typename T, typename Key>
+    void CurveKeys(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve, Key* keys,
+                   const GeCurveOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kCurveKeys, a.size);
+        const auto fn = Encoder<T>(keys, curve);
+        const ge::details::curve::Grid<T> grid =
+            ge::details::curve::FitGrid(box, ge::details::curve::BitsPerAxis<Key>());
+        auto chunk = [&](GeSize begin, GeSize end) {
+            fn(a.x + begin, a.y + begin, a.z + begin, end - begin, grid.origin, grid.scale, keys + begin);
+        };
+        if (options.parallel)
+            GeParallelFor(0, a.size, options.grainSize, chunk);
+        else
+            chunk(0, a.size);
+    }
+
+    template <typename T>
+    void CurveOrder(GeVector3ArrayCView<T> a, const GeAabb3<T>& box, GeSpaceCurve curve, GeSpan<GeUint32> order,
+                    const GeCurveOptions& options)
+    {
+        assert(a.size == order.size());
+        assert(a.size <= std::numeric_limits<GeUint32>::max());
+
+        using Record = ge::details::radix::IndexedKey<GeUint64>;
+        GeArenaVector<GeUint64> keys(a.size, GeArenaAllocator<GeUint64>(options.pArena));
+        CurveKeys(a, box, curve, keys.data(), options);
+
+        GeArenaVector<Record> records(a.size, GeArenaAllocator<Record>(options.pArena));
+        for (GeSize i = 0; i < a.size; ++i)
+            records[i] = Record{keys[i], static_cast<GeUint32>(i)};
+        ge::details::radix::Sort(records.data(), records.size(), [](const Record& r) { return r.key; },
+                                 options.parallel, options.grainSize, options.pArena);
+
+        for (GeSize k = 0; k < records.size(); ++k)
+            order[k] = records[k].index;
+    }
+} // end of anonymous
+
+template <>
+void GeVector3BatchCurveKeys<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint32> keys, const GeCurveOptions& options)
+{
+    assert(a.size == keys.size());
+    CurveKeys(a, box, curve, keys.data(), options);
+}
+
+template <>
+void GeVector3BatchCurveKeys<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint32> keys, const GeCurveOptions& options)
+{
+    assert(a.size == keys.size());
+    CurveKeys(a, box, curve, keys.data(), options);
+}
+
+template <>
+void GeVector3BatchCurveKeys<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint64> keys, const GeCurveOptions& options)
+{
+    assert(a.size == keys.size());
+    CurveKeys(a, box, curve, keys.data(), options);
+}
+
+template <>
+void GeVector3BatchCurveKeys<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                       GeSpan<GeUint64> keys, const GeCurveOptions& options)
+{
+    assert(a.size == keys.size());
+    CurveKeys(a, box, curve, keys.data(), options);
+}
+
+template <>
+void GeVector3BatchCurveOrder<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeAabb3<GeReal32>& box, GeSpaceCurve curve,
+                                        GeSpan<GeUint32> order, const GeCurveOptions& options)
+{
+    CurveOrder(a, box, curve, order, options);
+}
+
+template <>
+void GeVector3BatchCurveOrder<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeAabb3<GeReal64>& box, GeSpaceCurve curve,
+                                        GeSpan<GeUint32> order, const GeCurveOptions& options)
+{
+    CurveOrder(a, box, curve, order, options);
+}
@@ -0,0 +1,272 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_IMPL_CURVECODES_H
+#define GEOMUTILS_IMPL_CURVECODES_H
+
+// Portable bit manipulation behind gecurve.h: grid cells, Morton bit
+// interleaving and Hilbert keys after J. Skilling, "Programming the Hilbert
+// curve" (2004). Shared by the public scalar functions and the
+// curve kernels, which include it ahead of their target pragmas.
+//
+// In a key the bits of x go to positions 3i + 2, those of y to 3i + 1 and
+// those of z to 3i, so x is the most significant axis of every level.
+
+#include "gebasedefs.h"
+
+namespace ge
+{
+namespace details
+{
+namespace curve
+{
+    // 10 bits per axis in a 30-bit key, 21 in a 63-bit one
+    template <typename Key>
+    constexpr unsigned BitsPerAxis()
+    {
+        return sizeof(Key) == 4 ? 10 : 21;
+    }
+
+    // Low 10 (21) bits of x moved to every third bit
+    constexpr uint32_t Spread3(uint32_t x)
+    {
+        x &= 0x3ffu;
+        x = (x | x << 16) & 0x030000ffu;
+        x = (x | x << 8) & 0x0300f00fu;
+        x = (x | x << 4) & 0x030c30c3u;
+        x = (x | x << 2) & 0x09249249u;
+        return x;
+    }
+
+    constexpr uint64_t Spread3(uint64_t x)
+    {
+        x &= 0x1fffffull;
+        x = (x | x << 32) & 0x001f00000000ffffull;
+        x = (x | x << 16) & 0x001f0000ff0000ffull;
+        x = (x | x << 8) & 0x100f00f00f00f00full;
+        x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+        x = (x | x << 2) & 0x1249249249249249ull;
+        return x;
+    }
+
+    // Inverse of Spread3: every third bit, from bit 0, packed together
+    constexpr uint32_t Compact3(uint32_t x)
+    {
+        x &= 0x09249249u;
+        x = (x | x >> 2) & 0x030c30c3u;
+        x = (x | x >> 4) & 0x0300f00fu;
+        x = (x | x >> 8) & 0x030000ffu;
+        x = (x | x >> 16) & 0x3ffu;
+        return x;
+    }
+
+    constexpr uint64_t Compact3(uint64_t x)
+    {
+        x &= 0x1249249249249249ull;
+        x = (x | x >> 2) & 0x10c30c30c30c30c3ull;
+        x = (x | x >> 4) & 0x100f00f00f00f00full;
+        x = (x | x >> 8) & 0x001f0000ff0000ffull;
+        x = (x | x >> 16) & 0x001f00000000ffffull;
+        x = (x | x >> 32) & 0x1fffffull;
+        return x;
+    }
+
+    // Bits of the z axis; y and x are this shifted by 1 and 2
+    template <typename Key>
+    constexpr Key AxisMask()
+    {
+        return Spread3(~Key(0));
+    }
+
+    template <typename Key>
+    constexpr Key Interleave(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return Key(Spread3(Key(x)) << 2 | Spread3(Key(y)) << 1 | Spread3(Key(z)));
+    }
+
+    template <typename Key>
+    constexpr void Deinterleave(Key key, uint32_t& x, uint32_t& y, uint32_t& z)
+    {
+        x = static_cast<uint32_t>(Compact3(Key(key >> 2)));
+        y = static_cast<uint32_t>(Compact3(Key(key >> 1)));
+        z = static_cast<uint32_t>(Compact3(key));
+    }
+
+    //==========================================================================
+    // Hilbert curve
+    //
+    // Skilling's transform walks the bit levels from the top. At every level
+    // it swaps or inverts the lower bits of the axes depending on the bits of
+    // the level, then Gray-codes the level and XORs it with the parity of the
+    // higher z bits. What it does to a level therefore depends only on the
+    // bits of that level and on a state: the axis permutation and inversions
+    // applied so far and the parity. Running the transform once per (state,
+    // octant) gives a table that maps a Morton key to the Hilbert key one
+    // 3-bit digit at a time.
+
+    const unsigned kHilbertStates = 6 * 8 * 2;
+
+    // Axis permutations; a state is perm * 16 + inversions * 2 + parity
+    constexpr uint8_t kAxisPerms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+    constexpr unsigned AxisPermIndex(const uint8_t perm[3])
+    {
+        for (unsigned k = 0; k < 6; ++k)
+        {
+            if (kAxisPerms[k][0] == perm[0] && kAxisPerms[k][1] == perm[1] && kAxisPerms[k][2] == perm[2])
+                return k;
+        }
+        return 0;
+    }
+
+    // Entries are digit | nextState * 8, so masking the digit off gives the
+    // next row. The paired tables take two levels (6 bits) per lookup, with
+    // entries digits | nextState * 64.
+    struct HilbertTables
+    {
+        uint16_t encode[kHilbertStates * 8];    // (state, Morton digit) -> Hilbert digit
+        uint16_t decode[kHilbertStates * 8];    // (state, Hilbert digit) -> Morton digit
+        uint16_t encode2[kHilbertStates * 64];
+        uint16_t decode2[kHilbertStates * 64];
+    };
+
+    constexpr void PairHilbertTable(const uint16_t* single, uint16_t* paired)
+    {
+        for (unsigned state = 0; state < kHilbertStates; ++state)
+        {
+            for (unsigned digits = 0; digits < 64; ++digits)
+            {
+                const unsigned high = single[state * 8 + (digits >> 3)];
+                const unsigned low = single[(high & ~7u) + (digits & 7)];
+                paired[state * 64 + digits] = static_cast<uint16_t>((high & 7) << 3 | (low & 7) | (low >> 3) * 64);
+            }
+        }
+    }
+
+    constexpr HilbertTables MakeHilbertTables()
+    {
+        HilbertTables tables = {};
+        for (unsigned state = 0; state < kHilbertStates; ++state)
+        {
+            for (unsigned octant = 0; octant < 8; ++octant)
+            {
+                uint8_t perm[3] = {kAxisPerms[state / 16][0], kAxisPerms[state / 16][1], kAxisPerms[state / 16][2]};
+                unsigned flips = (state / 2) % 8;
+                const unsigned parity = state % 2;
+
+                // Bits of the level as the transform sees them; the swaps
+                // and inversions below only touch the lower levels
+                const unsigned raw[3] = {(octant >> 2) & 1, (octant >> 1) & 1, octant & 1};
+                unsigned bit[3] = {};
+                for (unsigned i = 0; i < 3; ++i)
+                    bit[i] = raw[perm[i]] ^ ((flips >> i) & 1);
+
+                for (unsigned i = 0; i < 3; ++i)
+                {
+                    if (bit[i])
+                    {
+                        flips ^= 1;
+                    }
+                    else
+                    {
+                        const uint8_t axis = perm[0];
+                        perm[0] = perm[i];
+                        perm[i] = axis;
+                        const unsigned f0 = flips & 1;
+                        const unsigned fi = (flips >> i) & 1;
+                        flips = (flips & ~(1u | (1u << i))) | fi | (f0 << i);
+                    }
+                }
+
+                const unsigned g0 = bit[0];
+                const unsigned g1 = bit[1] ^ g0;
+                const unsigned g2 = bit[2] ^ g1;
+                const unsigned digit = (g0 ^ parity) << 2 | (g1 ^ parity) << 1 | (g2 ^ parity);
+                const unsigned next = AxisPermIndex(perm) * 16 + flips * 2 + (parity ^ g2);
+
+                tables.encode[state * 8 + octant] = static_cast<uint16_t>(digit | next * 8);
+                tables.decode[state * 8 + digit] = static_cast<uint16_t>(octant | next * 8);
+            }
+        }
+        PairHilbertTable(tables.encode, tables.encode2);
+        PairHilbertTable(tables.decode, tables.decode2);
+        return tables;
+    }
+
+    inline constexpr HilbertTables kHilbertTables = MakeHilbertTables();
+
+    // Maps key through the tables from the top digit down: one level first
+    // when the level count is odd, then two per lookup
+    template <typename Key>
+    constexpr Key HilbertWalk(Key key, const uint16_t* single, const uint16_t* paired)
+    {
+        constexpr unsigned kBits = BitsPerAxis<Key>();
+        Key out = 0;
+        unsigned state = 0;
+        unsigned level = kBits;
+        if (kBits % 2 != 0)
+        {
+            --level;
+            const unsigned entry = single[static_cast<unsigned>((key >> (3 * level)) & 7)];
+            out = Key(entry & 7);
+            state = entry >> 3;
+        }
+        while (level > 0)
+        {
+            level -= 2;
+            const unsigned entry = paired[state * 64 + static_cast<unsigned>((key >> (3 * level)) & 63)];
+            out = Key(out << 6 | (entry & 63));
+            state = entry >> 6;
+        }
+        return out;
+    }
+
+    template <typename Key>
+    constexpr Key MortonToHilbert(Key morton)
+    {
+        return HilbertWalk(morton, kHilbertTables.encode, kHilbertTables.encode2);
+    }
+
+    template <typename Key>
+    constexpr Key HilbertToMorton(Key hilbert)
+    {
+        return HilbertWalk(hilbert, kHilbertTables.decode, kHilbertTables.decode2);
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Grid cell of a coordinate: floor((v - origin) * scale) clamped to
+        [0, maxCell]. NaN goes to cell 0.
+    */
+    template <typename T>
+    inline uint32_t Cell(T v, T origin, T scale, T maxCell)
+    {
+        const T t = (v - origin) * scale;
+        return t > T(0) ? static_cast<uint32_t>(t < maxCell ? t : maxCell) : 0u;
+    }
+} // end of curve
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_CURVECODES_H
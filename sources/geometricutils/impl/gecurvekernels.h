@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_IMPL_CURVEKERNELS_H
+#define GEOMUTILS_IMPL_CURVEKERNELS_H
+
+// Space-filling curve keys behind gecurve.h. Cells and the Hilbert table
+// come from gecurvecodes.h; only the bit interleaving differs per tier, so
+// every tier produces the same keys.
+
+#include "impl/gecurvecodes.h"
+#include "impl/gesimd.h"
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace curvekernels
+{
+    struct InterleaveScalar
+    {
+        template <typename Key>
+        static Key Interleave(uint32_t x, uint32_t y, uint32_t z)
+        {
+            return curve::Interleave<Key>(x, y, z);
+        }
+    };
+
+#ifdef GE_KERNEL_HAS_BMI2
+    //--------------------------------------------------------------------------
+    // One pdep per axis instead of five shift-and-mask steps
+    struct InterleaveBmi2
+    {
+        template <typename Key>
+        static Key Interleave(uint32_t x, uint32_t y, uint32_t z)
+        {
+            constexpr Key kMask = curve::AxisMask<Key>();
+            if constexpr (sizeof(Key) == 4)
+            {
+                return _pdep_u32(x, kMask << 2) | _pdep_u32(y, kMask << 1) | _pdep_u32(z, kMask);
+            }
+            else
+            {
+                return _pdep_u64(x, kMask << 2) | _pdep_u64(y, kMask << 1) | _pdep_u64(z, kMask);
+            }
+        }
+    };
+
+    using InterleaveBest = InterleaveBmi2;
+#else
+    using InterleaveBest = InterleaveScalar;
+#endif // GE_KERNEL_HAS_BMI2
+
+    //--------------------------------------------------------------------------
+    template <typename I, bool kHilbert, typename T, typename Key>
+    void Encode(const T* x, const T* y, const T* z, size_t n, const T* origin, const T* scale, Key* out)
+    {
+        constexpr unsigned kBits = curve::BitsPerAxis<Key>();
+        const T maxCell = static_cast<T>((1u << kBits) - 1);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const Key morton = I::template Interleave<Key>(curve::Cell(x[i], origin[0], scale[0], maxCell),
+                                                           curve::Cell(y[i], origin[1], scale[1], maxCell),
+                                                           curve::Cell(z[i], origin[2], scale[2], maxCell));
+            if constexpr (kHilbert)
+            {
+                out[i] = curve::MortonToHilbert(morton);
+            }
+            else
+            {
+                out[i] = morton;
+            }
+        }
+    }
+} // end of curvekernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_CURVEKERNELS_H
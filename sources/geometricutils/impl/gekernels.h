@@ -0,0 +1,169 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_KERNELS_H
+#define GEOMUTILS_IMPL_KERNELS_H
+
+// Function-pointer tables of the batch kernels, one per GeSimdTier. Each
+// tier is built in its own translation unit (gekernels_<tier>.cpp);
+// ActiveKernelTable() returns the table selected at runtime.
+
+#include "gebasedefs.h"
+#include "gebaseutl.h"
+#include "gecpufeatures.h"
+#include "impl/gecurvecodes.h"
+#include "impl/gerealcompare.h"
+
+namespace ge
+{
+namespace details
+{
+namespace dispatch
+{
+    template <typename T>
+    struct Vector3KernelTable
+    {
+        void (*dot)(const T* ax, const T* ay, const T* az,
+                    const T* bx, const T* by, const T* bz, T* out, size_t n);
+        void (*cross)(const T* ax, const T* ay, const T* az,
+                      const T* bx, const T* by, const T* bz,
+                      T* ox, T* oy, T* oz, size_t n);
+        void (*magnitudeSquare)(const T* x, const T* y, const T* z, T* out, size_t n);
+        using MagnitudeFn = void (*)(const T* x, const T* y, const T* z, T* out, size_t n);
+        using NormalizeFn = void (*)(const T* x, const T* y, const T* z,
+                                     T* ox, T* oy, T* oz, size_t n);
+
+        // Indexed by GePrecision
+        MagnitudeFn magnitude[3];
+        NormalizeFn normalize[3];
+        MagnitudeFn invMagnitude[3];
+
+        // Block reductions behind gevector3reduce.h
+        void (*bounds)(const T* x, const T* y, const T* z, size_t n, T* lo, T* hi);
+        void (*sum)(const T* x, const T* y, const T* z, size_t n, T* sum);
+        size_t (*extreme)(const T* x, const T* y, const T* z, size_t n, const T* dir, T* best);
+
+        // Matrix transforms behind getransform.h; m is row-major 3x3, 3x4 or 4x4
+        using TransformFn = void (*)(const T* x, const T* y, const T* z, const T* m,
+                                     T* ox, T* oy, T* oz, size_t n);
+        TransformFn linear;
+        TransformFn affine;
+        TransformFn projective;
+    };
+
+    struct UlpKernelTable
+    {
+        void (*equalBools)(const real32_t* a, const real32_t* b, int32_t tol, bool* out, size_t n);
+        void (*lessBools)(const real32_t* a, const real32_t* b, int32_t tol, bool* out, size_t n);
+        void (*equalBits)(const real32_t* a, const real32_t* b, int32_t tol, uint64_t* out, size_t n);
+        void (*lessBits)(const real32_t* a, const real32_t* b, int32_t tol, uint64_t* out, size_t n);
+    };
+
+    // Tolerant comparisons of n values against a fixed one, as
+    // RealCompareFused(values[i], fixed) gives them; indexed by GeRealOrder
+    // + 1 (less, equal, greater, unordered). filter stores the selected
+    // positions in increasing order and returns their count, mask sets bit
+    // i % 64 of word i / 64.
+    template <typename T>
+    struct RealFilterKernelTable
+    {
+        using FilterFn = size_t (*)(const T* values, size_t n, const RealCompareFixed<T>& fixed, uint32_t* out);
+        using MaskFn = void (*)(const T* values, size_t n, const RealCompareFixed<T>& fixed, uint64_t* out);
+        FilterFn filter[4];
+        MaskFn mask[4];
+    };
+
+    // n words; in and out may be the same buffer
+    struct ByteSwapKernelTable
+    {
+        void (*swap32)(const void* in, void* out, size_t n);
+        void (*swap64)(const void* in, void* out, size_t n);
+    };
+
+    // n elements; see gequantizekernels.h for the conversion rules
+    template <typename T>
+    struct QuantizeKernelTable
+    {
+        void (*quantize32)(const T* in, size_t n, T origin, T scale, int32_t* out);
+        void (*quantize16)(const T* in, size_t n, T origin, T scale, int16_t* out);
+        void (*dequantize32)(const int32_t* in, size_t n, T origin, T step, T* out);
+        void (*dequantize16)(const int16_t* in, size_t n, T origin, T step, T* out);
+    };
+
+    struct HalfKernelTable
+    {
+        void (*encode)(const real32_t* in, uint16_t* out, size_t n);
+        void (*decode)(const uint16_t* in, real32_t* out, size_t n);
+    };
+
+    struct OctahedralKernelTable
+    {
+        void (*encode)(const real32_t* x, const real32_t* y, const real32_t* z, uint32_t* out, size_t n);
+        void (*decode)(const uint32_t* in, real32_t* x, real32_t* y, real32_t* z, size_t n);
+    };
+
+    // Keys of n points; cells are floor((p - origin) * scale) per axis,
+    // see gecurvecodes.h
+    template <typename T>
+    struct CurveKernelTable
+    {
+        using Encode30Fn = void (*)(const T* x, const T* y, const T* z, size_t n,
+                                    const T* origin, const T* scale, uint32_t* out);
+        using Encode63Fn = void (*)(const T* x, const T* y, const T* z, size_t n,
+                                    const T* origin, const T* scale, uint64_t* out);
+        Encode30Fn morton30;
+        Encode63Fn morton63;
+        Encode30Fn hilbert30;
+        Encode63Fn hilbert63;
+    };
+
+    struct KernelTable
+    {
+        GeSimdTier tier;
+        Vector3KernelTable<real32_t> vector3f;
+        Vector3KernelTable<real64_t> vector3d;
+        UlpKernelTable ulp;
+        RealFilterKernelTable<real32_t> filterf;
+        RealFilterKernelTable<real64_t> filterd;
+        ByteSwapKernelTable byteSwap;
+        QuantizeKernelTable<real32_t> quantizef;
+        QuantizeKernelTable<real64_t> quantized;
+        HalfKernelTable half;
+        OctahedralKernelTable octahedral;
+        CurveKernelTable<real32_t> curvef;
+        CurveKernelTable<real64_t> curved;
+    };
+
+    // nullptr when the tier is not compiled for this target
+    const KernelTable* GetScalarKernelTable();
+    const KernelTable* GetSse2KernelTable();
+    const KernelTable* GetAvx2KernelTable();
+    const KernelTable* GetAvx512KernelTable();
+
+    const KernelTable& ActiveKernelTable();
+
+} // end of dispatch
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_KERNELS_H
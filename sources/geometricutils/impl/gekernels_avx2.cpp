@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+// AVX2 kernel tier. Headers outside the kernel set are included before
+// the target pragma so none of their inline functions pick up AVX2 code.
+
+#include "impl/gekernels.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   include <immintrin.h>
+#   pragma GCC push_options
+#   pragma GCC target("avx2,f16c,bmi2")
+#   define GE_KERNEL_ENABLE_AVX2
+#   define GE_KERNEL_ENABLE_F16C        // every AVX2 part has it; the tier requires both
+#   define GE_KERNEL_ENABLE_BMI2        // likewise
+#endif
+
+#define GE_KERNEL_TIER avx2
+#include "impl/gekernelsimpl.h"
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   pragma GCC pop_options
+#endif
+
+const ge::details::dispatch::KernelTable* ge::details::dispatch::GetAvx2KernelTable()
+{
+#ifdef GE_KERNEL_HAS_AVX2
+    using namespace ge::details::kerneltables;
+
+    static const KernelTable s_table = MakeKernelTable<simd::F32x8, simd::F64x4, ulpkernels::UlpAvx2,
+                                                       filterkernels::FilterF32Avx2, filterkernels::FilterF64Avx2,
+                                                       byteswapkernels::BswapAvx2, quantizekernels::QuantF32Avx2, quantizekernels::QuantF64Avx2,
+                                                       compressedkernels::HalfF16c, curvekernels::InterleaveBest>(GeSimdTier::kAvx2);
+    return &s_table;
+#else
+    return nullptr;
+#endif
+}
@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+// AVX-512 kernel tier. Headers outside the kernel set are included before
+// the target pragma so none of their inline functions pick up AVX-512 code.
+
+#include "impl/gekernels.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   include <immintrin.h>
+#   pragma GCC push_options
+#   pragma GCC target("avx512f,bmi2")
+#   define GE_KERNEL_ENABLE_AVX512
+#   define GE_KERNEL_ENABLE_AVX2        // implied by AVX512F; used for byte shuffles and quantizing
+#   define GE_KERNEL_ENABLE_BMI2        // required by the tier, for curve keys
+#endif
+
+#define GE_KERNEL_TIER avx512
+#include "impl/gekernelsimpl.h"
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   pragma GCC pop_options
+#endif
+
+const ge::details::dispatch::KernelTable* ge::details::dispatch::GetAvx512KernelTable()
+{
+#ifdef GE_KERNEL_HAS_AVX512
+    using namespace ge::details::kerneltables;
+
+    static const KernelTable s_table = MakeKernelTable<simd::F32x16, simd::F64x8, ulpkernels::UlpAvx512,
+                                                       filterkernels::FilterF32Avx512, filterkernels::FilterF64Avx512,
+                                                       byteswapkernels::BswapAvx2, quantizekernels::QuantF32Avx2, quantizekernels::QuantF64Avx2,
+                                                       compressedkernels::HalfAvx512, curvekernels::InterleaveBest>(GeSimdTier::kAvx512);
+    return &s_table;
+#else
+    return nullptr;
+#endif
+}
@@ -0,0 +1,42 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+// Portable kernels, used when no SIMD tier is available or when forced.
+
+#include "impl/gekernels.h"
+
+#define GE_KERNEL_TIER scalar
+#include "impl/gekernelsimpl.h"
+
+const ge::details::dispatch::KernelTable* ge::details::dispatch::GetScalarKernelTable()
+{
+    using namespace ge::details::kerneltables;
+
+    static const KernelTable s_table = MakeKernelTable<simd::ScalarPack<GeReal32>, simd::ScalarPack<GeReal64>, ulpkernels::UlpScalar,
+                                                       filterkernels::FilterScalar<GeReal32>, filterkernels::FilterScalar<GeReal64>,
+                                                       byteswapkernels::BswapScalar, quantizekernels::QuantScalar<GeReal32>, quantizekernels::QuantScalar<GeReal64>,
+                                                       compressedkernels::HalfScalar, curvekernels::InterleaveScalar>(GeSimdTier::kScalar);
+    return &s_table;
+}
@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+// SSE2 kernel tier. Headers outside the kernel set are included before
+// the target pragma so none of their inline functions pick up SSE2 code.
+
+#include "impl/gekernels.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   include <immintrin.h>
+#   pragma GCC push_options
+#   pragma GCC target("sse2")
+#   define GE_KERNEL_ENABLE_SSE2
+#endif
+
+#define GE_KERNEL_TIER sse2
+#include "impl/gekernelsimpl.h"
+
+#if defined(GE_ARCH_X86) && defined(GE_GCC_COMPILER)
+#   pragma GCC pop_options
+#endif
+
+const ge::details::dispatch::KernelTable* ge::details::dispatch::GetSse2KernelTable()
+{
+#ifdef GE_KERNEL_HAS_SSE2
+    using namespace ge::details::kerneltables;
+
+    static const KernelTable s_table = MakeKernelTable<simd::F32x4, simd::F64x2, ulpkernels::UlpSse2,
+                                                       filterkernels::FilterF32Sse2, filterkernels::FilterScalar<GeReal64>,
+                                                       byteswapkernels::BswapSse2, quantizekernels::QuantF32Sse2, quantizekernels::QuantF64Sse2,
+                                                       compressedkernels::HalfSse2, curvekernels::InterleaveScalar>(GeSimdTier::kSse2);
+    return &s_table;
+#else
+    return nullptr;
+#endif
+}
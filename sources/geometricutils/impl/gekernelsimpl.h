@@ -0,0 +1,184 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_KERNELSIMPL_H
+#define GEOMUTILS_IMPL_KERNELSIMPL_H
+
+// Builds a KernelTable from the lane packs of one tier. Included only by the
+// gekernels_<tier>.cpp translation units.
+//
+// Contraction into FMA is disabled for the kernels: tiers that imply FMA
+// (AVX-512) would otherwise round differently from the others and from the
+// scalar GeVector3 code.
+
+#include "gebasedefs.h"
+
+#if defined(__clang__)
+#   pragma clang fp contract(off)
+#elif defined(GE_GCC_COMPILER)
+#   pragma GCC push_options
+#   pragma GCC optimize("fp-contract=off")
+#endif
+
+#include "impl/gekernels.h"
+#include "impl/gesimd.h"
+#include "impl/gevector3kernels.h"
+#include "impl/geulpkernels.h"
+#include "impl/gerealfilterkernels.h"
+#include "impl/gebyteswapkernels.h"
+#include "impl/gequantizekernels.h"
+#include "impl/gecompressedkernels.h"
+#include "impl/gecurvekernels.h"
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace kerneltables
+{
+    template <typename P>
+    dispatch::Vector3KernelTable<typename P::value_type> MakeVector3KernelTable()
+    {
+        return {
+            &vector3kernels::Dot<P, typename P::value_type>,
+            &vector3kernels::Cross<P, typename P::value_type>,
+            &vector3kernels::MagnitudeSquare<P, typename P::value_type>,
+            {
+                &vector3kernels::MagnitudeP<P, GePrecision::kExact, typename P::value_type>,
+                &vector3kernels::MagnitudeP<P, GePrecision::kRefined, typename P::value_type>,
+                &vector3kernels::MagnitudeP<P, GePrecision::kApproximate, typename P::value_type>
+            },
+            {
+                &vector3kernels::NormalizeP<P, GePrecision::kExact, typename P::value_type>,
+                &vector3kernels::NormalizeP<P, GePrecision::kRefined, typename P::value_type>,
+                &vector3kernels::NormalizeP<P, GePrecision::kApproximate, typename P::value_type>
+            },
+            {
+                &vector3kernels::InvMagnitude<P, GePrecision::kExact, typename P::value_type>,
+                &vector3kernels::InvMagnitude<P, GePrecision::kRefined, typename P::value_type>,
+                &vector3kernels::InvMagnitude<P, GePrecision::kApproximate, typename P::value_type>
+            },
+            &vector3kernels::Bounds<P, typename P::value_type>,
+            &vector3kernels::Sum<P, typename P::value_type>,
+            &vector3kernels::Extreme<P, typename P::value_type>,
+            &vector3kernels::Linear<P, typename P::value_type>,
+            &vector3kernels::Affine<P, typename P::value_type>,
+            &vector3kernels::Projective<P, typename P::value_type>
+        };
+    }
+
+    template <typename K>
+    dispatch::UlpKernelTable MakeUlpKernelTable()
+    {
+        return {
+            &ulpkernels::ToBools<K, ulpkernels::EqualOp>,
+            &ulpkernels::ToBools<K, ulpkernels::LessOp>,
+            &ulpkernels::ToBits<K, ulpkernels::EqualOp>,
+            &ulpkernels::ToBits<K, ulpkernels::LessOp>
+        };
+    }
+
+    template <typename K>
+    dispatch::RealFilterKernelTable<typename K::value_type> MakeRealFilterKernelTable()
+    {
+        return {
+            {
+                &filterkernels::Filter<K, filterkernels::LessOp>,
+                &filterkernels::Filter<K, filterkernels::EqualOp>,
+                &filterkernels::Filter<K, filterkernels::GreaterOp>,
+                &filterkernels::Filter<K, filterkernels::UnorderedOp>
+            },
+            {
+                &filterkernels::Mask<K, filterkernels::LessOp>,
+                &filterkernels::Mask<K, filterkernels::EqualOp>,
+                &filterkernels::Mask<K, filterkernels::GreaterOp>,
+                &filterkernels::Mask<K, filterkernels::UnorderedOp>
+            }
+        };
+    }
+
+    template <typename B>
+    dispatch::ByteSwapKernelTable MakeByteSwapKernelTable()
+    {
+        return {
+            &byteswapkernels::Swap32<B>,
+            &byteswapkernels::Swap64<B>
+        };
+    }
+
+    template <typename Q>
+    dispatch::QuantizeKernelTable<typename Q::value_type> MakeQuantizeKernelTable()
+    {
+        return {
+            &quantizekernels::Quantize<Q, int32_t>,
+            &quantizekernels::Quantize<Q, int16_t>,
+            &quantizekernels::Dequantize<Q, int32_t>,
+            &quantizekernels::Dequantize<Q, int16_t>
+        };
+    }
+
+    template <typename H>
+    dispatch::HalfKernelTable MakeHalfKernelTable()
+    {
+        return {&compressedkernels::EncodeHalf<H>, &compressedkernels::DecodeHalf<H>};
+    }
+
+    template <typename PF>
+    dispatch::OctahedralKernelTable MakeOctahedralKernelTable()
+    {
+        return {&compressedkernels::OctEncode<PF>, &compressedkernels::OctDecode<PF>};
+    }
+
+    template <typename I, typename T>
+    dispatch::CurveKernelTable<T> MakeCurveKernelTable()
+    {
+        return {
+            &curvekernels::Encode<I, false, T, uint32_t>,
+            &curvekernels::Encode<I, false, T, uint64_t>,
+            &curvekernels::Encode<I, true, T, uint32_t>,
+            &curvekernels::Encode<I, true, T, uint64_t>
+        };
+    }
+
+    template <typename PF, typename PD, typename K, typename FF, typename FD, typename B, typename QF, typename QD,
+              typename H, typename I>
+    dispatch::KernelTable MakeKernelTable(GeSimdTier tier)
+    {
+        return {tier, MakeVector3KernelTable<PF>(), MakeVector3KernelTable<PD>(), MakeUlpKernelTable<K>(),
+                MakeRealFilterKernelTable<FF>(), MakeRealFilterKernelTable<FD>(), MakeByteSwapKernelTable<B>(), MakeQuantizeKernelTable<QF>(), MakeQuantizeKernelTable<QD>(),
+                MakeHalfKernelTable<H>(), MakeOctahedralKernelTable<PF>(),
+                MakeCurveKernelTable<I, real32_t>(), MakeCurveKernelTable<I, real64_t>()};
+    }
+
+} // end of kerneltables
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#if !defined(__clang__) && defined(GE_GCC_COMPILER)
+#   pragma GCC pop_options
+#endif
+
+#endif // GEOMUTILS_IMPL_KERNELSIMPL_H
@@ -0,0 +1,337 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "geparallel.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace ge
+{
+namespace details
+{
+namespace parallel
+{
+    struct Task
+    {
+        Job* pJob;
+        GeSize begin;
+        GeSize end;
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+        Deque of one worker: the owner pushes and pops at the back, thieves
+        take from the front, where the largest ranges are.
+    */
+    class WorkQueue
+    {
+    public:
+        void Push(const Task& task)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(task);
+        }
+
+        bool Pop(Task& task)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_tasks.empty())
+                return false;
+            task = m_tasks.back();
+            m_tasks.pop_back();
+            return true;
+        }
+
+        bool Steal(Task& task)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_tasks.empty())
+                return false;
+            task = m_tasks.front();
+            m_tasks.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+        Workers and their queues. Queue 0 is shared by the threads outside
+        the pool; worker w owns queue w.
+    */
+    class Pool
+    {
+    public:
+        Pool(GeScheduler& scheduler, GeSize workerCount);
+        ~Pool();
+
+        // Queue of the calling thread in this pool
+        GeSize QueueOfCaller() const;
+
+        void Execute(GeSize queue, Task task);
+        void Help(GeSize queue, const Job& job);
+
+    private:
+        void Push(GeSize queue, const Task& task);
+        bool Take(GeSize queue, Task& task);
+        void WorkerLoop(GeSize queue);
+
+        GeScheduler& m_scheduler;
+        // Idle rounds a worker, or a thread waiting for its job, spins
+        // through before sleeping
+        static constexpr int kSpinRounds = 64;
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<GeSize> m_queued{0};
+        std::atomic<GeSize> m_sleeping{0};
+        std::atomic<GeSize> m_waiting{0};     // threads sleeping in Help
+        std::atomic<bool> m_stop{false};
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+    };
+
+    // Pool and queue of a worker thread; null elsewhere
+    thread_local Pool* t_pWorkerPool = nullptr;
+    thread_local GeSize t_workerQueue = 0;
+
+    // Scheduler selected with GeSchedulerScope
+    thread_local GeScheduler* t_pScopeScheduler = nullptr;
+
+    // Scheduler of the pool a worker belongs to
+    thread_local GeScheduler* t_pWorkerScheduler = nullptr;
+
+    Pool::Pool(GeScheduler& scheduler, GeSize workerCount)
+        : m_scheduler{scheduler}
+    {
+        m_queues.reserve(workerCount + 1);
+        for (GeSize q = 0; q <= workerCount; ++q)
+            m_queues.push_back(std::make_unique<WorkQueue>());
+
+        m_workers.reserve(workerCount);
+        for (GeSize w = 1; w <= workerCount; ++w)
+            m_workers.emplace_back([this, w]() { WorkerLoop(w); });
+    }
+
+    Pool::~Pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop.store(true);
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    GeSize Pool::QueueOfCaller() const
+    {
+        return t_pWorkerPool == this ? t_workerQueue : 0;
+    }
+
+    void Pool::Push(GeSize queue, const Task& task)
+    {
+        m_queues[queue]->Push(task);
+        // A sleeper counts itself before checking m_queued, a pusher
+        // counts the task before checking m_sleeping: one of them sees
+        // the other
+        m_queued.fetch_add(1);
+        if (m_sleeping.load() > 0 || m_waiting.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_wake.notify_one();
+            m_done.notify_one();
+        }
+    }
+
+    bool Pool::Take(GeSize queue, Task& task)
+    {
+        bool found = m_queues[queue]->Pop(task);
+        for (GeSize k = 1; !found && k < m_queues.size(); ++k)
+            found = m_queues[(queue + k) % m_queues.size()]->Steal(task);
+        if (found)
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return found;
+    }
+
+    void Pool::Execute(GeSize queue, Task task)
+    {
+        Job& job = *task.pJob;
+        while (task.end - task.begin >= 2 * job.grain)
+        {
+            const GeSize middle = task.begin + (task.end - task.begin) / 2;
+            Push(queue, Task{&job, middle, task.end});
+            task.end = middle;
+        }
+
+        if (!job.failed.load(std::memory_order_relaxed))
+        {
+            try
+            {
+                job.run(job, task.begin, task.end);
+            }
+            catch (...)
+            {
+                if (!job.failed.exchange(true))
+                    job.error = std::current_exception();
+            }
+        }
+        // last access to the job: its owner may return once it drops to
+        // zero. As in Push, the owner counts itself as waiting before it
+        // checks the job, so one of the two sees the other.
+        const GeSize count = task.end - task.begin;
+        if (job.remaining.fetch_sub(count) == count && m_waiting.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_done.notify_all();
+        }
+    }
+
+    void Pool::Help(GeSize queue, const Job& job)
+    {
+        Task task;
+        int idle = 0;
+        while (job.remaining.load(std::memory_order_acquire) != 0)
+        {
+            if (Take(queue, task))
+            {
+                Execute(queue, task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < kSpinRounds)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // The rest of the job runs on other threads: sleep until it is
+            // done or there is new work to help with
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_waiting.fetch_add(1);
+            m_done.wait(lock, [this, &job]() { return job.remaining.load() == 0 || m_queued.load() > 0; });
+            m_waiting.fetch_sub(1);
+            idle = 0;
+        }
+    }
+
+    void Pool::WorkerLoop(GeSize queue)
+    {
+        t_pWorkerPool = this;
+        t_workerQueue = queue;
+        t_pWorkerScheduler = &m_scheduler;
+
+        Task task;
+        int idle = 0;
+        while (!m_stop.load(std::memory_order_relaxed))
+        {
+            if (Take(queue, task))
+            {
+                Execute(queue, task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < kSpinRounds)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleeping.fetch_add(1);
+            m_wake.wait(lock, [this]() { return m_stop.load() || m_queued.load() > 0; });
+            m_sleeping.fetch_sub(1);
+            idle = 0;
+        }
+    }
+
+    GeScheduler& ActiveScheduler()
+    {
+        if (t_pScopeScheduler)
+            return *t_pScopeScheduler;
+        if (t_pWorkerScheduler)
+            return *t_pWorkerScheduler;
+        return GeDefaultScheduler();
+    }
+} // end of parallel
+} // end of details
+} // end of ge
+
+void ge::details::parallel::Run(Job& job, GeSize begin, GeSize end)
+{
+    Pool* pPool = ActiveScheduler().m_pPool.get();
+    if (!pPool)
+    {
+        job.run(job, begin, end);
+        return;
+    }
+
+    const GeSize queue = pPool->QueueOfCaller();
+    pPool->Execute(queue, Task{&job, begin, end});
+    pPool->Help(queue, job);
+    if (job.failed.load(std::memory_order_acquire))
+        std::rethrow_exception(job.error);
+}
+
+GeScheduler::GeScheduler(GeSize threadCount)
+    : m_threadCount{std::max<GeSize>(threadCount, 1)}
+{
+    if (m_threadCount > 1)
+        m_pPool = std::make_unique<ge::details::parallel::Pool>(*this, m_threadCount - 1);
+}
+
+GeScheduler::~GeScheduler() = default;
+
+GeScheduler& GeDefaultScheduler()
+{
+    static GeScheduler s_scheduler(GeGetHardwareConcurrency());
+    return s_scheduler;
+}
+
+GeSchedulerScope::GeSchedulerScope(GeScheduler& scheduler)
+    : m_pPrevious{ge::details::parallel::t_pScopeScheduler}
+{
+    ge::details::parallel::t_pScopeScheduler = &scheduler;
+}
+
+GeSchedulerScope::~GeSchedulerScope()
+{
+    ge::details::parallel::t_pScopeScheduler = m_pPrevious;
+}
+
+GeSize GeGetConcurrency()
+{
+    using namespace ge::details::parallel;
+    if (t_pScopeScheduler)
+        return t_pScopeScheduler->ThreadCount();
+    if (t_pWorkerScheduler)
+        return t_pWorkerScheduler->ThreadCount();
+    return GeGetHardwareConcurrency();
+}
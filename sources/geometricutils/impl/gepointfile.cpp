@@ -0,0 +1,478 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gepointfile.h"
+#include "geparallel.h"
+#include "impl/gepointfileformat.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace
+{
+    using namespace ge::details::pointfile;
+
+    // Points per write buffer
+    const GeSize kChunkSize = 1 << 16;
+
+    static_assert(sizeof(GeVector3<GeReal32>) == 3 * sizeof(GeReal32), "AoS payload maps onto GeVector3");
+    static_assert(sizeof(GeVector3<GeReal64>) == 3 * sizeof(GeReal64), "AoS payload maps onto GeVector3");
+
+    //--------------------------------------------------------------------------
+    // Writing. A source hands out points in either layout, one chunk at a
+    // time.
+
+    template <typename T>
+    struct LaneSource
+    {
+        GeVector3ArrayCView<T> points;
+
+        void CopyLane(int axis, GeSize begin, GeSize n, T* out) const
+        {
+            const T* lanes[3] = {points.x, points.y, points.z};
+            std::memcpy(out, lanes[axis] + begin, n * sizeof(T));
+        }
+
+        void CopyPoints(GeSize begin, GeSize n, T* out) const
+        {
+            for (GeSize i = 0; i < n; ++i)
+            {
+                out[3 * i + 0] = points.x[begin + i];
+                out[3 * i + 1] = points.y[begin + i];
+                out[3 * i + 2] = points.z[begin + i];
+            }
+        }
+    };
+
+    template <typename T>
+    struct PointSource
+    {
+        GeSpan<const GeVector3<T>> points;
+
+        void CopyLane(int axis, GeSize begin, GeSize n, T* out) const
+        {
+            for (GeSize i = 0; i < n; ++i)
+            {
+                const GeVector3<T>& p = points[begin + i];
+                out[i] = axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+            }
+        }
+
+        void CopyPoints(GeSize begin, GeSize n, T* out) const
+        {
+            std::memcpy(out, points.data() + begin, n * sizeof(GeVector3<T>));
+        }
+    };
+
+    class FileWriter
+    {
+    public:
+        explicit FileWriter(const char* path)
+            : m_pFile{std::fopen(path, "wb")}
+            {}
+
+        ~FileWriter()
+        {
+            if (m_pFile != nullptr)
+                std::fclose(m_pFile);
+        }
+
+        bool IsOpen() const { return m_pFile != nullptr; }
+
+        bool Write(const void* pData, GeSize bytes)
+        {
+            return bytes == 0 || std::fwrite(pData, 1, bytes, m_pFile) == bytes;
+        }
+
+        bool Pad(GeSize bytes)
+        {
+            const GeByte zeros[kAlignment] = {};
+            return bytes <= kAlignment && Write(zeros, bytes);
+        }
+
+        bool Close()
+        {
+            const bool ok = std::fclose(m_pFile) == 0;
+            m_pFile = nullptr;
+            return ok;
+        }
+
+    private:
+        std::FILE* m_pFile;
+    };
+
+    template <typename T, typename Source>
+    bool WritePointFile(const char* path, const Source& source, GeSize count,
+                        GePointLayout layout, GeByteOrder order)
+    {
+        FileWriter file(path);
+        if (!file.IsOpen())
+            return false;
+
+        const bool swap = order != GeNativeByteOrder();
+        Header header;
+        header.layout = layout;
+        header.order = order;
+        header.scalarSize = static_cast<GeUint8>(sizeof(T));
+        header.count = count;
+        header.laneStride = layout == GePointLayout::kSoa ? RoundUp(header.LaneBytes(), kAlignment) : 0;
+        const GeSize laneBytes = header.LaneBytes();
+        const GeSize laneStride = static_cast<GeSize>(header.laneStride);
+
+        GeByte encoded[kHeaderSize];
+        EncodeHeader(header, encoded);
+        if (!file.Write(encoded, kHeaderSize))
+            return false;
+
+        std::vector<T> chunk(3 * std::min(count, kChunkSize));
+        if (layout == GePointLayout::kSoa)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                for (GeSize begin = 0; begin < count; begin += kChunkSize)
+                {
+                    const GeSize n = std::min(kChunkSize, count - begin);
+                    source.CopyLane(axis, begin, n, chunk.data());
+                    if (swap)
+                        SwapWords<T>(chunk.data(), chunk.data(), n);
+                    if (!file.Write(chunk.data(), n * sizeof(T)))
+                        return false;
+                }
+                if (!file.Pad(laneStride - laneBytes))
+                    return false;
+            }
+        }
+        else
+        {
+            for (GeSize begin = 0; begin < count; begin += kChunkSize)
+            {
+                const GeSize n = std::min(kChunkSize, count - begin);
+                source.CopyPoints(begin, n, chunk.data());
+                if (swap)
+                    SwapWords<T>(chunk.data(), chunk.data(), 3 * n);
+                if (!file.Write(chunk.data(), 3 * n * sizeof(T)))
+                    return false;
+            }
+        }
+        return file.Close();
+    }
+
+    //--------------------------------------------------------------------------
+    // Mapping
+
+    const GeByte* MapFile(const char* path, GeSize& size)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        const GeByte* pData = nullptr;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                // the view keeps the mapping alive
+                pData = static_cast<const GeByte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+            size = static_cast<GeSize>(fileSize.QuadPart);
+        }
+        CloseHandle(file);
+        return pData;
+#else
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat info;
+        const GeByte* pData = nullptr;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            size = static_cast<GeSize>(info.st_size);
+            void* pMapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pMapped != MAP_FAILED)
+                pData = static_cast<const GeByte*>(pMapped);
+        }
+        ::close(fd);
+        return pData;
+#endif
+    }
+
+    void UnmapFile(const GeByte* pData, GeSize size)
+    {
+#ifdef _WIN32
+        (void)size;
+        UnmapViewOfFile(pData);
+#else
+        ::munmap(const_cast<GeByte*>(pData), size);
+#endif
+    }
+} // end of anonymous
+
+//==============================================================================
+// Writing
+
+template <typename T>
+bool GeWritePointFile(const char* path, GeVector3ArrayCView<T> points, GePointLayout layout, GeByteOrder order)
+{
+    return WritePointFile<T>(path, LaneSource<T>{points}, points.size, layout, order);
+}
+
+template <typename T>
+bool GeWritePointFile(const char* path, GeSpan<const GeVector3<T>> points, GePointLayout layout, GeByteOrder order)
+{
+    return WritePointFile<T>(path, PointSource<T>{points}, points.size(), layout, order);
+}
+
+template bool GeWritePointFile<GeReal32>(const char*, GeVector3ArrayCView<GeReal32>, GePointLayout, GeByteOrder);
+template bool GeWritePointFile<GeReal64>(const char*, GeVector3ArrayCView<GeReal64>, GePointLayout, GeByteOrder);
+template bool GeWritePointFile<GeReal32>(const char*, GeSpan<const GeVector3<GeReal32>>, GePointLayout, GeByteOrder);
+template bool GeWritePointFile<GeReal64>(const char*, GeSpan<const GeVector3<GeReal64>>, GePointLayout, GeByteOrder);
+
+//==============================================================================
+// GePointFile
+
+GePointFile::~GePointFile()
+{
+    Close();
+}
+
+GePointFile::GePointFile(GePointFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+GePointFile& GePointFile::operator=(GePointFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_pData = std::exchange(other.m_pData, nullptr);
+        m_mappedSize = std::exchange(other.m_mappedSize, 0);
+        m_count = std::exchange(other.m_count, 0);
+        m_payloadOffset = other.m_payloadOffset;
+        m_laneStride = other.m_laneStride;
+        m_version = other.m_version;
+        m_layout = other.m_layout;
+        m_order = other.m_order;
+        m_scalarSize = other.m_scalarSize;
+    }
+    return *this;
+}
+
+bool GePointFile::Open(const char* path)
+{
+    Close();
+
+    GeSize size = 0;
+    const GeByte* pData = MapFile(path, size);
+    if (pData == nullptr)
+        return false;
+
+    Header header;
+    if (!DecodeHeader(pData, size, header))
+    {
+        UnmapFile(pData, size);
+        return false;
+    }
+
+    m_pData = pData;
+    m_mappedSize = size;
+    m_count = static_cast<GeSize>(header.count);
+    m_payloadOffset = static_cast<GeSize>(header.payloadOffset);
+    m_laneStride = static_cast<GeSize>(header.laneStride);
+    m_version = header.version;
+    m_layout = header.layout;
+    m_order = header.order;
+    m_scalarSize = header.scalarSize;
+    return true;
+}
+
+void GePointFile::Close()
+{
+    if (m_pData != nullptr)
+        UnmapFile(m_pData, m_mappedSize);
+    m_pData = nullptr;
+    m_mappedSize = 0;
+    m_count = 0;
+}
+
+template <typename T>
+const T* GePointFile::Lane(int axis) const
+{
+    return reinterpret_cast<const T*>(m_pData + m_payloadOffset + static_cast<GeSize>(axis) * m_laneStride);
+}
+
+template <typename T>
+bool GePointFile::ViewLanes(GeVector3ArrayCView<T>& out) const
+{
+    if (!IsNative() || m_layout != GePointLayout::kSoa || m_scalarSize != sizeof(T))
+        return false;
+
+    out = GeVector3ArrayCView<T>{Lane<T>(0), Lane<T>(1), Lane<T>(2), m_count};
+    return true;
+}
+
+template <typename T>
+bool GePointFile::ViewPoints(GeSpan<const GeVector3<T>>& out) const
+{
+    if (!IsNative() || m_layout != GePointLayout::kAos || m_scalarSize != sizeof(T))
+        return false;
+
+    out = GeSpan<const GeVector3<T>>(reinterpret_cast<const GeVector3<T>*>(m_pData + m_payloadOffset), m_count);
+    return true;
+}
+
+template <typename T>
+bool GePointFile::ReadLanes(GeVector3Array<T>& out) const
+{
+    if (!IsOpen() || m_scalarSize != sizeof(T))
+        return false;
+
+    out.resize(m_count);
+    if (m_count == 0)
+        return true;
+
+    T* lanes[3] = {out.x(), out.y(), out.z()};
+    const bool swap = !IsNative();
+    if (m_layout == GePointLayout::kSoa)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (swap)
+                SwapWords<T>(Lane<T>(axis), lanes[axis], m_count);
+            else
+                std::memcpy(lanes[axis], Lane<T>(axis), m_count * sizeof(T));
+        }
+        return true;
+    }
+
+    const T* points = Lane<T>(0);
+    GeParallelFor(0, m_count, kChunkSize, [&](GeSize begin, GeSize end) {
+        for (GeSize i = begin; i < end; ++i)
+        {
+            lanes[0][i] = points[3 * i + 0];
+            lanes[1][i] = points[3 * i + 1];
+            lanes[2][i] = points[3 * i + 2];
+        }
+    });
+    if (swap)
+    {
+        for (T* lane : lanes)
+            SwapWords<T>(lane, lane, m_count);
+    }
+    return true;
+}
+
+template <typename T>
+bool GePointFile::ReadPoints(std::vector<GeVector3<T>>& out) const
+{
+    if (!IsOpen() || m_scalarSize != sizeof(T))
+        return false;
+
+    out.resize(m_count);
+    if (m_count == 0)
+        return true;
+
+    const bool swap = !IsNative();
+    if (m_layout == GePointLayout::kAos)
+    {
+        if (swap)
+            SwapWords<T>(Lane<T>(0), out.data(), 3 * m_count);
+        else
+            std::memcpy(static_cast<void*>(out.data()), Lane<T>(0), m_count * sizeof(GeVector3<T>));
+        return true;
+    }
+
+    const T* lanes[3] = {Lane<T>(0), Lane<T>(1), Lane<T>(2)};
+    GeParallelFor(0, m_count, kChunkSize, [&](GeSize begin, GeSize end) {
+        for (GeSize i = begin; i < end; ++i)
+            out[i] = GeVector3<T>(lanes[0][i], lanes[1][i], lanes[2][i]);
+    });
+    if (swap)
+        SwapWords<T>(out.data(), out.data(), 3 * m_count);
+    return true;
+}
+
+bool GePointFile::View(GeVector3ArrayCView<GeReal32>& out) const
+{
+    return ViewLanes(out);
+}
+
+bool GePointFile::View(GeVector3ArrayCView<GeReal64>& out) const
+{
+    return ViewLanes(out);
+}
+
+bool GePointFile::View(GeSpan<const GeVector3<GeReal32>>& out) const
+{
+    return ViewPoints(out);
+}
+
+bool GePointFile::View(GeSpan<const GeVector3<GeReal64>>& out) const
+{
+    return ViewPoints(out);
+}
+
+bool GePointFile::Read(GeVector3Array<GeReal32>& out) const
+{
+    return ReadLanes(out);
+}
+
+bool GePointFile::Read(GeVector3Array<GeReal64>& out) const
+{
+    return ReadLanes(out);
+}
+
+bool GePointFile::Read(std::vector<GeVector3<GeReal32>>& out) const
+{
+    return ReadPoints(out);
+}
+
+bool GePointFile::Read(std::vector<GeVector3<GeReal64>>& out) const
+{
+    return ReadPoints(out);
+}
@@ -0,0 +1,163 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_POINTFILEFORMAT_H
+#define GEOMUTILS_IMPL_POINTFILEFORMAT_H
+
+// Header encoding and byte-order helpers of the point-file format (see
+// gepointfile.h), shared by the mapped reader and the streaming reader.
+
+#include "gepointfile.h"
+#include "geparallel.h"
+#include "impl/gekernels.h"
+
+#include <cstring>
+
+namespace ge
+{
+namespace details
+{
+namespace pointfile
+{
+    const char kMagic[8] = {'G', 'E', 'P', 'O', 'I', 'N', 'T', 'S'};
+    const GeUint32 kByteOrderMark = 0x01020304u;
+    const GeUint16 kVersion = 1;
+    const GeSize kHeaderSize = 64;
+    const GeSize kAlignment = GE_SIMD_ALIGNMENT;
+
+    // Words per parallel byte-swap task
+    const GeSize kSwapGrain = 3 << 16;
+
+    static_assert(kHeaderSize % kAlignment == 0, "payload must start aligned");
+
+    inline GeSize RoundUp(GeSize n, GeSize alignment)
+    {
+        return (n + alignment - 1) / alignment * alignment;
+    }
+
+    inline GeByteOrder OtherByteOrder(GeByteOrder order)
+    {
+        return order == GeByteOrder::kLittle ? GeByteOrder::kBig : GeByteOrder::kLittle;
+    }
+
+    // Reverses n words of sizeof(T) bytes; in and out may be the same buffer
+    template <typename T>
+    void SwapWords(const void* in, void* out, GeSize n)
+    {
+        const auto& kernels = dispatch::ActiveKernelTable().byteSwap;
+        const auto swap = sizeof(T) == 8 ? kernels.swap64 : kernels.swap32;
+        GeParallelFor(0, n, kSwapGrain, [&](GeSize begin, GeSize end) {
+            swap(static_cast<const GeByte*>(in) + begin * sizeof(T), static_cast<GeByte*>(out) + begin * sizeof(T), end - begin);
+        });
+    }
+
+    template <typename U>
+    void Put(GeByte* p, U value, bool swap)
+    {
+        if (swap)
+            value = GeByteSwap(value);
+        std::memcpy(p, &value, sizeof(U));
+    }
+
+    template <typename U>
+    U Get(const GeByte* p, bool swap)
+    {
+        U value;
+        std::memcpy(&value, p, sizeof(U));
+        return swap ? GeByteSwap(value) : value;
+    }
+
+    struct Header
+    {
+        GeUint16 version = kVersion;
+        GePointLayout layout = GePointLayout::kAos;
+        GeByteOrder order = GeByteOrder::kLittle;
+        GeUint8 scalarSize = 0;
+        GeUint64 count = 0;
+        GeUint64 payloadOffset = kHeaderSize;
+        GeUint64 laneStride = 0;
+
+        GeSize LaneBytes() const { return static_cast<GeSize>(count) * scalarSize; }
+    };
+
+    inline void EncodeHeader(const Header& header, GeByte* p)
+    {
+        const bool swap = header.order != GeNativeByteOrder();
+        std::memset(p, 0, kHeaderSize);
+        std::memcpy(p, kMagic, sizeof(kMagic));
+        Put<GeUint32>(p + 8, kByteOrderMark, swap);
+        Put<GeUint16>(p + 12, header.version, swap);
+        p[14] = static_cast<GeByte>(header.layout);
+        p[15] = header.scalarSize;
+        Put<GeUint64>(p + 16, header.count, swap);
+        Put<GeUint64>(p + 24, header.payloadOffset, swap);
+        Put<GeUint64>(p + 32, header.laneStride, swap);
+    }
+
+    //--------------------------------------------------------------------------
+    // Decodes and validates kHeaderSize bytes against the file size. Every
+    // size check is written so that it cannot overflow.
+    inline bool DecodeHeader(const GeByte* p, GeUint64 fileSize, Header& header)
+    {
+        if (fileSize < kHeaderSize || std::memcmp(p, kMagic, sizeof(kMagic)) != 0)
+            return false;
+
+        const GeUint32 mark = Get<GeUint32>(p + 8, false);
+        if (mark != kByteOrderMark && mark != GeByteSwap(kByteOrderMark))
+            return false;
+
+        const bool swap = mark != kByteOrderMark;
+        header.order = swap ? OtherByteOrder(GeNativeByteOrder()) : GeNativeByteOrder();
+        header.version = Get<GeUint16>(p + 12, swap);
+        header.scalarSize = p[15];
+        header.count = Get<GeUint64>(p + 16, swap);
+        header.payloadOffset = Get<GeUint64>(p + 24, swap);
+        header.laneStride = Get<GeUint64>(p + 32, swap);
+        if (header.version != kVersion || p[14] > static_cast<GeByte>(GePointLayout::kSoa) ||
+            (header.scalarSize != 4 && header.scalarSize != 8))
+            return false;
+        header.layout = static_cast<GePointLayout>(p[14]);
+
+        if (header.payloadOffset < kHeaderSize || header.payloadOffset % kAlignment != 0 || header.payloadOffset > fileSize)
+            return false;
+
+        const GeUint64 available = fileSize - header.payloadOffset;
+        if (header.count > available / (3 * header.scalarSize))
+            return false;
+
+        if (header.layout == GePointLayout::kAos)
+        {
+            header.laneStride = 0;
+            return true;
+        }
+
+        const GeUint64 laneBytes = header.count * header.scalarSize;
+        return header.laneStride >= laneBytes && header.laneStride % kAlignment == 0 &&
+               header.laneStride <= available && 2 * header.laneStride <= available - laneBytes;
+    }
+
+} // end of pointfile
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_POINTFILEFORMAT_H
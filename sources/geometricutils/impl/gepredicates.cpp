@@ -0,0 +1,560 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gepredicates.h"
+#include "gestats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    //--------------------------------------------------------------------------
+    // Error bounds of the double evaluation (Shewchuk's A bounds), in units
+    // of the permanent: the determinant with every term made non-negative.
+
+    const double kEpsilon = 0x1p-53;
+    const double kOrient2dBound = (3.0 + 16.0 * kEpsilon) * kEpsilon;
+    const double kOrient3dBound = (7.0 + 56.0 * kEpsilon) * kEpsilon;
+    const double kInCircleBound = (10.0 + 96.0 * kEpsilon) * kEpsilon;
+    const double kInSphereBound = (16.0 + 224.0 * kEpsilon) * kEpsilon;
+
+    GeInt32 Sign(double x)
+    {
+        return (x > 0.0) - (x < 0.0);
+    }
+
+    //--------------------------------------------------------------------------
+    // Error-free transformations. Each returns the rounded result and stores
+    // the exact rounding error in err.
+
+    double FastTwoSum(double a, double b, double& err)
+    {
+        // requires |a| >= |b|
+        const double x = a + b;
+        err = b - (x - a);
+        return x;
+    }
+
+    double TwoSum(double a, double b, double& err)
+    {
+        const double x = a + b;
+        const double bVirtual = x - a;
+        const double aVirtual = x - bVirtual;
+        err = (a - aVirtual) + (b - bVirtual);
+        return x;
+    }
+
+    double TwoDiff(double a, double b, double& err)
+    {
+        const double x = a - b;
+        const double bVirtual = a - x;
+        const double aVirtual = x + bVirtual;
+        err = (a - aVirtual) + (bVirtual - b);
+        return x;
+    }
+
+    double TwoProduct(double a, double b, double& err)
+    {
+        const double x = a * b;
+#if defined(GE_HAS_FMA) || defined(FP_FAST_FMA)
+        // Dekker's splitting breaks when the compiler contracts it into
+        // fused operations, and the fused product is exact anyway
+        err = std::fma(a, b, -x);
+#else
+        const double kSplitter = 134217729.0;     // 2^27 + 1
+        const double aBig = kSplitter * a;
+        const double aHi = aBig - (aBig - a);
+        const double aLo = a - aHi;
+        const double bBig = kSplitter * b;
+        const double bHi = bBig - (bBig - b);
+        const double bLo = b - bHi;
+        err = aLo * bLo - (((x - aHi * bHi) - aLo * bHi) - aHi * bLo);
+#endif
+        return x;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Bump allocator for the terms of the expansions of one exact
+        evaluation. Blocks are kept between evaluations, so after warming up
+        the exact path does not touch the heap.
+    */
+    class TermArena
+    {
+    public:
+        // Room for n terms, valid until the next Reserve()
+        double* Reserve(GeSize n)
+        {
+            while (m_block < m_blocks.size() && m_used + n > m_blocks[m_block].size())
+            {
+                ++m_block;
+                m_used = 0;
+            }
+            if (m_block == m_blocks.size())
+                m_blocks.emplace_back(std::max(n, kBlockSize));
+            return m_blocks[m_block].data() + m_used;
+        }
+
+        // Keeps the first n terms of the last reservation
+        void Commit(GeSize n)
+        {
+            m_used += n;
+        }
+
+        void Reset()
+        {
+            m_block = 0;
+            m_used = 0;
+        }
+
+    private:
+        static constexpr GeSize kBlockSize = 1 << 14;
+
+        std::vector<std::vector<double>> m_blocks;
+        GeSize m_block = 0;
+        GeSize m_used = 0;
+    };
+
+    thread_local TermArena s_arena;
+
+    //--------------------------------------------------------------------------
+    /**
+        Exact sum of non-overlapping doubles in increasing magnitude, zero
+        components removed (a zero value keeps a single 0). The sign of the
+        value is the sign of the largest component. Terms live in s_arena.
+    */
+    class Expansion
+    {
+    public:
+        // exact a - b
+        static Expansion Difference(double a, double b)
+        {
+            Builder result(2);
+            double err;
+            const double x = TwoDiff(a, b, err);
+            result.Push(err);
+            result.Push(x);
+            return result.Finish();
+        }
+
+        GeInt32 Sign() const { return ::Sign(m_pTerms[m_size - 1]); }
+
+        Expansion operator-() const
+        {
+            Builder result(m_size);
+            for (GeSize i = 0; i < m_size; ++i)
+                result.Push(-m_pTerms[i]);
+            return result.Finish();
+        }
+
+        // Shewchuk's FAST-EXPANSION-SUM with zero elimination
+        friend Expansion operator+(const Expansion& e, const Expansion& f)
+        {
+            const double* et = e.m_pTerms;
+            const double* ft = f.m_pTerms;
+            Builder result(e.m_size + f.m_size);
+
+            GeSize ei = 0;
+            GeSize fi = 0;
+            auto takeE = [&]() { return fi == f.m_size || (ei < e.m_size && (ft[fi] > et[ei]) == (ft[fi] > -et[ei])); };
+
+            double q = takeE() ? et[ei++] : ft[fi++];
+            double err;
+            if (ei < e.m_size && fi < f.m_size)
+            {
+                q = takeE() ? FastTwoSum(et[ei++], q, err) : FastTwoSum(ft[fi++], q, err);
+                result.Push(err);
+            }
+            while (ei < e.m_size || fi < f.m_size)
+            {
+                q = takeE() ? TwoSum(q, et[ei++], err) : TwoSum(q, ft[fi++], err);
+                result.Push(err);
+            }
+            result.Push(q);
+            return result.Finish();
+        }
+
+        friend Expansion operator-(const Expansion& e, const Expansion& f)
+        {
+            return e + (-f);
+        }
+
+        // Shewchuk's SCALE-EXPANSION with zero elimination
+        friend Expansion operator*(const Expansion& e, double b)
+        {
+            const double* et = e.m_pTerms;
+            Builder result(2 * e.m_size);
+
+            double err;
+            double q = TwoProduct(et[0], b, err);
+            result.Push(err);
+            for (GeSize i = 1; i < e.m_size; ++i)
+            {
+                double productErr;
+                const double product = TwoProduct(et[i], b, productErr);
+                const double sum = TwoSum(q, productErr, err);
+                result.Push(err);
+                q = FastTwoSum(product, sum, err);
+                result.Push(err);
+            }
+            result.Push(q);
+            return result.Finish();
+        }
+
+        friend Expansion operator*(const Expansion& e, const Expansion& f)
+        {
+            Expansion result = e * f.m_pTerms[0];
+            for (GeSize i = 1; i < f.m_size; ++i)
+                result = result + e * f.m_pTerms[i];
+            return result;
+        }
+
+    private:
+        // Collects the non-zero terms of a result of at most capacity terms
+        class Builder
+        {
+        public:
+            explicit Builder(GeSize capacity)
+                : m_pTerms(s_arena.Reserve(capacity))
+                {}
+
+            void Push(double term)
+            {
+                if (term != 0.0)
+                    m_pTerms[m_size++] = term;
+            }
+
+            Expansion Finish()
+            {
+                if (m_size == 0)
+                    m_pTerms[m_size++] = 0.0;
+                s_arena.Commit(m_size);
+                return Expansion(m_pTerms, m_size);
+            }
+
+        private:
+            double* m_pTerms;
+            GeSize m_size = 0;
+        };
+
+        Expansion(const double* pTerms, GeSize size)
+            : m_pTerms(pTerms)
+            , m_size(size)
+            {}
+
+        const double* m_pTerms;
+        GeSize m_size;
+    };
+
+    //--------------------------------------------------------------------------
+    // Exact determinants, from exact coordinate differences
+
+    using Vector3 = GeVector3<double>;
+
+    GeInt32 Orient2dExact(const Vector3& a, const Vector3& b, const Vector3& c)
+    {
+        const Expansion acx = Expansion::Difference(a.x, c.x);
+        const Expansion acy = Expansion::Difference(a.y, c.y);
+        const Expansion bcx = Expansion::Difference(b.x, c.x);
+        const Expansion bcy = Expansion::Difference(b.y, c.y);
+        return (acx * bcy - acy * bcx).Sign();
+    }
+
+    GeInt32 Orient3dExact(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+    {
+        const Expansion adx = Expansion::Difference(a.x, d.x);
+        const Expansion ady = Expansion::Difference(a.y, d.y);
+        const Expansion adz = Expansion::Difference(a.z, d.z);
+        const Expansion bdx = Expansion::Difference(b.x, d.x);
+        const Expansion bdy = Expansion::Difference(b.y, d.y);
+        const Expansion bdz = Expansion::Difference(b.z, d.z);
+        const Expansion cdx = Expansion::Difference(c.x, d.x);
+        const Expansion cdy = Expansion::Difference(c.y, d.y);
+        const Expansion cdz = Expansion::Difference(c.z, d.z);
+        return (adz * (bdx * cdy - cdx * bdy) +
+                bdz * (cdx * ady - adx * cdy) +
+                cdz * (adx * bdy - bdx * ady)).Sign();
+    }
+
+    GeInt32 InCircleExact(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+    {
+        const Expansion adx = Expansion::Difference(a.x, d.x);
+        const Expansion ady = Expansion::Difference(a.y, d.y);
+        const Expansion bdx = Expansion::Difference(b.x, d.x);
+        const Expansion bdy = Expansion::Difference(b.y, d.y);
+        const Expansion cdx = Expansion::Difference(c.x, d.x);
+        const Expansion cdy = Expansion::Difference(c.y, d.y);
+        const Expansion aLift = adx * adx + ady * ady;
+        const Expansion bLift = bdx * bdx + bdy * bdy;
+        const Expansion cLift = cdx * cdx + cdy * cdy;
+        return (aLift * (bdx * cdy - cdx * bdy) +
+                bLift * (cdx * ady - adx * cdy) +
+                cLift * (adx * bdy - bdx * ady)).Sign();
+    }
+
+    GeInt32 InSphereExact(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d, const Vector3& e)
+    {
+        const Expansion aex = Expansion::Difference(a.x, e.x);
+        const Expansion aey = Expansion::Difference(a.y, e.y);
+        const Expansion aez = Expansion::Difference(a.z, e.z);
+        const Expansion bex = Expansion::Difference(b.x, e.x);
+        const Expansion bey = Expansion::Difference(b.y, e.y);
+        const Expansion bez = Expansion::Difference(b.z, e.z);
+        const Expansion cex = Expansion::Difference(c.x, e.x);
+        const Expansion cey = Expansion::Difference(c.y, e.y);
+        const Expansion cez = Expansion::Difference(c.z, e.z);
+        const Expansion dex = Expansion::Difference(d.x, e.x);
+        const Expansion dey = Expansion::Difference(d.y, e.y);
+        const Expansion dez = Expansion::Difference(d.z, e.z);
+
+        const Expansion ab = aex * bey - bex * aey;
+        const Expansion bc = bex * cey - cex * bey;
+        const Expansion cd = cex * dey - dex * cey;
+        const Expansion da = dex * aey - aex * dey;
+        const Expansion ac = aex * cey - cex * aey;
+        const Expansion bd = bex * dey - dex * bey;
+
+        const Expansion abc = aez * bc - bez * ac + cez * ab;
+        const Expansion bcd = bez * cd - cez * bd + dez * bc;
+        const Expansion cda = cez * da + dez * ac + aez * cd;
+        const Expansion dab = dez * ab + aez * bd + bez * da;
+
+        const Expansion aLift = aex * aex + aey * aey + aez * aez;
+        const Expansion bLift = bex * bex + bey * bey + bez * bez;
+        const Expansion cLift = cex * cex + cey * cey + cez * cez;
+        const Expansion dLift = dex * dex + dey * dey + dez * dez;
+        return ((dLift * abc - cLift * dab) + (bLift * cda - aLift * bcd)).Sign();
+    }
+
+    //--------------------------------------------------------------------------
+    // Filtered predicates
+
+    GeInt32 Orient2d(const Vector3& a, const Vector3& b, const Vector3& c)
+    {
+        GE_STATS_ADD(GeStatCounter::kOrient2d, 1);
+
+        const double left = (a.x - c.x) * (b.y - c.y);
+        const double right = (a.y - c.y) * (b.x - c.x);
+        const double det = left - right;
+
+        // when the two products differ in sign the difference cannot cancel
+        double permanent;
+        if (left > 0.0)
+        {
+            if (right <= 0.0)
+                return Sign(det);
+            permanent = left + right;
+        }
+        else if (left < 0.0)
+        {
+            if (right >= 0.0)
+                return Sign(det);
+            permanent = -left - right;
+        }
+        else
+        {
+            return Sign(det);
+        }
+
+        if (std::fabs(det) >= kOrient2dBound * permanent)
+            return Sign(det);
+
+        GE_STATS_ADD(GeStatCounter::kOrient2dExact, 1);
+        s_arena.Reset();
+        return Orient2dExact(a, b, c);
+    }
+
+    GeInt32 Orient3d(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+    {
+        GE_STATS_ADD(GeStatCounter::kOrient3d, 1);
+
+        const double adx = a.x - d.x, ady = a.y - d.y, adz = a.z - d.z;
+        const double bdx = b.x - d.x, bdy = b.y - d.y, bdz = b.z - d.z;
+        const double cdx = c.x - d.x, cdy = c.y - d.y, cdz = c.z - d.z;
+
+        const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+        const double cdxady = cdx * ady, adxcdy = adx * cdy;
+        const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+        const double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+        const double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz) +
+                                 (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz) +
+                                 (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+        const double bound = kOrient3dBound * permanent;
+        if (det > bound || -det > bound)
+            return Sign(det);
+
+        GE_STATS_ADD(GeStatCounter::kOrient3dExact, 1);
+        s_arena.Reset();
+        return Orient3dExact(a, b, c, d);
+    }
+
+    GeInt32 InCircle(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+    {
+        GE_STATS_ADD(GeStatCounter::kInCircle, 1);
+
+        const double adx = a.x - d.x, ady = a.y - d.y;
+        const double bdx = b.x - d.x, bdy = b.y - d.y;
+        const double cdx = c.x - d.x, cdy = c.y - d.y;
+
+        const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+        const double cdxady = cdx * ady, adxcdy = adx * cdy;
+        const double adxbdy = adx * bdy, bdxady = bdx * ady;
+        const double aLift = adx * adx + ady * ady;
+        const double bLift = bdx * bdx + bdy * bdy;
+        const double cLift = cdx * cdx + cdy * cdy;
+
+        const double det = aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady);
+        const double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * aLift +
+                                 (std::fabs(cdxady) + std::fabs(adxcdy)) * bLift +
+                                 (std::fabs(adxbdy) + std::fabs(bdxady)) * cLift;
+        const double bound = kInCircleBound * permanent;
+        if (det > bound || -det > bound)
+            return Sign(det);
+
+        GE_STATS_ADD(GeStatCounter::kInCircleExact, 1);
+        s_arena.Reset();
+        return InCircleExact(a, b, c, d);
+    }
+
+    GeInt32 InSphere(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d, const Vector3& e)
+    {
+        GE_STATS_ADD(GeStatCounter::kInSphere, 1);
+
+        const double aex = a.x - e.x, aey = a.y - e.y, aez = a.z - e.z;
+        const double bex = b.x - e.x, bey = b.y - e.y, bez = b.z - e.z;
+        const double cex = c.x - e.x, cey = c.y - e.y, cez = c.z - e.z;
+        const double dex = d.x - e.x, dey = d.y - e.y, dez = d.z - e.z;
+
+        const double aexbey = aex * bey, bexaey = bex * aey;
+        const double bexcey = bex * cey, cexbey = cex * bey;
+        const double cexdey = cex * dey, dexcey = dex * cey;
+        const double dexaey = dex * aey, aexdey = aex * dey;
+        const double aexcey = aex * cey, cexaey = cex * aey;
+        const double bexdey = bex * dey, dexbey = dex * bey;
+
+        const double ab = aexbey - bexaey;
+        const double bc = bexcey - cexbey;
+        const double cd = cexdey - dexcey;
+        const double da = dexaey - aexdey;
+        const double ac = aexcey - cexaey;
+        const double bd = bexdey - dexbey;
+
+        const double abc = aez * bc - bez * ac + cez * ab;
+        const double bcd = bez * cd - cez * bd + dez * bc;
+        const double cda = cez * da + dez * ac + aez * cd;
+        const double dab = dez * ab + aez * bd + bez * da;
+
+        const double aLift = aex * aex + aey * aey + aez * aez;
+        const double bLift = bex * bex + bey * bey + bez * bez;
+        const double cLift = cex * cex + cey * cey + cez * cez;
+        const double dLift = dex * dex + dey * dey + dez * dez;
+
+        const double det = (dLift * abc - cLift * dab) + (bLift * cda - aLift * bcd);
+
+        const double aezPlus = std::fabs(aez), bezPlus = std::fabs(bez);
+        const double cezPlus = std::fabs(cez), dezPlus = std::fabs(dez);
+        const double abPlus = std::fabs(aexbey) + std::fabs(bexaey);
+        const double bcPlus = std::fabs(bexcey) + std::fabs(cexbey);
+        const double cdPlus = std::fabs(cexdey) + std::fabs(dexcey);
+        const double daPlus = std::fabs(dexaey) + std::fabs(aexdey);
+        const double acPlus = std::fabs(aexcey) + std::fabs(cexaey);
+        const double bdPlus = std::fabs(bexdey) + std::fabs(dexbey);
+        const double permanent = (cdPlus * bezPlus + bdPlus * cezPlus + bcPlus * dezPlus) * aLift +
+                                 (daPlus * cezPlus + acPlus * dezPlus + cdPlus * aezPlus) * bLift +
+                                 (abPlus * dezPlus + bdPlus * aezPlus + daPlus * bezPlus) * cLift +
+                                 (bcPlus * aezPlus + acPlus * bezPlus + abPlus * cezPlus) * dLift;
+        const double bound = kInSphereBound * permanent;
+        if (det > bound || -det > bound)
+            return Sign(det);
+
+        GE_STATS_ADD(GeStatCounter::kInSphereExact, 1);
+        s_arena.Reset();
+        return InSphereExact(a, b, c, d, e);
+    }
+
+    Vector3 Widen(const GeVector3<GeReal32>& v)
+    {
+        return Vector3(v.x, v.y, v.z);
+    }
+} // end of anonymous
+
+//==============================================================================
+// Predicates
+
+template <>
+GeInt32 GeOrient2d<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b, const GeVector3<GeReal32>& c)
+{
+    return Orient2d(Widen(a), Widen(b), Widen(c));
+}
+
+template <>
+GeInt32 GeOrient2d<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b, const GeVector3<GeReal64>& c)
+{
+    return Orient2d(a, b, c);
+}
+
+template <>
+GeInt32 GeOrient3d<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b,
+                             const GeVector3<GeReal32>& c, const GeVector3<GeReal32>& d)
+{
+    return Orient3d(Widen(a), Widen(b), Widen(c), Widen(d));
+}
+
+template <>
+GeInt32 GeOrient3d<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b,
+                             const GeVector3<GeReal64>& c, const GeVector3<GeReal64>& d)
+{
+    return Orient3d(a, b, c, d);
+}
+
+template <>
+GeInt32 GeInCircle<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b,
+                             const GeVector3<GeReal32>& c, const GeVector3<GeReal32>& d)
+{
+    return InCircle(Widen(a), Widen(b), Widen(c), Widen(d));
+}
+
+template <>
+GeInt32 GeInCircle<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b,
+                             const GeVector3<GeReal64>& c, const GeVector3<GeReal64>& d)
+{
+    return InCircle(a, b, c, d);
+}
+
+template <>
+GeInt32 GeInSphere<GeReal32>(const GeVector3<GeReal32>& a, const GeVector3<GeReal32>& b, const GeVector3<GeReal32>& c,
+                             const GeVector3<GeReal32>& d, const GeVector3<GeReal32>& e)
+{
+    return InSphere(Widen(a), Widen(b), Widen(c), Widen(d), Widen(e));
+}
+
+template <>
+GeInt32 GeInSphere<GeReal64>(const GeVector3<GeReal64>& a, const GeVector3<GeReal64>& b, const GeVector3<GeReal64>& c,
+                             const GeVector3<GeReal64>& d, const GeVector3<GeReal64>& e)
+{
+    return InSphere(a, b, c, d, e);
+}
@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gequantize.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+
+namespace
+{
+    template <typename T>
+    const ge::details::dispatch::QuantizeKernelTable<T>& Kernels();
+
+    template <>
+    const ge::details::dispatch::QuantizeKernelTable<GeReal32>& Kernels<GeReal32>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().quantizef;
+    }
+
+    template <>
+    const ge::details::dispatch::QuantizeKernelTable<GeReal64>& Kernels<GeReal64>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().quantized;
+    }
+
+    template <typename T>
+    void Quantize(GeVector3ArrayCView<T> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<GeInt32> out)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchQuantize, in.size);
+        assert(in.size == out.size);
+        const auto& k = Kernels<T>();
+        const GeVector3<T> scale = grid.Scale();
+        k.quantize32(in.x, in.size, grid.origin.x, scale.x, out.x);
+        k.quantize32(in.y, in.size, grid.origin.y, scale.y, out.y);
+        k.quantize32(in.z, in.size, grid.origin.z, scale.z, out.z);
+    }
+
+    template <typename T>
+    void Quantize(GeVector3ArrayCView<T> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<GeInt16> out)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchQuantize, in.size);
+        assert(in.size == out.size);
+        const auto& k = Kernels<T>();
+        const GeVector3<T> scale = grid.Scale();
+        k.quantize16(in.x, in.size, grid.origin.x, scale.x, out.x);
+        k.quantize16(in.y, in.size, grid.origin.y, scale.y, out.y);
+        k.quantize16(in.z, in.size, grid.origin.z, scale.z, out.z);
+    }
+
+    template <typename T>
+    void Dequantize(GeVector3ArrayCView<GeInt32> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<T> out)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchDequantize, in.size);
+        assert(in.size == out.size);
+        const auto& k = Kernels<T>();
+        k.dequantize32(in.x, in.size, grid.origin.x, grid.step.x, out.x);
+        k.dequantize32(in.y, in.size, grid.origin.y, grid.step.y, out.y);
+        k.dequantize32(in.z, in.size, grid.origin.z, grid.step.z, out.z);
+    }
+
+    template <typename T>
+    void Dequantize(GeVector3ArrayCView<GeInt16> in, const GeQuantizeGrid<T>& grid, GeVector3ArrayView<T> out)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchDequantize, in.size);
+        assert(in.size == out.size);
+        const auto& k = Kernels<T>();
+        k.dequantize16(in.x, in.size, grid.origin.x, grid.step.x, out.x);
+        k.dequantize16(in.y, in.size, grid.origin.y, grid.step.y, out.y);
+        k.dequantize16(in.z, in.size, grid.origin.z, grid.step.z, out.z);
+    }
+} // end of anonymous
+
+//==============================================================================
+// Quantize
+
+template <>
+void GeVector3BatchQuantize<GeReal32, GeInt32>(GeVector3ArrayCView<GeReal32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeInt32> out)
+{
+    Quantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchQuantize<GeReal32, GeInt16>(GeVector3ArrayCView<GeReal32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeInt16> out)
+{
+    Quantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchQuantize<GeReal64, GeInt32>(GeVector3ArrayCView<GeReal64> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeInt32> out)
+{
+    Quantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchQuantize<GeReal64, GeInt16>(GeVector3ArrayCView<GeReal64> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeInt16> out)
+{
+    Quantize(in, grid, out);
+}
+
+//==============================================================================
+// Dequantize
+
+template <>
+void GeVector3BatchDequantize<GeReal32, GeInt32>(GeVector3ArrayCView<GeInt32> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeReal32> out)
+{
+    Dequantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchDequantize<GeReal32, GeInt16>(GeVector3ArrayCView<GeInt16> in, const GeQuantizeGrid<GeReal32>& grid, GeVector3ArrayView<GeReal32> out)
+{
+    Dequantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchDequantize<GeReal64, GeInt32>(GeVector3ArrayCView<GeInt32> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeReal64> out)
+{
+    Dequantize(in, grid, out);
+}
+
+template <>
+void GeVector3BatchDequantize<GeReal64, GeInt16>(GeVector3ArrayCView<GeInt16> in, const GeQuantizeGrid<GeReal64>& grid, GeVector3ArrayView<GeReal64> out)
+{
+    Dequantize(in, grid, out);
+}
@@ -0,0 +1,309 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_QUANTIZEKERNELS_H
+#define GEOMUTILS_IMPL_QUANTIZEKERNELS_H
+
+// Conversions between real lanes and integer grid coordinates (see
+// gequantize.h). Quantizing computes r = (x - origin) * scale, rounds it to
+// nearest even and saturates it to the integer range, NaN giving 0;
+// dequantizing computes origin + q * step. Every tier produces the same
+// bits as the scalar code.
+
+#include "gebaseutl.h"
+#include "impl/gesimd.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace quantizekernels
+{
+    //--------------------------------------------------------------------------
+    template <typename T>
+    struct QuantScalar
+    {
+        using value_type = T;
+        static constexpr size_t kLanes = 1;
+
+        static int32_t ToInt32(T r)
+        {
+            if (!(r == r))
+                return 0;
+            const T rounded = std::nearbyint(r);
+            if (rounded >= T(2147483648.0))
+                return std::numeric_limits<int32_t>::max();
+            if (rounded <= T(-2147483648.0))
+                return std::numeric_limits<int32_t>::min();
+            return static_cast<int32_t>(rounded);
+        }
+
+        static int16_t ToInt16(T r)
+        {
+            if (!(r == r))
+                return 0;
+            r = r < T(-32768) ? T(-32768) : (r > T(32767) ? T(32767) : r);
+            return static_cast<int16_t>(std::nearbyint(r));
+        }
+
+        static void Quantize(const T* in, T origin, T scale, int32_t* out)
+        {
+            *out = ToInt32((*in - origin) * scale);
+        }
+
+        static void Quantize(const T* in, T origin, T scale, int16_t* out)
+        {
+            *out = ToInt16((*in - origin) * scale);
+        }
+
+        template <typename I>
+        static void Dequantize(const I* in, T origin, T step, T* out)
+        {
+            *out = origin + static_cast<T>(*in) * step;
+        }
+    };
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    // cvtps2dq/cvtpd2dq round to nearest even and return 0x80000000 for
+    // anything out of range, which is already the saturated value at the
+    // bottom; the top is fixed up separately
+    struct QuantF32Sse2
+    {
+        using value_type = real32_t;
+        static constexpr size_t kLanes = 4;
+
+        static __m128 Scaled(const real32_t* in, real32_t origin, real32_t scale)
+        {
+            const __m128 r = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(in), _mm_set1_ps(origin)), _mm_set1_ps(scale));
+            return _mm_and_ps(r, _mm_cmpord_ps(r, r));
+        }
+
+        static __m128i Clamp16(__m128 r)
+        {
+            return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(r, _mm_set1_ps(-32768.0f)), _mm_set1_ps(32767.0f)));
+        }
+
+        static void Quantize(const real32_t* in, real32_t origin, real32_t scale, int32_t* out)
+        {
+            const __m128 r = Scaled(in, origin, scale);
+            // floats below 2^31 are at most 2^31 - 128, so rounding cannot reach it
+            const __m128 high = _mm_cmpge_ps(r, _mm_set1_ps(2147483648.0f));
+            const __m128i q = _mm_xor_si128(_mm_cvtps_epi32(r), _mm_castps_si128(high));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), q);
+        }
+
+        static void Quantize(const real32_t* in, real32_t origin, real32_t scale, int16_t* out)
+        {
+            const __m128i q = Clamp16(Scaled(in, origin, scale));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(q, q));
+        }
+
+        static void Dequantize(const int32_t* in, real32_t origin, real32_t step, real32_t* out)
+        {
+            const __m128 q = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            _mm_storeu_ps(out, _mm_add_ps(_mm_set1_ps(origin), _mm_mul_ps(q, _mm_set1_ps(step))));
+        }
+
+        static void Dequantize(const int16_t* in, real32_t origin, real32_t step, real32_t* out)
+        {
+            const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+            const __m128 q = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16));
+            _mm_storeu_ps(out, _mm_add_ps(_mm_set1_ps(origin), _mm_mul_ps(q, _mm_set1_ps(step))));
+        }
+    };
+
+    struct QuantF64Sse2
+    {
+        using value_type = real64_t;
+        static constexpr size_t kLanes = 2;
+
+        static __m128d Scaled(const real64_t* in, real64_t origin, real64_t scale)
+        {
+            const __m128d r = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(in), _mm_set1_pd(origin)), _mm_set1_pd(scale));
+            return _mm_and_pd(r, _mm_cmpord_pd(r, r));
+        }
+
+        static __m128i Clamp(__m128d r, real64_t lo, real64_t hi)
+        {
+            return _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(r, _mm_set1_pd(lo)), _mm_set1_pd(hi)));
+        }
+
+        static void Quantize(const real64_t* in, real64_t origin, real64_t scale, int32_t* out)
+        {
+            const __m128i q = Clamp(Scaled(in, origin, scale), -2147483648.0, 2147483647.0);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), q);
+        }
+
+        static void Quantize(const real64_t* in, real64_t origin, real64_t scale, int16_t* out)
+        {
+            const __m128i q = Clamp(Scaled(in, origin, scale), -32768.0, 32767.0);
+            const int32_t packed = _mm_cvtsi128_si32(_mm_packs_epi32(q, q));
+            std::memcpy(out, &packed, sizeof(packed));
+        }
+
+        static void Dequantize(const int32_t* in, real64_t origin, real64_t step, real64_t* out)
+        {
+            const __m128d q = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in)));
+            _mm_storeu_pd(out, _mm_add_pd(_mm_set1_pd(origin), _mm_mul_pd(q, _mm_set1_pd(step))));
+        }
+
+        static void Dequantize(const int16_t* in, real64_t origin, real64_t step, real64_t* out)
+        {
+            int32_t packed;
+            std::memcpy(&packed, in, sizeof(packed));
+            const __m128i words = _mm_cvtsi32_si128(packed);
+            const __m128d q = _mm_cvtepi32_pd(_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16));
+            _mm_storeu_pd(out, _mm_add_pd(_mm_set1_pd(origin), _mm_mul_pd(q, _mm_set1_pd(step))));
+        }
+    };
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_AVX2
+    //--------------------------------------------------------------------------
+    // Also used by the AVX-512 tier: these loops are bound by memory traffic,
+    // not by the vector width
+    struct QuantF32Avx2
+    {
+        using value_type = real32_t;
+        static constexpr size_t kLanes = 8;
+
+        static __m256 Scaled(const real32_t* in, real32_t origin, real32_t scale)
+        {
+            const __m256 r = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in), _mm256_set1_ps(origin)), _mm256_set1_ps(scale));
+            return _mm256_and_ps(r, _mm256_cmp_ps(r, r, _CMP_ORD_Q));
+        }
+
+        static void Quantize(const real32_t* in, real32_t origin, real32_t scale, int32_t* out)
+        {
+            const __m256 r = Scaled(in, origin, scale);
+            const __m256 high = _mm256_cmp_ps(r, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+            const __m256i q = _mm256_xor_si256(_mm256_cvtps_epi32(r), _mm256_castps_si256(high));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), q);
+        }
+
+        static void Quantize(const real32_t* in, real32_t origin, real32_t scale, int16_t* out)
+        {
+            const __m256 r = _mm256_min_ps(_mm256_max_ps(Scaled(in, origin, scale), _mm256_set1_ps(-32768.0f)), _mm256_set1_ps(32767.0f));
+            const __m256i q = _mm256_cvtps_epi32(r);
+            // packs works per 128-bit half; gather the two low quadwords
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(q, q), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+        }
+
+        static void Dequantize(const int32_t* in, real32_t origin, real32_t step, real32_t* out)
+        {
+            const __m256 q = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)));
+            _mm256_storeu_ps(out, _mm256_add_ps(_mm256_set1_ps(origin), _mm256_mul_ps(q, _mm256_set1_ps(step))));
+        }
+
+        static void Dequantize(const int16_t* in, real32_t origin, real32_t step, real32_t* out)
+        {
+            const __m256i words = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            const __m256 q = _mm256_cvtepi32_ps(words);
+            _mm256_storeu_ps(out, _mm256_add_ps(_mm256_set1_ps(origin), _mm256_mul_ps(q, _mm256_set1_ps(step))));
+        }
+    };
+
+    struct QuantF64Avx2
+    {
+        using value_type = real64_t;
+        static constexpr size_t kLanes = 4;
+
+        static __m256d Scaled(const real64_t* in, real64_t origin, real64_t scale)
+        {
+            const __m256d r = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(in), _mm256_set1_pd(origin)), _mm256_set1_pd(scale));
+            return _mm256_and_pd(r, _mm256_cmp_pd(r, r, _CMP_ORD_Q));
+        }
+
+        static __m128i Clamp(__m256d r, real64_t lo, real64_t hi)
+        {
+            return _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(r, _mm256_set1_pd(lo)), _mm256_set1_pd(hi)));
+        }
+
+        static void Quantize(const real64_t* in, real64_t origin, real64_t scale, int32_t* out)
+        {
+            const __m128i q = Clamp(Scaled(in, origin, scale), -2147483648.0, 2147483647.0);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), q);
+        }
+
+        static void Quantize(const real64_t* in, real64_t origin, real64_t scale, int16_t* out)
+        {
+            const __m128i q = Clamp(Scaled(in, origin, scale), -32768.0, 32767.0);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(q, q));
+        }
+
+        static void Dequantize(const int32_t* in, real64_t origin, real64_t step, real64_t* out)
+        {
+            const __m256d q = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            _mm256_storeu_pd(out, _mm256_add_pd(_mm256_set1_pd(origin), _mm256_mul_pd(q, _mm256_set1_pd(step))));
+        }
+
+        static void Dequantize(const int16_t* in, real64_t origin, real64_t step, real64_t* out)
+        {
+            const __m128i words = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in)));
+            const __m256d q = _mm256_cvtepi32_pd(words);
+            _mm256_storeu_pd(out, _mm256_add_pd(_mm256_set1_pd(origin), _mm256_mul_pd(q, _mm256_set1_pd(step))));
+        }
+    };
+#endif // GE_KERNEL_HAS_AVX2
+
+    //--------------------------------------------------------------------------
+    // Drivers over n elements: kernel blocks for the bulk, scalar for the tail
+
+    template <typename K, typename I>
+    void Quantize(const typename K::value_type* in, size_t n, typename K::value_type origin,
+                  typename K::value_type scale, I* out)
+    {
+        using T = typename K::value_type;
+        size_t i = 0;
+        for (; i + K::kLanes <= n; i += K::kLanes)
+            K::Quantize(in + i, origin, scale, out + i);
+        for (; i < n; ++i)
+            QuantScalar<T>::Quantize(in + i, origin, scale, out + i);
+    }
+
+    template <typename K, typename I>
+    void Dequantize(const I* in, size_t n, typename K::value_type origin,
+                    typename K::value_type step, typename K::value_type* out)
+    {
+        using T = typename K::value_type;
+        size_t i = 0;
+        for (; i + K::kLanes <= n; i += K::kLanes)
+            K::Dequantize(in + i, origin, step, out + i);
+        for (; i < n; ++i)
+            QuantScalar<T>::Dequantize(in + i, origin, step, out + i);
+    }
+
+} // end of quantizekernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_QUANTIZEKERNELS_H
@@ -0,0 +1,200 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_IMPL_RADIXSORT_H
+#define GEOMUTILS_IMPL_RADIXSORT_H
+
+// Stable LSD radix sort shared by gesort.h and the vertex welder.
+
+#include "gearena.h"
+#include "gebasedefs.h"
+#include "geparallel.h"
+#include "gestats.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ge
+{
+namespace details
+{
+namespace radix
+{
+    // 11-bit digits: three passes for 32-bit keys, six for 64-bit ones, and
+    // a 2048-bucket histogram still fits in L1
+    const unsigned kDigitBits = 11;
+    const GeSize kBuckets = GeSize(1) << kDigitBits;
+
+    template <typename Key>
+    constexpr unsigned DigitCount()
+    {
+        return (sizeof(Key) * 8 + kDigitBits - 1) / kDigitBits;
+    }
+
+    template <typename Key>
+    inline GeSize Digit(Key key, unsigned d)
+    {
+        return static_cast<GeSize>((key >> (d * kDigitBits)) & Key(kBuckets - 1));
+    }
+
+    // Key with the position it came from, for sorts that produce an order
+    template <typename Key>
+    struct IndexedKey
+    {
+        Key key;
+        GeUint32 index;
+    };
+
+    template <typename F>
+    void ForEachChunk(GeSize chunks, F&& f)
+    {
+        if (chunks == 1)
+        {
+            f(GeSize(0));
+            return;
+        }
+        GeParallelFor(0, chunks, 1, [&f](GeSize begin, GeSize end) {
+            for (GeSize c = begin; c < end; ++c)
+                f(c);
+        });
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        Sorts count records by the unsigned integer keyOf(record), keeping
+        records with equal keys in input order. scratch must hold count
+        records; the result ends up in data.
+
+        One counting pass histograms every digit; digits all keys share are
+        skipped. With parallel set, counting and scattering are split into
+        contiguous chunks of at least grainSize records and every chunk
+        scatters its records into its own slice of each bucket, so the
+        result does not depend on the chunking. The histograms come from
+        pArena when given.
+    */
+    template <typename Record, typename KeyOf>
+    void Sort(Record* data, Record* scratch, GeSize count, KeyOf keyOf, bool parallel, GeSize grainSize,
+              GeArena* pArena = nullptr)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kRadixSort, count);
+        using Key = std::decay_t<decltype(keyOf(*data))>;
+        static_assert(std::is_unsigned<Key>::value, "radix keys are unsigned integers");
+        constexpr unsigned kDigits = DigitCount<Key>();
+        constexpr GeSize kStride = kDigits * kBuckets;
+
+        if (count < 2)
+            return;
+
+        GeSize chunks = 1;
+        if (parallel)
+        {
+            const GeSize grain = grainSize > 0 ? grainSize : 1;
+            chunks = std::min((count + grain - 1) / grain, GeGetConcurrency());
+        }
+        auto chunkBegin = [count, chunks](GeSize c) { return count * c / chunks; };
+
+        // Per-chunk histograms of every digit; their sums do not change from
+        // pass to pass, the per-chunk ones do after the first scatter
+        const GeArenaAllocator<GeSize> allocator(pArena);
+        GeArenaVector<GeSize> counts(chunks * kStride, 0, allocator);
+        ForEachChunk(chunks, [&](GeSize c) {
+            GeSize* h = counts.data() + c * kStride;
+            for (GeSize i = chunkBegin(c), end = chunkBegin(c + 1); i < end; ++i)
+            {
+                const Key key = keyOf(data[i]);
+                for (unsigned d = 0; d < kDigits; ++d)
+                    ++h[d * kBuckets + Digit(key, d)];
+            }
+        });
+
+        GeArenaVector<GeSize> totals(counts.begin(), counts.begin() + kStride, allocator);
+        for (GeSize c = 1; c < chunks; ++c)
+        {
+            for (GeSize b = 0; b < kStride; ++b)
+                totals[b] += counts[c * kStride + b];
+        }
+
+        GeArenaVector<GeSize> offsets(chunks * kBuckets, allocator);
+        Record* src = data;
+        Record* dst = scratch;
+        bool fresh = true;
+        for (unsigned d = 0; d < kDigits; ++d)
+        {
+            const GeSize* total = totals.data() + d * kBuckets;
+            if (total[Digit(keyOf(src[0]), d)] == count)
+                continue;
+
+            if (!fresh && chunks > 1)
+            {
+                ForEachChunk(chunks, [&](GeSize c) {
+                    GeSize* h = counts.data() + c * kStride + d * kBuckets;
+                    std::fill(h, h + kBuckets, GeSize(0));
+                    for (GeSize i = chunkBegin(c), end = chunkBegin(c + 1); i < end; ++i)
+                        ++h[Digit(keyOf(src[i]), d)];
+                });
+            }
+
+            GeSize running = 0;
+            for (GeSize b = 0; b < kBuckets; ++b)
+            {
+                for (GeSize c = 0; c < chunks; ++c)
+                {
+                    offsets[c * kBuckets + b] = running;
+                    running += chunks == 1 ? total[b] : counts[c * kStride + d * kBuckets + b];
+                }
+            }
+
+            ForEachChunk(chunks, [&](GeSize c) {
+                GeSize* offset = offsets.data() + c * kBuckets;
+                for (GeSize i = chunkBegin(c), end = chunkBegin(c + 1); i < end; ++i)
+                {
+                    const Record& record = src[i];
+                    dst[offset[Digit(keyOf(record), d)]++] = record;
+                }
+            });
+
+            std::swap(src, dst);
+            fresh = false;
+        }
+
+        if (src != data)
+            std::copy(src, src + count, data);
+    }
+
+    // Sort with an internally allocated scratch buffer
+    template <typename Record, typename KeyOf>
+    void Sort(Record* data, GeSize count, KeyOf keyOf, bool parallel, GeSize grainSize, GeArena* pArena = nullptr)
+    {
+        if (count < 2)
+            return;
+        GeArenaVector<Record> scratch(count, GeArenaAllocator<Record>(pArena));
+        Sort(data, scratch.data(), count, keyOf, parallel, grainSize, pArena);
+    }
+} // end of radix
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_RADIXSORT_H
@@ -0,0 +1,359 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_REALCOMPARE_H
+#define GEOMUTILS_IMPL_REALCOMPARE_H
+
+// constexpr building blocks of the real comparisons in gerealutl.h: raw
+// IEEE-754 bit access through GeBitCast and the fused tolerant comparison.
+
+#include "gebasedefs.h"
+#include <limits>
+
+namespace ge
+{
+namespace details
+{
+    // Magnitudes below this switch the tolerant comparisons to ULP mode
+    template <typename T>
+    constexpr T RealCompareThreshold()
+    {
+        return 10 * std::numeric_limits<T>::epsilon();
+    }
+
+    // Order-preserving map of IEEE-754 bits to unsigned integers: negative
+    // values have all bits flipped, the others just the sign bit. Integer
+    // order is then -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN.
+    template <typename U>
+    constexpr U SortableBits(U bits)
+    {
+        constexpr U kSign = U(1) << (sizeof(U) * 8 - 1);
+        return (bits & kSign) ? ~bits : (bits | kSign);
+    }
+
+    template <typename U>
+    constexpr U UnsortableBits(U key)
+    {
+        constexpr U kSign = U(1) << (sizeof(U) * 8 - 1);
+        return (key & kSign) ? (key & ~kSign) : ~key;
+    }
+
+    template <typename T>
+    struct RealBits;
+
+    template <>
+    struct RealBits<real32_t>
+    {
+        using int_type = int32_t;
+        using uint_type = uint32_t;
+
+        static constexpr uint_type kSignMask = 0x80000000u;
+
+        static GE_BIT_CAST_CONSTEXPR int_type Get(real32_t x) { return GeBitCast<int_type>(x); }
+        static GE_BIT_CAST_CONSTEXPR real32_t Abs(real32_t x) { return GeBitCast<real32_t>(GeBitCast<uint_type>(x) & ~kSignMask); }
+        static GE_BIT_CAST_CONSTEXPR uint_type ToSortable(real32_t x) { return SortableBits(GeBitCast<uint_type>(x)); }
+        static GE_BIT_CAST_CONSTEXPR real32_t FromSortable(uint_type key) { return GeBitCast<real32_t>(UnsortableBits(key)); }
+    };
+
+    template <>
+    struct RealBits<real64_t>
+    {
+        using int_type = int64_t;
+        using uint_type = uint64_t;
+
+        static constexpr uint_type kSignMask = 0x8000000000000000ull;
+
+        static GE_BIT_CAST_CONSTEXPR int_type Get(real64_t x) { return GeBitCast<int_type>(x); }
+        static GE_BIT_CAST_CONSTEXPR real64_t Abs(real64_t x) { return GeBitCast<real64_t>(GeBitCast<uint_type>(x) & ~kSignMask); }
+        static GE_BIT_CAST_CONSTEXPR uint_type ToSortable(real64_t x) { return SortableBits(GeBitCast<uint_type>(x)); }
+        static GE_BIT_CAST_CONSTEXPR real64_t FromSortable(uint_type key) { return GeBitCast<real64_t>(UnsortableBits(key)); }
+    };
+
+    // Wrap-around difference of two bit patterns
+    template <typename T>
+    constexpr typename RealBits<T>::int_type RealBitsDiff(typename RealBits<T>::int_type x,
+                                                         typename RealBits<T>::int_type y)
+    {
+        using uint_type = typename RealBits<T>::uint_type;
+        using int_type = typename RealBits<T>::int_type;
+        return static_cast<int_type>(static_cast<uint_type>(x) - static_cast<uint_type>(y));
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        ULP comparisons behind GeIsRealEqualByUlps/GeIsRealLessByUlps. Values
+        of different sign are equal only when both are zero.
+    */
+    template <typename T>
+    GE_BIT_CAST_CONSTEXPR bool RealEqualByUlps(T a, T b, int32_t tolInUlps)
+    {
+        using int_type = typename RealBits<T>::int_type;
+        const int_type bitsA = RealBits<T>::Get(a);
+        const int_type bitsB = RealBits<T>::Get(b);
+
+        if ((bitsA < 0) != (bitsB < 0))
+        {
+            // +0 == -0 case
+            return a == b;
+        }
+
+        // same sign: the difference cannot overflow
+        const int_type diff = bitsA - bitsB;
+        return (diff < 0 ? -diff : diff) <= tolInUlps;
+    }
+
+    template <typename T>
+    GE_BIT_CAST_CONSTEXPR bool RealLessByUlps(T a, T b, int32_t tolInUlps)
+    {
+        if (RealEqualByUlps(a, b, tolInUlps))
+            return false;
+
+        const auto bitsA = RealBits<T>::Get(a);
+        const auto bitsB = RealBits<T>::Get(b);
+
+        if ((bitsA < 0) != (bitsB < 0))
+        {
+            // -0 & 0 are equal by ulps, so a sign mismatch decides
+            return bitsA < 0;
+        }
+
+        return bitsB - bitsA > 0;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+        State of one operand of RealCompareFused: raw bits, magnitude and
+        threshold flag. An operand compared against many others computes it
+        once (GeRealComparator).
+    */
+    template <typename T>
+    struct RealCompareOperand
+    {
+        using Bits = RealBits<T>;
+
+        GE_BIT_CAST_CONSTEXPR explicit RealCompareOperand(T x, T threshold = RealCompareThreshold<T>())
+            : value{x}
+            , bits{Bits::Get(x)}
+            , abs{Bits::Abs(x)}
+            , below{Bits::Abs(x) < threshold}
+        {
+        }
+
+        T value{};
+        typename Bits::int_type bits{};
+        T abs{};
+        bool below{};
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+        Second operand of RealCompareFused fixed together with the tolerance:
+        besides the operand state, tol * |value| and whether it is below the
+        threshold, so that comparing against it takes a single product.
+    */
+    template <typename T>
+    struct RealCompareFixed
+    {
+        GE_BIT_CAST_CONSTEXPR RealCompareFixed(T x, T tolerance, T thresholdValue = RealCompareThreshold<T>())
+            : operand{x, thresholdValue}
+            , tol{tolerance}
+            , tolAbs{tolerance * operand.abs}
+            , tolAbsBelow{tolerance * operand.abs < thresholdValue}
+            , threshold{thresholdValue}
+        {
+        }
+
+        RealCompareOperand<T> operand;
+        T tol{};
+        T tolAbs{};
+        bool tolAbsBelow{};
+        T threshold{};
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+        Fused tolerant comparison of (a, b). The shared state (absolute values,
+        factored maximum, threshold flags, raw bits) is computed once and the
+        equal/less/greater answers are derived from it with bitwise selects
+        instead of branches. Each answer is the one the two-pass scheme gives:
+
+        - ULP mode (either magnitude or the factored minimum below threshold):
+          equal within 1 ULP; when only one side is below threshold the order
+          follows the sign of the other one.
+        - Otherwise: |a - b| <= tol * max(|a|, |b|) decides equality and the
+          signed difference against the same bound decides the order.
+    */
+    template <typename T>
+    class RealCompareFused
+    {
+        using Bits = RealBits<T>;
+        using int_type = typename Bits::int_type;
+        using uint_type = typename Bits::uint_type;
+
+    public:
+        GE_BIT_CAST_CONSTEXPR RealCompareFused(T a, T b, T tol, T threshold = RealCompareThreshold<T>())
+            : RealCompareFused(RealCompareOperand<T>(a, threshold), RealCompareOperand<T>(b, threshold), tol, threshold)
+        {
+        }
+
+        // Both operands must have been prepared with the same threshold
+        GE_BIT_CAST_CONSTEXPR RealCompareFused(const RealCompareOperand<T>& a, const RealCompareOperand<T>& b,
+                                               T tol, T threshold = RealCompareThreshold<T>())
+            : m_a{a.value}
+            , m_b{b.value}
+            , m_bitsA{a.bits}
+            , m_bitsB{b.bits}
+            , m_maxAbsFactored{tol * Max(a.abs, b.abs)}
+            , m_firstBelow{a.below}
+            , m_secondBelow{b.below}
+            , m_minFactoredBelow{tol * Min(a.abs, b.abs) < threshold}
+        {
+        }
+
+        // Against a fixed second operand; a must have been prepared with its
+        // threshold. tol * Max and tol * Min pick one of the two products, so
+        // the answers are the ones of the constructor above.
+        GE_BIT_CAST_CONSTEXPR RealCompareFused(const RealCompareOperand<T>& a, const RealCompareFixed<T>& b)
+            : m_a{a.value}
+            , m_b{b.operand.value}
+            , m_bitsA{a.bits}
+            , m_bitsB{b.operand.bits}
+            , m_maxAbsFactored{a.abs < b.operand.abs ? b.tolAbs : b.tol * a.abs}
+            , m_firstBelow{a.below}
+            , m_secondBelow{b.operand.below}
+            , m_minFactoredBelow{a.abs < b.operand.abs ? b.tol * a.abs < b.threshold : b.tolAbsBelow}
+        {
+        }
+
+        constexpr bool IsAnyOfAbsBelowTheshold() const
+        {
+            return m_firstBelow | m_secondBelow;
+        }
+
+        constexpr bool IsMinOfAbsBelowTheshold() const
+        {
+            return m_minFactoredBelow;
+        }
+
+        GE_BIT_CAST_CONSTEXPR bool Equal() const
+        {
+            return EqualFrom(m_a - m_b);
+        }
+
+        GE_BIT_CAST_CONSTEXPR bool Less() const
+        {
+            const T diff = m_a - m_b;
+            return !EqualFrom(diff) & LessFrom(diff);
+        }
+
+        GE_BIT_CAST_CONSTEXPR bool Greater() const
+        {
+            const T diff = m_a - m_b;
+            return !EqualFrom(diff) & GreaterFrom(diff);
+        }
+
+        // GeRealOrder value: -1 less, 0 equal, 1 greater, 2 unordered. One
+        // pass: equality is decided once and masks both orderings.
+        GE_BIT_CAST_CONSTEXPR int32_t Compare() const
+        {
+            const T diff = m_a - m_b;
+            const bool equal = EqualFrom(diff);
+            const bool less = !equal & LessFrom(diff);
+            const bool greater = !equal & GreaterFrom(diff);
+            // at most one of the three is set
+            return less * -1 + greater * 1 + !(equal | less | greater) * 2;
+        }
+
+    private:
+        // the second operand wins when the comparison is false (NaN)
+        static constexpr T Max(T absA, T absB) { return absA < absB ? absB : absA; }
+        static constexpr T Min(T absA, T absB) { return absA < absB ? absA : absB; }
+
+        constexpr bool SameSign() const
+        {
+            return (m_bitsA ^ m_bitsB) >= 0;
+        }
+
+        constexpr bool UlpEqual() const
+        {
+            const int_type diff = RealBitsDiff<T>(m_bitsA, m_bitsB);
+            const uint_type absDiff = (diff < 0) ? uint_type(0) - static_cast<uint_type>(diff) : static_cast<uint_type>(diff);
+            const bool closeBits = absDiff <= 1;
+            const bool sameSign = SameSign();
+            return (sameSign & closeBits) | (!sameSign & (m_a == m_b));
+        }
+
+        // The three answers from diff = a - b; b - a is -diff exactly
+        GE_BIT_CAST_CONSTEXPR bool EqualFrom(T diff) const
+        {
+            const bool ulpMode = m_firstBelow | m_secondBelow | m_minFactoredBelow;
+            const bool relEqual = Bits::Abs(diff) <= m_maxAbsFactored;
+            return (ulpMode & UlpEqual()) | (!ulpMode & relEqual);
+        }
+
+        // Order of (a, b) when they are not equal
+        constexpr bool LessFrom(T diff) const
+        {
+            const bool negA = m_bitsA < 0;
+            const bool negB = m_bitsB < 0;
+            const bool ulpLess = SameSign() ? (RealBitsDiff<T>(m_bitsB, m_bitsA) > 0) : negA;
+            const bool relLess = -diff > m_maxAbsFactored;
+            return Order(m_firstBelow, m_secondBelow, ulpLess, !negB, negA, relLess);
+        }
+
+        constexpr bool GreaterFrom(T diff) const
+        {
+            const bool negA = m_bitsA < 0;
+            const bool negB = m_bitsB < 0;
+            const bool ulpGreater = SameSign() ? (RealBitsDiff<T>(m_bitsA, m_bitsB) > 0) : negB;
+            const bool relGreater = diff > m_maxAbsFactored;
+            return Order(m_secondBelow, m_firstBelow, ulpGreater, !negA, negB, relGreater);
+        }
+
+        // Selects the ordering rule by which operand is below the threshold
+        static constexpr bool Order(bool firstBelow, bool secondBelow,
+                                    bool bothBelow, bool onlyFirstBelow, bool onlySecondBelow, bool noneBelow)
+        {
+            return (firstBelow & secondBelow & bothBelow) |
+                   (firstBelow & !secondBelow & onlyFirstBelow) |
+                   (!firstBelow & secondBelow & onlySecondBelow) |
+                   (!firstBelow & !secondBelow & noneBelow);
+        }
+
+    private:
+        T m_a{};
+        T m_b{};
+        int_type m_bitsA{};
+        int_type m_bitsB{};
+
+        T m_maxAbsFactored{};
+
+        bool m_firstBelow{};
+        bool m_secondBelow{};
+        bool m_minFactoredBelow{};
+    };
+
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_REALCOMPARE_H
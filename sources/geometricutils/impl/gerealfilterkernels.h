@@ -0,0 +1,457 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_FILTERKERNELS_H
+#define GEOMUTILS_IMPL_FILTERKERNELS_H
+
+// Branchless kernels of GeRealBatchFilter/GeRealBatchMask: the tolerant
+// comparison of RealCompareFused(x, fixed), kLanes values at a time, with
+// one result bit per lane for equal, less and greater. The vector versions
+// evaluate the same terms as the scalar one:
+//   maxFactored = |x| < |v| ? tol * |v| : tol * |x|, and the threshold test
+//     of the smaller product likewise
+//   ulpMode     = |x| or |v| below threshold, or the smaller product
+//   equal       = ulpMode ? within 1 ULP (same sign) or x == v : |x - v| <= maxFactored
+//   less        = !equal && the ordering rule picked by which side is below
+//     threshold (RealCompareFused::Order), greater likewise
+// The bit tests reuse the integer lane ops of geulpkernels.h.
+
+#include "impl/gerealcompare.h"
+#include "impl/gesimd.h"
+
+#include <cstring>
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace filterkernels
+{
+    struct LaneMasks
+    {
+        uint32_t equal;
+        uint32_t less;
+        uint32_t greater;
+    };
+
+    //--------------------------------------------------------------------------
+    // RealCompareFused itself: the reference, the tail of the vector kernels
+    // and the fallback of tiers without integer lanes of the width. Only the
+    // answer Op selects is evaluated.
+    template <typename T>
+    struct FilterScalar
+    {
+        using value_type = T;
+        static constexpr size_t kLanes = 1;
+
+        template <typename Op>
+        static uint32_t Select(const T* x, const RealCompareFixed<T>& fixed, uint32_t)
+        {
+            const RealCompareFused<T> cmp(RealCompareOperand<T>(*x, fixed.threshold), fixed);
+            return Op::Test(cmp);
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // Lane by lane over the vectors of Ops: F holds reals, I their bits and
+    // M lane masks
+    template <typename Ops>
+    struct FilterSimd
+    {
+        using T = typename Ops::value_type;
+        using value_type = T;
+        static constexpr size_t kLanes = Ops::kLanes;
+
+        template <typename Op>
+        static uint32_t Select(const T* p, const RealCompareFixed<T>& fixed, uint32_t lanes)
+        {
+            return Op::Select(Masks(p, fixed), lanes);
+        }
+
+        static LaneMasks Masks(const T* p, const RealCompareFixed<T>& fixed)
+        {
+            using F = typename Ops::F;
+            using I = typename Ops::I;
+            using M = typename Ops::M;
+
+            const F x = Ops::Load(p);
+            const F v = Ops::Set(fixed.operand.value);
+            const I bitsX = Ops::Bits(x);
+            const I bitsV = Ops::Bits(v);
+            const F threshold = Ops::Set(fixed.threshold);
+
+            // magnitudes and the factored ones, tol * |v| precomputed
+            const F absX = Ops::Abs(x);
+            const M belowX = Ops::Less(absX, threshold);
+            const M belowV = Ops::Uniform(fixed.operand.below);
+            const M smallerX = Ops::Less(absX, Ops::Set(fixed.operand.abs));
+            const F tolAbsX = Ops::Mul(Ops::Set(fixed.tol), absX);
+            const F maxFactored = Ops::Select(smallerX, Ops::Set(fixed.tolAbs), tolAbsX);
+            const M minBelow = Ops::SelectMask(smallerX, Ops::Less(tolAbsX, threshold), Ops::Uniform(fixed.tolAbsBelow));
+            const M ulpMode = Ops::Or(Ops::Or(belowX, belowV), minBelow);
+
+            // relative path on diff = x - v; v - x is -diff exactly
+            const F diff = Ops::Sub(x, v);
+            const M relEqual = Ops::LessEqual(Ops::Abs(diff), maxFactored);
+            const M relLess = Ops::Less(maxFactored, Ops::Neg(diff));
+            const M relGreater = Ops::Less(maxFactored, diff);
+
+            // ULP path on the bits
+            const M negX = Ops::Negative(bitsX);
+            const M negV = Ops::Uniform(fixed.operand.bits < 0);
+            const M sameSign = Ops::SameSign(bitsX, bitsV);
+            const M ulpEqual = Ops::SelectMask(sameSign, Ops::WithinOneUlp(bitsX, bitsV), Ops::Equal(x, v));
+            const M ulpLess = Ops::SelectMask(sameSign, Ops::BitsGreater(bitsV, bitsX), negX);
+            const M ulpGreater = Ops::SelectMask(sameSign, Ops::BitsGreater(bitsX, bitsV), negV);
+
+            const M equal = Ops::SelectMask(ulpMode, ulpEqual, relEqual);
+            const M less = Ops::SelectMask(belowV, Ops::SelectMask(belowX, ulpLess, negX),
+                                           Ops::SelectMask(belowX, Ops::Not(negV), relLess));
+            const M greater = Ops::SelectMask(belowV, Ops::SelectMask(belowX, ulpGreater, Ops::Not(negX)),
+                                              Ops::SelectMask(belowX, negV, relGreater));
+            // A negative tol can leave both orderings set; Compare() adds them
+            // up to kEqual
+            const uint32_t lessBits = Ops::ToBits(Ops::AndNot(equal, less));
+            const uint32_t greaterBits = Ops::ToBits(Ops::AndNot(equal, greater));
+            return {Ops::ToBits(equal) | (lessBits & greaterBits), lessBits & ~greaterBits, greaterBits & ~lessBits};
+        }
+    };
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    // Masks are integer vectors, as in UlpSse2
+    struct OpsF32Sse2
+    {
+        using value_type = real32_t;
+        using F = __m128;
+        using I = __m128i;
+        using M = __m128i;
+        static constexpr size_t kLanes = 4;
+
+        static F Load(const real32_t* p) { return _mm_loadu_ps(p); }
+        static F Set(real32_t x) { return _mm_set1_ps(x); }
+        static I Bits(F x) { return _mm_castps_si128(x); }
+        static F Abs(F x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+        static F Neg(F x) { return _mm_xor_ps(_mm_set1_ps(-0.0f), x); }
+        static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+        static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+
+        static M Less(F a, F b) { return _mm_castps_si128(_mm_cmplt_ps(a, b)); }
+        static M LessEqual(F a, F b) { return _mm_castps_si128(_mm_cmple_ps(a, b)); }
+        static M Equal(F a, F b) { return _mm_castps_si128(_mm_cmpeq_ps(a, b)); }
+
+        static F Select(M m, F a, F b)
+        {
+            const __m128 mf = _mm_castsi128_ps(m);
+            return _mm_or_ps(_mm_and_ps(mf, a), _mm_andnot_ps(mf, b));
+        }
+
+        static M SelectMask(M m, M a, M b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+        static M Or(M a, M b) { return _mm_or_si128(a, b); }
+        static M AndNot(M a, M b) { return _mm_andnot_si128(a, b); }
+        static M Not(M a) { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+        static M Uniform(bool flag) { return _mm_set1_epi32(flag ? -1 : 0); }
+
+        static M Negative(I bits) { return _mm_srai_epi32(bits, 31); }
+        static M SameSign(I a, I b) { return _mm_cmpeq_epi32(_mm_srai_epi32(a, 31), _mm_srai_epi32(b, 31)); }
+
+        static M WithinOneUlp(I a, I b)
+        {
+            const __m128i diff = _mm_sub_epi32(a, b);
+            const __m128i s = _mm_srai_epi32(diff, 31);
+            const __m128i absDiff = _mm_sub_epi32(_mm_xor_si128(diff, s), s);
+            return Not(_mm_cmpgt_epi32(absDiff, _mm_set1_epi32(1)));
+        }
+
+        // a - b > 0, wrapping like RealBitsDiff
+        static M BitsGreater(I a, I b) { return _mm_cmpgt_epi32(_mm_sub_epi32(a, b), _mm_setzero_si128()); }
+
+        static uint32_t ToBits(M m) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+    };
+
+    using FilterF32Sse2 = FilterSimd<OpsF32Sse2>;
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_AVX2
+    //--------------------------------------------------------------------------
+    struct OpsF32Avx2
+    {
+        using value_type = real32_t;
+        using F = __m256;
+        using I = __m256i;
+        using M = __m256i;
+        static constexpr size_t kLanes = 8;
+
+        static F Load(const real32_t* p) { return _mm256_loadu_ps(p); }
+        static F Set(real32_t x) { return _mm256_set1_ps(x); }
+        static I Bits(F x) { return _mm256_castps_si256(x); }
+        static F Abs(F x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+        static F Neg(F x) { return _mm256_xor_ps(_mm256_set1_ps(-0.0f), x); }
+        static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+        static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+
+        static M Less(F a, F b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+        static M LessEqual(F a, F b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_LE_OQ)); }
+        static M Equal(F a, F b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+
+        static F Select(M m, F a, F b) { return _mm256_blendv_ps(b, a, _mm256_castsi256_ps(m)); }
+        static M SelectMask(M m, M a, M b) { return _mm256_or_si256(_mm256_and_si256(m, a), _mm256_andnot_si256(m, b)); }
+        static M Or(M a, M b) { return _mm256_or_si256(a, b); }
+        static M AndNot(M a, M b) { return _mm256_andnot_si256(a, b); }
+        static M Not(M a) { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+        static M Uniform(bool flag) { return _mm256_set1_epi32(flag ? -1 : 0); }
+
+        static M Negative(I bits) { return _mm256_srai_epi32(bits, 31); }
+        static M SameSign(I a, I b) { return _mm256_cmpeq_epi32(_mm256_srai_epi32(a, 31), _mm256_srai_epi32(b, 31)); }
+        static M WithinOneUlp(I a, I b) { return Not(_mm256_cmpgt_epi32(_mm256_abs_epi32(_mm256_sub_epi32(a, b)), _mm256_set1_epi32(1))); }
+        static M BitsGreater(I a, I b) { return _mm256_cmpgt_epi32(_mm256_sub_epi32(a, b), _mm256_setzero_si256()); }
+
+        static uint32_t ToBits(M m) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+    };
+
+    // 64-bit lanes: no arithmetic shift, so signs come from a compare with 0
+    struct OpsF64Avx2
+    {
+        using value_type = real64_t;
+        using F = __m256d;
+        using I = __m256i;
+        using M = __m256i;
+        static constexpr size_t kLanes = 4;
+
+        static F Load(const real64_t* p) { return _mm256_loadu_pd(p); }
+        static F Set(real64_t x) { return _mm256_set1_pd(x); }
+        static I Bits(F x) { return _mm256_castpd_si256(x); }
+        static F Abs(F x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+        static F Neg(F x) { return _mm256_xor_pd(_mm256_set1_pd(-0.0), x); }
+        static F Mul(F a, F b) { return _mm256_mul_pd(a, b); }
+        static F Sub(F a, F b) { return _mm256_sub_pd(a, b); }
+
+        static M Less(F a, F b) { return _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+        static M LessEqual(F a, F b) { return _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_LE_OQ)); }
+        static M Equal(F a, F b) { return _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+
+        static F Select(M m, F a, F b) { return _mm256_blendv_pd(b, a, _mm256_castsi256_pd(m)); }
+        static M SelectMask(M m, M a, M b) { return _mm256_or_si256(_mm256_and_si256(m, a), _mm256_andnot_si256(m, b)); }
+        static M Or(M a, M b) { return _mm256_or_si256(a, b); }
+        static M AndNot(M a, M b) { return _mm256_andnot_si256(a, b); }
+        static M Not(M a) { return _mm256_xor_si256(a, _mm256_set1_epi64x(-1)); }
+        static M Uniform(bool flag) { return _mm256_set1_epi64x(flag ? -1 : 0); }
+
+        static M Negative(I bits) { return _mm256_cmpgt_epi64(_mm256_setzero_si256(), bits); }
+        static M SameSign(I a, I b) { return Not(Negative(_mm256_xor_si256(a, b))); }
+
+        static M WithinOneUlp(I a, I b)
+        {
+            const __m256i diff = _mm256_sub_epi64(a, b);
+            return Not(_mm256_or_si256(_mm256_cmpgt_epi64(diff, _mm256_set1_epi64x(1)),
+                                       _mm256_cmpgt_epi64(_mm256_set1_epi64x(-1), diff)));
+        }
+
+        static M BitsGreater(I a, I b) { return _mm256_cmpgt_epi64(_mm256_sub_epi64(a, b), _mm256_setzero_si256()); }
+
+        static uint32_t ToBits(M m) { return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+    };
+
+    using FilterF32Avx2 = FilterSimd<OpsF32Avx2>;
+    using FilterF64Avx2 = FilterSimd<OpsF64Avx2>;
+#endif // GE_KERNEL_HAS_AVX2
+
+#ifdef GE_KERNEL_HAS_AVX512
+    //--------------------------------------------------------------------------
+    // Masks are the compare mask registers, widened to uint32_t
+    struct OpsF32Avx512
+    {
+        using value_type = real32_t;
+        using F = __m512;
+        using I = __m512i;
+        using M = uint32_t;
+        static constexpr size_t kLanes = 16;
+        static constexpr M kAll = 0xffffu;
+
+        static F Load(const real32_t* p) { return _mm512_loadu_ps(p); }
+        static F Set(real32_t x) { return _mm512_set1_ps(x); }
+        static I Bits(F x) { return _mm512_castps_si512(x); }
+        static F Abs(F x) { return _mm512_abs_ps(x); }
+        static F Neg(F x) { return _mm512_castsi512_ps(_mm512_xor_si512(Bits(x), _mm512_set1_epi32(INT32_MIN))); }
+        static F Mul(F a, F b) { return _mm512_mul_ps(a, b); }
+        static F Sub(F a, F b) { return _mm512_sub_ps(a, b); }
+
+        static M Less(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+        static M LessEqual(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+        static M Equal(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+
+        static F Select(M m, F a, F b) { return _mm512_mask_blend_ps(static_cast<__mmask16>(m), b, a); }
+        static M SelectMask(M m, M a, M b) { return (m & a) | (~m & b & kAll); }
+        static M Or(M a, M b) { return a | b; }
+        static M AndNot(M a, M b) { return ~a & b; }
+        static M Not(M a) { return ~a & kAll; }
+        static M Uniform(bool flag) { return flag ? kAll : 0; }
+
+        static M Negative(I bits) { return _mm512_cmplt_epi32_mask(bits, _mm512_setzero_si512()); }
+        static M SameSign(I a, I b) { return Not(Negative(_mm512_xor_si512(a, b))); }
+        static M WithinOneUlp(I a, I b) { return _mm512_cmple_epi32_mask(_mm512_abs_epi32(_mm512_sub_epi32(a, b)), _mm512_set1_epi32(1)); }
+        static M BitsGreater(I a, I b) { return _mm512_cmpgt_epi32_mask(_mm512_sub_epi32(a, b), _mm512_setzero_si512()); }
+
+        static uint32_t ToBits(M m) { return m; }
+    };
+
+    struct OpsF64Avx512
+    {
+        using value_type = real64_t;
+        using F = __m512d;
+        using I = __m512i;
+        using M = uint32_t;
+        static constexpr size_t kLanes = 8;
+        static constexpr M kAll = 0xffu;
+
+        static F Load(const real64_t* p) { return _mm512_loadu_pd(p); }
+        static F Set(real64_t x) { return _mm512_set1_pd(x); }
+        static I Bits(F x) { return _mm512_castpd_si512(x); }
+        static F Abs(F x) { return _mm512_abs_pd(x); }
+        static F Neg(F x) { return _mm512_castsi512_pd(_mm512_xor_si512(Bits(x), _mm512_set1_epi64(INT64_MIN))); }
+        static F Mul(F a, F b) { return _mm512_mul_pd(a, b); }
+        static F Sub(F a, F b) { return _mm512_sub_pd(a, b); }
+
+        static M Less(F a, F b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+        static M LessEqual(F a, F b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+        static M Equal(F a, F b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+
+        static F Select(M m, F a, F b) { return _mm512_mask_blend_pd(static_cast<__mmask8>(m), b, a); }
+        static M SelectMask(M m, M a, M b) { return (m & a) | (~m & b & kAll); }
+        static M Or(M a, M b) { return a | b; }
+        static M AndNot(M a, M b) { return ~a & b; }
+        static M Not(M a) { return ~a & kAll; }
+        static M Uniform(bool flag) { return flag ? kAll : 0; }
+
+        static M Negative(I bits) { return _mm512_cmplt_epi64_mask(bits, _mm512_setzero_si512()); }
+        static M SameSign(I a, I b) { return Not(Negative(_mm512_xor_si512(a, b))); }
+        static M WithinOneUlp(I a, I b) { return _mm512_cmple_epi64_mask(_mm512_abs_epi64(_mm512_sub_epi64(a, b)), _mm512_set1_epi64(1)); }
+        static M BitsGreater(I a, I b) { return _mm512_cmpgt_epi64_mask(_mm512_sub_epi64(a, b), _mm512_setzero_si512()); }
+
+        static uint32_t ToBits(M m) { return m; }
+    };
+
+    using FilterF32Avx512 = FilterSimd<OpsF32Avx512>;
+    using FilterF64Avx512 = FilterSimd<OpsF64Avx512>;
+#endif // GE_KERNEL_HAS_AVX512
+
+    //--------------------------------------------------------------------------
+    // Drivers: widest kernel for the bulk, FilterScalar for the tail.
+
+    // Select picks from the lane masks, Test answers for one element. A
+    // negative tolerance can make both orderings hold, GeRealCompare calls
+    // that equal.
+    struct LessOp
+    {
+        static uint32_t Select(const LaneMasks& m, uint32_t) { return m.less; }
+
+        template <typename T>
+        static bool Test(const RealCompareFused<T>& cmp) { return cmp.Less() & !cmp.Greater(); }
+    };
+
+    struct EqualOp
+    {
+        static uint32_t Select(const LaneMasks& m, uint32_t) { return m.equal; }
+
+        template <typename T>
+        static bool Test(const RealCompareFused<T>& cmp) { return cmp.Compare() == 0; }
+    };
+
+    struct GreaterOp
+    {
+        static uint32_t Select(const LaneMasks& m, uint32_t) { return m.greater; }
+
+        template <typename T>
+        static bool Test(const RealCompareFused<T>& cmp) { return cmp.Greater() & !cmp.Less(); }
+    };
+
+    struct UnorderedOp
+    {
+        static uint32_t Select(const LaneMasks& m, uint32_t lanes) { return lanes & ~(m.equal | m.less | m.greater); }
+
+        template <typename T>
+        static bool Test(const RealCompareFused<T>& cmp) { return cmp.Compare() == 2; }
+    };
+
+    // Every position is stored and the count advances on a match, so the
+    // loop does not branch on the outcome
+    template <typename K, typename Op, typename T>
+    inline size_t FilterRange(const T* values, const RealCompareFixed<T>& fixed, uint32_t* out, size_t& count,
+                              size_t i, size_t n)
+    {
+        constexpr uint32_t kLaneBits = uint32_t((uint64_t(1) << K::kLanes) - 1);
+        for (; i + K::kLanes <= n; i += K::kLanes)
+        {
+            const uint32_t m = K::template Select<Op>(values + i, fixed, kLaneBits);
+            for (size_t j = 0; j < K::kLanes; ++j)
+            {
+                out[count] = static_cast<uint32_t>(i + j);
+                count += (m >> j) & 1u;
+            }
+        }
+        return i;
+    }
+
+    template <typename K, typename Op>
+    size_t Filter(const typename K::value_type* values, size_t n, const RealCompareFixed<typename K::value_type>& fixed,
+                  uint32_t* out)
+    {
+        using T = typename K::value_type;
+        size_t count = 0;
+        const size_t i = FilterRange<K, Op, T>(values, fixed, out, count, 0, n);
+        FilterRange<FilterScalar<T>, Op, T>(values, fixed, out, count, i, n);
+        return count;
+    }
+
+    // Bit i of the result lives in word i / 64 at position i % 64; unused
+    // high bits of the last word are cleared.
+    template <typename K, typename Op, typename T>
+    inline size_t MaskRange(const T* values, const RealCompareFixed<T>& fixed, uint64_t* out, size_t i, size_t n)
+    {
+        constexpr uint32_t kLaneBits = uint32_t((uint64_t(1) << K::kLanes) - 1);
+        for (; i + K::kLanes <= n; i += K::kLanes)
+        {
+            const uint64_t m = K::template Select<Op>(values + i, fixed, kLaneBits);
+            out[i / 64] |= m << (i % 64);
+        }
+        return i;
+    }
+
+    template <typename K, typename Op>
+    void Mask(const typename K::value_type* values, size_t n, const RealCompareFixed<typename K::value_type>& fixed,
+              uint64_t* out)
+    {
+        using T = typename K::value_type;
+        std::memset(out, 0, ((n + 63) / 64) * sizeof(uint64_t));
+        const size_t i = MaskRange<K, Op, T>(values, fixed, out, 0, n);
+        MaskRange<FilterScalar<T>, Op, T>(values, fixed, out, i, n);
+    }
+
+} // end of filterkernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_FILTERKERNELS_H
@@ -25,25 +25,13 @@ SOFTWARE.
 
 #include "gebasedefs.h"
 #include "gerealutl.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+#include <algorithm>
+#include <cassert>
 #include <limits>
 #include <cmath>
 
-namespace ge
-{
-    namespace details
-    {
-        namespace realmath
-        {
-            template <typename TInt>
-            constexpr inline TInt IntAbsImpl(TInt x)
-            {
-                return x >= 0 ? x : -x;
-            }
-        } // end of realmath
-
-    } // end of details
-} // end of ge
-
 namespace ge
 {
 namespace details
@@ -81,271 +69,115 @@ namespace details
 } // end of ge
 
 
-namespace ge
-{
-namespace details
-{
-    class Real32Impl
-    {
-        union
-        {
-            int32_t asInt;
-            real32_t asFlt;
-        } m_data;
-
-    public:
-        Real32Impl(real32_t val = 0.0f)
-        {
-            m_data.asFlt = val;
-        }
-
-        bool IsNegative() const
-        {
-            return m_data.asInt < 0;
-        }
-
-        int32_t ExtractMantissa() const
-        {
-#ifdef GE_LITTLE_ENDIAN
-            return m_data.asInt & 0x7FFFFF;
-#elif GE_BIG_ENDIAN
-#   error "Not implemented yet!"
-#else
-#   error "Not implemented yet!"
-#endif
-        }
-
-        int32_t ExtractExponent() const
-        {
-#ifdef GE_LITTLE_ENDIAN
-            return (m_data.asInt >> 23) & 0xFF;
-#elif GE_BIG_ENDIAN
-#   error "Not implemented yet!"
-#else
-#   error "Not implemented yet!"
-#endif
-        }
-
-        int32_t AsInt32() const { return m_data.asInt; }
-
-        real32_t ToAbs()
-        {
-#ifdef GE_LITTLE_ENDIAN
-            m_data.asInt &= 0x7FFFFFFF;
-            return m_data.asFlt;
-#elif GE_BIG_ENDIAN
-#   error "Not implemented yet!"
-#else
-#   error "Not implemented yet!"
-#endif
-        }
-    };
-
-
-} // end of details
-} // end of ge
-
-
 //==============================================================================
-// Real absolute and sign
+// Real comparision
+
+//------------------------------------------------------------------------------
+// Batch ULP comparison
 
-template <>
-inline GeReal32 GeRealAbs<GeReal32>(GeReal32 x)
+void GeIsRealEqualByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<bool> out)
 {
-#ifdef GE_FLOAT_ABS_STD_IMPL
-    return reinterpret_cast<float>(std::fabs(x));
-#else
-    ge::details::Real32Impl fX(x);
-    return fX.ToAbs();
-#endif
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchUlpCompare, a.size());
+    assert(a.size() == b.size() && a.size() == out.size());
+    ge::details::dispatch::ActiveKernelTable().ulp.equalBools(a.data(), b.data(), tolInUlps, out.data(), a.size());
 }
 
-template <>
-inline bool GeIsRealNegative<GeReal32>(GeReal32 x)
+void GeIsRealLessByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<bool> out)
 {
-    ge::details::Real32Impl fX(x);
-    return fX.IsNegative();
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchUlpCompare, a.size());
+    assert(a.size() == b.size() && a.size() == out.size());
+    ge::details::dispatch::ActiveKernelTable().ulp.lessBools(a.data(), b.data(), tolInUlps, out.data(), a.size());
 }
-//==============================================================================
-// Real comparision
 
-bool GeIsRealEqualByUlps(GeReal32 a, GeReal32 b, GeInt32 tolInUlps)
+void GeIsRealEqualByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<GeUint64> outMask)
 {
-    ge::details::Real32Impl fA(a);
-    ge::details::Real32Impl fB(b);
-
-    if (fA.IsNegative() != fB.IsNegative())
-    {
-        // +0 == -0 case
-        return (a == b);
-    }
-
-    GeInt32 ulpsDiff = ge::details::realmath::IntAbsImpl(fA.AsInt32() - fB.AsInt32());
-    return (ulpsDiff <= tolInUlps);
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchUlpCompare, a.size());
+    assert(a.size() == b.size() && outMask.size() >= (a.size() + 63) / 64);
+    ge::details::dispatch::ActiveKernelTable().ulp.equalBits(a.data(), b.data(), tolInUlps, outMask.data(), a.size());
 }
 
-bool GeIsRealLessByUlps(GeReal32 a, GeReal32 b, GeInt32 tolInUlps)
+void GeIsRealLessByUlps(GeSpan<const GeReal32> a, GeSpan<const GeReal32> b, GeInt32 tolInUlps, GeSpan<GeUint64> outMask)
 {
-    if (GeIsRealEqualByUlps(a, b, tolInUlps))
-        return false;
-
-    ge::details::Real32Impl fA(a);
-    ge::details::Real32Impl fB(b);
-
-    if (fA.IsNegative())
-    {
-        if (!fB.IsNegative())
-        {
-            return (a == b) ? false : true; // -0 & 0 case
-        }
-    }
-    else // a - positive or zero
-    {
-        if (fB.IsNegative())
-        {
-            return false;
-        }
-    }
-
-    GeInt32 ulpsDiff = fB.AsInt32() - fA.AsInt32();
-    return ulpsDiff > 0;
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchUlpCompare, a.size());
+    assert(a.size() == b.size() && outMask.size() >= (a.size() + 63) / 64);
+    ge::details::dispatch::ActiveKernelTable().ulp.lessBits(a.data(), b.data(), tolInUlps, outMask.data(), a.size());
 }
 
-namespace ge
-{
-namespace details
-{
-template <typename T>
-class RealCompareAux
-{
-    enum Flags
-    {
-        kEmpty,
-        kFirstBelowThreshold = 1 << 0,
-        kSecondBelowThreshold = 1 << 1,
-        kBelowThresholdMask = 0x00000003,
-        kMinFactoredBelowThreshold = 1 << 2,
+//------------------------------------------------------------------------------
+// Batch filter against a fixed value
 
-    };
+namespace
+{
+    template <typename T>
+    const ge::details::dispatch::RealFilterKernelTable<T>& FilterKernels();
 
-public:
-    RealCompareAux(T x1, T x2,
-                   T factor = GeDefaultEpsilon<T>(),
-                   T threshold = 10 * std::numeric_limits<T>::epsilon())
-        : m_x1{x1}
-        , m_x2{x2}
-        , m_factor{factor}
-        , m_threshold{threshold}
-        , m_flags{0}
+    template <>
+    const ge::details::dispatch::RealFilterKernelTable<GeReal32>& FilterKernels<GeReal32>()
     {
-        m_absX1 = GeRealAbs(m_x1);
-        m_absX2 = GeRealAbs(m_x2);
-
-        if (m_absX1 < m_threshold)
-        {
-            m_flags |= kFirstBelowThreshold;
-        }
-
-        if (m_absX2 < m_threshold)
-        {
-            m_flags |= kSecondBelowThreshold;
-        }
-
-        m_minAbsFactored = m_factor * ((m_absX1 < m_absX2) ? m_absX1 : m_absX2);
-        m_maxAbsFactored = m_factor * ((m_absX1 < m_absX2) ? m_absX2 : m_absX1);
-
-        if (m_minAbsFactored < m_threshold)
-        {
-            m_flags |= kMinFactoredBelowThreshold;
-        }
+        return ge::details::dispatch::ActiveKernelTable().filterf;
     }
 
-    bool IsFirstAbsBelowThreshold() const
+    template <>
+    const ge::details::dispatch::RealFilterKernelTable<GeReal64>& FilterKernels<GeReal64>()
     {
-        return m_flags & kFirstBelowThreshold;
+        return ge::details::dispatch::ActiveKernelTable().filterd;
     }
 
-    bool IsSecondAbsBelowThreshold() const
+    // Kernel slot of an order: less, equal, greater, unordered
+    GeSize FilterSlot(GeRealOrder order)
     {
-        return m_flags & kSecondBelowThreshold;
+        const GeSize slot = static_cast<GeSize>(static_cast<GeInt32>(order) + 1);
+        assert(slot < 4);
+        return slot;
     }
 
-    bool IsAnyOfAbsBelowTheshold() const
+    template <typename T>
+    GeSize BatchFilter(GeSpan<const T> values, const GeRealComparator<T>& comparator, GeRealOrder order,
+                       GeSpan<GeUint32> outIndices)
     {
-        return m_flags & kBelowThresholdMask;
-    }
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchRealFilter, values.size());
+        assert(outIndices.size() >= values.size());
+        assert(values.size() <= std::numeric_limits<GeUint32>::max());
 
-    bool IsMinOfAbsBelowTheshold() const
-    {
-        return m_flags & kMinFactoredBelowThreshold;
+        return FilterKernels<T>().filter[FilterSlot(order)](values.data(), values.size(), comparator.Prepared(),
+                                                            outIndices.data());
     }
 
-    T GetMaxAbsFactored() const
+    template <typename T>
+    void BatchMask(GeSpan<const T> values, const GeRealComparator<T>& comparator, GeRealOrder order,
+                   GeSpan<GeUint64> outMask)
     {
-        return m_maxAbsFactored;
-    }
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchRealFilter, values.size());
+        assert(outMask.size() >= (values.size() + 63) / 64);
 
-private:
-    T m_x1{};
-    T m_x2{};
-    T m_factor{};
-    T m_threshold{}; // low values ceil
-
-    T m_absX1{};
-    T m_absX2{};
-
-    T m_minAbsFactored{};
-    T m_maxAbsFactored{};
-
-    uint32_t m_flags{};
-};
-
-} // end of details
-} // end of ge
+        FilterKernels<T>().mask[FilterSlot(order)](values.data(), values.size(), comparator.Prepared(), outMask.data());
+    }
+} // end of anonymous
 
-template <>
-bool GeRealEqual<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol)
+template <>
+GeSize GeRealBatchFilter<GeReal32>(GeSpan<const GeReal32> values, const GeRealComparator<GeReal32>& comparator,
+                                   GeRealOrder order, GeSpan<GeUint32> outIndices)
 {
-    ge::details::RealCompareAux aux(a, b, tol);
-
-    if (aux.IsAnyOfAbsBelowTheshold() ||
-        aux.IsMinOfAbsBelowTheshold())
-    {
-        return GeIsRealEqualByUlps(a, b, 1);
-    }
-
-    return GeRealAbs(a - b) <= aux.GetMaxAbsFactored();
+    return BatchFilter(values, comparator, order, outIndices);
 }
 
-/// @todo not implemented yet
-template <>
-bool GeRealEqual<GeReal64>(GeReal64 a, GeReal64 b, GeReal64 tol);
-
-
-
-template <>
-bool GeRealLess<GeReal32>(GeReal32 a, GeReal32 b, GeReal32 tol)
+template <>
+GeSize GeRealBatchFilter<GeReal64>(GeSpan<const GeReal64> values, const GeRealComparator<GeReal64>& comparator,
+                                   GeRealOrder order, GeSpan<GeUint32> outIndices)
 {
-    if (GeRealEqual(a, b, tol))
-    {
-        return false;
-    }
-
-    ge::details::RealCompareAux aux(a, b, tol);
+    return BatchFilter(values, comparator, order, outIndices);
+}
 
-    if (aux.IsFirstAbsBelowThreshold())
-    {
-        if (aux.IsSecondAbsBelowThreshold())
-        {
-            return GeIsRealLessByUlps(a, b, 1);
-        }
-        return GeIsRealNegative(b) ? false : true;
-    }
+template <>
+void GeRealBatchMask<GeReal32>(GeSpan<const GeReal32> values, const GeRealComparator<GeReal32>& comparator,
+                               GeRealOrder order, GeSpan<GeUint64> outMask)
+{
+    BatchMask(values, comparator, order, outMask);
+}
 
-    if (aux.IsSecondAbsBelowThreshold())
-    {
-        return GeIsRealNegative(a) ? true : false;
-    }
-
-    return (b - a) > aux.GetMaxAbsFactored();
+template <>
+void GeRealBatchMask<GeReal64>(GeSpan<const GeReal64> values, const GeRealComparator<GeReal64>& comparator,
+                               GeRealOrder order, GeSpan<GeUint64> outMask)
+{
+    BatchMask(values, comparator, order, outMask);
 }
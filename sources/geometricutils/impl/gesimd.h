@@ -0,0 +1,363 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_SIMD_H
+#define GEOMUTILS_IMPL_SIMD_H
+
+// Thin lane-pack wrappers used by the batch kernels. Every pack exposes the
+// same interface so a kernel is written once and instantiated per instruction
+// set; ScalarPack doubles as the tail/fallback implementation.
+//
+// The kernel headers are compiled once per dispatch tier (see gekernels_*.cpp).
+// Each such translation unit defines GE_KERNEL_TIER, which tags everything in
+// here with a distinct inline namespace so that inline functions built for
+// different instruction sets never merge at link time, and GE_KERNEL_ENABLE_*
+// for the instruction sets it is allowed to use.
+
+#include "gebasedefs.h"
+#include <cmath>
+#include <type_traits>
+
+#ifdef GE_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+#ifndef GE_KERNEL_TIER
+#   define GE_KERNEL_TIER native
+#endif
+
+#if defined(GE_ARCH_X86) && (defined(GE_SIMD_SSE2) || defined(GE_KERNEL_ENABLE_SSE2))
+#   define GE_KERNEL_HAS_SSE2
+#endif
+
+#if defined(GE_ARCH_X86) && (defined(GE_SIMD_AVX2) || defined(GE_KERNEL_ENABLE_AVX2))
+#   define GE_KERNEL_HAS_AVX2
+#endif
+
+#if defined(GE_ARCH_X86) && (defined(GE_SIMD_AVX512) || defined(GE_KERNEL_ENABLE_AVX512))
+#   define GE_KERNEL_HAS_AVX512
+#endif
+
+#if defined(GE_ARCH_X86) && (defined(__F16C__) || defined(GE_KERNEL_ENABLE_F16C))
+#   define GE_KERNEL_HAS_F16C
+#endif
+
+// pdep/pext; the 64-bit forms need x86-64
+#if defined(GE_ARCH_X86) && (defined(__x86_64__) || defined(_M_X64)) && (defined(__BMI2__) || defined(GE_KERNEL_ENABLE_BMI2))
+#   define GE_KERNEL_HAS_BMI2
+#endif
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace simd
+{
+    //--------------------------------------------------------------------------
+    template <typename T>
+    struct ScalarPack
+    {
+        using value_type = T;
+        using mask_type = bool;
+        static constexpr size_t kLanes = 1;
+#ifdef GE_KERNEL_HAS_SSE2
+        static constexpr bool kHasRsqrt = std::is_same<T, real32_t>::value;
+#else
+        static constexpr bool kHasRsqrt = false;
+#endif
+
+        T v;
+
+        static ScalarPack Load(const T* p) { return {*p}; }
+        static ScalarPack Broadcast(T x) { return {x}; }
+        void Store(T* p) const { *p = v; }
+
+        // int32 lanes; stores round to nearest even
+        static ScalarPack FromInt32(const int32_t* p) { return {static_cast<T>(*p)}; }
+        void StoreInt32(int32_t* p) const { *p = static_cast<int32_t>(std::nearbyint(v)); }
+
+        // Signed 16-bit low/high halves of uint32 lanes
+        static ScalarPack FromInt16Low(const uint32_t* p) { return {static_cast<T>(static_cast<int16_t>(*p & 0xffffu))}; }
+        static ScalarPack FromInt16High(const uint32_t* p) { return {static_cast<T>(static_cast<int16_t>(*p >> 16))}; }
+    };
+
+    template <typename T> inline ScalarPack<T> operator+(ScalarPack<T> a, ScalarPack<T> b) { return {a.v + b.v}; }
+    template <typename T> inline ScalarPack<T> operator-(ScalarPack<T> a, ScalarPack<T> b) { return {a.v - b.v}; }
+    template <typename T> inline ScalarPack<T> operator*(ScalarPack<T> a, ScalarPack<T> b) { return {a.v * b.v}; }
+    template <typename T> inline ScalarPack<T> operator/(ScalarPack<T> a, ScalarPack<T> b) { return {a.v / b.v}; }
+    template <typename T> inline ScalarPack<T> Sqrt(ScalarPack<T> a) { return {static_cast<T>(std::sqrt(a.v))}; }
+    template <typename T> inline bool NotEqualZero(ScalarPack<T> a) { return a.v != T(0); }
+    template <typename T> inline ScalarPack<T> Select(bool m, ScalarPack<T> a, ScalarPack<T> b) { return m ? a : b; }
+    template <typename T> inline bool LessThan(ScalarPack<T> a, ScalarPack<T> b) { return a.v < b.v; }
+    template <typename T> inline ScalarPack<T> Abs(ScalarPack<T> a) { return {std::fabs(a.v)}; }
+    template <typename T> inline ScalarPack<T> CopySign(ScalarPack<T> magnitude, ScalarPack<T> sign) { return {std::copysign(magnitude.v, sign.v)}; }
+
+    // Min/Max return b when either operand is NaN, like minps/maxps, so a
+    // NaN element folded into an accumulator as a is skipped
+    template <typename T> inline ScalarPack<T> Min(ScalarPack<T> a, ScalarPack<T> b) { return {a.v < b.v ? a.v : b.v}; }
+    template <typename T> inline ScalarPack<T> Max(ScalarPack<T> a, ScalarPack<T> b) { return {a.v > b.v ? a.v : b.v}; }
+
+    // Hardware reciprocal square root estimate (only used when kHasRsqrt)
+    inline ScalarPack<real32_t> RsqrtApprox(ScalarPack<real32_t> a)
+    {
+#ifdef GE_KERNEL_HAS_SSE2
+        return {_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a.v)))};
+#else
+        return {1.0f / std::sqrt(a.v)};
+#endif
+    }
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    struct F32x4
+    {
+        using value_type = real32_t;
+        using mask_type = F32x4;
+        static constexpr size_t kLanes = 4;
+        static constexpr bool kHasRsqrt = true;
+
+        __m128 v;
+
+        static F32x4 Load(const real32_t* p) { return {_mm_loadu_ps(p)}; }
+        static F32x4 Broadcast(real32_t x) { return {_mm_set1_ps(x)}; }
+        void Store(real32_t* p) const { _mm_storeu_ps(p, v); }
+
+        static F32x4 FromInt32(const int32_t* p) { return {_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))}; }
+        void StoreInt32(int32_t* p) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvtps_epi32(v)); }
+
+        static F32x4 FromInt16Low(const uint32_t* p)
+        {
+            const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            return {_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(w, 16), 16))};
+        }
+        static F32x4 FromInt16High(const uint32_t* p)
+        {
+            return {_mm_cvtepi32_ps(_mm_srai_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), 16))};
+        }
+    };
+
+    inline F32x4 operator+(F32x4 a, F32x4 b) { return {_mm_add_ps(a.v, b.v)}; }
+    inline F32x4 operator-(F32x4 a, F32x4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+    inline F32x4 operator*(F32x4 a, F32x4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+    inline F32x4 operator/(F32x4 a, F32x4 b) { return {_mm_div_ps(a.v, b.v)}; }
+    inline F32x4 Sqrt(F32x4 a) { return {_mm_sqrt_ps(a.v)}; }
+    inline F32x4 RsqrtApprox(F32x4 a) { return {_mm_rsqrt_ps(a.v)}; }
+    inline F32x4 NotEqualZero(F32x4 a) { return {_mm_cmpneq_ps(a.v, _mm_setzero_ps())}; }
+    inline F32x4 Select(F32x4 m, F32x4 a, F32x4 b)
+    {
+        return {_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))};
+    }
+    inline F32x4 Min(F32x4 a, F32x4 b) { return {_mm_min_ps(a.v, b.v)}; }
+    inline F32x4 Max(F32x4 a, F32x4 b) { return {_mm_max_ps(a.v, b.v)}; }
+    inline F32x4 LessThan(F32x4 a, F32x4 b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+    inline F32x4 Abs(F32x4 a) { return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)}; }
+    inline F32x4 CopySign(F32x4 magnitude, F32x4 sign)
+    {
+        const __m128 signBit = _mm_set1_ps(-0.0f);
+        return {_mm_or_ps(_mm_andnot_ps(signBit, magnitude.v), _mm_and_ps(signBit, sign.v))};
+    }
+
+    //--------------------------------------------------------------------------
+    struct F64x2
+    {
+        using value_type = real64_t;
+        using mask_type = F64x2;
+        static constexpr size_t kLanes = 2;
+        static constexpr bool kHasRsqrt = false;
+
+        __m128d v;
+
+        static F64x2 Load(const real64_t* p) { return {_mm_loadu_pd(p)}; }
+        static F64x2 Broadcast(real64_t x) { return {_mm_set1_pd(x)}; }
+        void Store(real64_t* p) const { _mm_storeu_pd(p, v); }
+    };
+
+    inline F64x2 operator+(F64x2 a, F64x2 b) { return {_mm_add_pd(a.v, b.v)}; }
+    inline F64x2 operator-(F64x2 a, F64x2 b) { return {_mm_sub_pd(a.v, b.v)}; }
+    inline F64x2 operator*(F64x2 a, F64x2 b) { return {_mm_mul_pd(a.v, b.v)}; }
+    inline F64x2 operator/(F64x2 a, F64x2 b) { return {_mm_div_pd(a.v, b.v)}; }
+    inline F64x2 Sqrt(F64x2 a) { return {_mm_sqrt_pd(a.v)}; }
+    inline F64x2 NotEqualZero(F64x2 a) { return {_mm_cmpneq_pd(a.v, _mm_setzero_pd())}; }
+    inline F64x2 Select(F64x2 m, F64x2 a, F64x2 b)
+    {
+        return {_mm_or_pd(_mm_and_pd(m.v, a.v), _mm_andnot_pd(m.v, b.v))};
+    }
+    inline F64x2 Min(F64x2 a, F64x2 b) { return {_mm_min_pd(a.v, b.v)}; }
+    inline F64x2 Max(F64x2 a, F64x2 b) { return {_mm_max_pd(a.v, b.v)}; }
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_AVX2
+    //--------------------------------------------------------------------------
+    struct F32x8
+    {
+        using value_type = real32_t;
+        using mask_type = F32x8;
+        static constexpr size_t kLanes = 8;
+        static constexpr bool kHasRsqrt = true;
+
+        __m256 v;
+
+        static F32x8 Load(const real32_t* p) { return {_mm256_loadu_ps(p)}; }
+        static F32x8 Broadcast(real32_t x) { return {_mm256_set1_ps(x)}; }
+        void Store(real32_t* p) const { _mm256_storeu_ps(p, v); }
+
+        static F32x8 FromInt32(const int32_t* p) { return {_mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)))}; }
+        void StoreInt32(int32_t* p) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvtps_epi32(v)); }
+
+        static F32x8 FromInt16Low(const uint32_t* p)
+        {
+            const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            return {_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(w, 16), 16))};
+        }
+        static F32x8 FromInt16High(const uint32_t* p)
+        {
+            return {_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), 16))};
+        }
+    };
+
+    inline F32x8 operator+(F32x8 a, F32x8 b) { return {_mm256_add_ps(a.v, b.v)}; }
+    inline F32x8 operator-(F32x8 a, F32x8 b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    inline F32x8 operator*(F32x8 a, F32x8 b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    inline F32x8 operator/(F32x8 a, F32x8 b) { return {_mm256_div_ps(a.v, b.v)}; }
+    inline F32x8 Sqrt(F32x8 a) { return {_mm256_sqrt_ps(a.v)}; }
+    inline F32x8 RsqrtApprox(F32x8 a) { return {_mm256_rsqrt_ps(a.v)}; }
+    inline F32x8 NotEqualZero(F32x8 a) { return {_mm256_cmp_ps(a.v, _mm256_setzero_ps(), _CMP_NEQ_UQ)}; }
+    inline F32x8 Select(F32x8 m, F32x8 a, F32x8 b) { return {_mm256_blendv_ps(b.v, a.v, m.v)}; }
+    inline F32x8 Min(F32x8 a, F32x8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+    inline F32x8 Max(F32x8 a, F32x8 b) { return {_mm256_max_ps(a.v, b.v)}; }
+    inline F32x8 LessThan(F32x8 a, F32x8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+    inline F32x8 Abs(F32x8 a) { return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v)}; }
+    inline F32x8 CopySign(F32x8 magnitude, F32x8 sign)
+    {
+        const __m256 signBit = _mm256_set1_ps(-0.0f);
+        return {_mm256_or_ps(_mm256_andnot_ps(signBit, magnitude.v), _mm256_and_ps(signBit, sign.v))};
+    }
+
+    //--------------------------------------------------------------------------
+    struct F64x4
+    {
+        using value_type = real64_t;
+        using mask_type = F64x4;
+        static constexpr size_t kLanes = 4;
+        static constexpr bool kHasRsqrt = false;
+
+        __m256d v;
+
+        static F64x4 Load(const real64_t* p) { return {_mm256_loadu_pd(p)}; }
+        static F64x4 Broadcast(real64_t x) { return {_mm256_set1_pd(x)}; }
+        void Store(real64_t* p) const { _mm256_storeu_pd(p, v); }
+    };
+
+    inline F64x4 operator+(F64x4 a, F64x4 b) { return {_mm256_add_pd(a.v, b.v)}; }
+    inline F64x4 operator-(F64x4 a, F64x4 b) { return {_mm256_sub_pd(a.v, b.v)}; }
+    inline F64x4 operator*(F64x4 a, F64x4 b) { return {_mm256_mul_pd(a.v, b.v)}; }
+    inline F64x4 operator/(F64x4 a, F64x4 b) { return {_mm256_div_pd(a.v, b.v)}; }
+    inline F64x4 Sqrt(F64x4 a) { return {_mm256_sqrt_pd(a.v)}; }
+    inline F64x4 NotEqualZero(F64x4 a) { return {_mm256_cmp_pd(a.v, _mm256_setzero_pd(), _CMP_NEQ_UQ)}; }
+    inline F64x4 Select(F64x4 m, F64x4 a, F64x4 b) { return {_mm256_blendv_pd(b.v, a.v, m.v)}; }
+    inline F64x4 Min(F64x4 a, F64x4 b) { return {_mm256_min_pd(a.v, b.v)}; }
+    inline F64x4 Max(F64x4 a, F64x4 b) { return {_mm256_max_pd(a.v, b.v)}; }
+#endif // GE_KERNEL_HAS_AVX2
+
+#ifdef GE_KERNEL_HAS_AVX512
+    //--------------------------------------------------------------------------
+    struct F32x16
+    {
+        using value_type = real32_t;
+        using mask_type = __mmask16;
+        static constexpr size_t kLanes = 16;
+        static constexpr bool kHasRsqrt = true;
+
+        __m512 v;
+
+        static F32x16 Load(const real32_t* p) { return {_mm512_loadu_ps(p)}; }
+        static F32x16 Broadcast(real32_t x) { return {_mm512_set1_ps(x)}; }
+        void Store(real32_t* p) const { _mm512_storeu_ps(p, v); }
+
+        static F32x16 FromInt32(const int32_t* p) { return {_mm512_cvtepi32_ps(_mm512_loadu_si512(p))}; }
+        void StoreInt32(int32_t* p) const { _mm512_storeu_si512(p, _mm512_cvtps_epi32(v)); }
+
+        static F32x16 FromInt16Low(const uint32_t* p)
+        {
+            const __m512i w = _mm512_loadu_si512(p);
+            return {_mm512_cvtepi32_ps(_mm512_srai_epi32(_mm512_slli_epi32(w, 16), 16))};
+        }
+        static F32x16 FromInt16High(const uint32_t* p)
+        {
+            return {_mm512_cvtepi32_ps(_mm512_srai_epi32(_mm512_loadu_si512(p), 16))};
+        }
+    };
+
+    inline F32x16 operator+(F32x16 a, F32x16 b) { return {_mm512_add_ps(a.v, b.v)}; }
+    inline F32x16 operator-(F32x16 a, F32x16 b) { return {_mm512_sub_ps(a.v, b.v)}; }
+    inline F32x16 operator*(F32x16 a, F32x16 b) { return {_mm512_mul_ps(a.v, b.v)}; }
+    inline F32x16 operator/(F32x16 a, F32x16 b) { return {_mm512_div_ps(a.v, b.v)}; }
+    inline F32x16 Sqrt(F32x16 a) { return {_mm512_sqrt_ps(a.v)}; }
+    inline F32x16 RsqrtApprox(F32x16 a) { return {_mm512_rsqrt14_ps(a.v)}; }
+    inline __mmask16 NotEqualZero(F32x16 a) { return _mm512_cmp_ps_mask(a.v, _mm512_setzero_ps(), _CMP_NEQ_UQ); }
+    inline F32x16 Select(__mmask16 m, F32x16 a, F32x16 b) { return {_mm512_mask_blend_ps(m, b.v, a.v)}; }
+    inline F32x16 Min(F32x16 a, F32x16 b) { return {_mm512_min_ps(a.v, b.v)}; }
+    inline F32x16 Max(F32x16 a, F32x16 b) { return {_mm512_max_ps(a.v, b.v)}; }
+    inline __mmask16 LessThan(F32x16 a, F32x16 b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ); }
+    inline F32x16 Abs(F32x16 a) { return {_mm512_abs_ps(a.v)}; }
+    // AVX512F has no float bitwise ops (those are DQ); 0xb8 is "b ? c : a" per bit
+    inline F32x16 CopySign(F32x16 magnitude, F32x16 sign)
+    {
+        const __m512i signBit = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        return {_mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(magnitude.v), signBit, _mm512_castps_si512(sign.v), 0xb8))};
+    }
+
+    //--------------------------------------------------------------------------
+    struct F64x8
+    {
+        using value_type = real64_t;
+        using mask_type = __mmask8;
+        static constexpr size_t kLanes = 8;
+        static constexpr bool kHasRsqrt = false;
+
+        __m512d v;
+
+        static F64x8 Load(const real64_t* p) { return {_mm512_loadu_pd(p)}; }
+        static F64x8 Broadcast(real64_t x) { return {_mm512_set1_pd(x)}; }
+        void Store(real64_t* p) const { _mm512_storeu_pd(p, v); }
+    };
+
+    inline F64x8 operator+(F64x8 a, F64x8 b) { return {_mm512_add_pd(a.v, b.v)}; }
+    inline F64x8 operator-(F64x8 a, F64x8 b) { return {_mm512_sub_pd(a.v, b.v)}; }
+    inline F64x8 operator*(F64x8 a, F64x8 b) { return {_mm512_mul_pd(a.v, b.v)}; }
+    inline F64x8 operator/(F64x8 a, F64x8 b) { return {_mm512_div_pd(a.v, b.v)}; }
+    inline F64x8 Sqrt(F64x8 a) { return {_mm512_sqrt_pd(a.v)}; }
+    inline __mmask8 NotEqualZero(F64x8 a) { return _mm512_cmp_pd_mask(a.v, _mm512_setzero_pd(), _CMP_NEQ_UQ); }
+    inline F64x8 Select(__mmask8 m, F64x8 a, F64x8 b) { return {_mm512_mask_blend_pd(m, b.v, a.v)}; }
+    inline F64x8 Min(F64x8 a, F64x8 b) { return {_mm512_min_pd(a.v, b.v)}; }
+    inline F64x8 Max(F64x8 a, F64x8 b) { return {_mm512_max_pd(a.v, b.v)}; }
+#endif // GE_KERNEL_HAS_AVX512
+
+} // end of simd
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_SIMD_H
@@ -0,0 +1,131 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gesort.h"
+#include "impl/geradixsort.h"
+
+#include <limits>
+
+namespace
+{
+    using ge::details::radix::IndexedKey;
+
+    template <typename T>
+    void SortValues(GeSpan<T> values, const GeSortOptions& options)
+    {
+        ge::details::radix::Sort(values.data(), values.size(), [](T x) { return GeRealToSortableKey(x); },
+                                 options.parallel, options.grainSize, options.pArena);
+    }
+
+    // Stable sort of records by key
+    template <typename Key>
+    void SortIndexedKeys(GeArenaVector<IndexedKey<Key>>& records, GeArenaVector<IndexedKey<Key>>& scratch,
+                         const GeSortOptions& options)
+    {
+        ge::details::radix::Sort(records.data(), scratch.data(), records.size(),
+                                 [](const IndexedKey<Key>& r) { return r.key; }, options.parallel, options.grainSize,
+                                 options.pArena);
+    }
+
+    template <typename T>
+    void SortOrder(GeSpan<const T> values, GeSpan<GeUint32> order, const GeSortOptions& options)
+    {
+        assert(values.size() == order.size());
+        assert(values.size() <= std::numeric_limits<GeUint32>::max());
+
+        using Key = GeSortableKey<T>;
+        const GeArenaAllocator<IndexedKey<Key>> allocator(options.pArena);
+        GeArenaVector<IndexedKey<Key>> records(values.size(), allocator);
+        GeArenaVector<IndexedKey<Key>> scratch(values.size(), allocator);
+        for (GeSize i = 0; i < values.size(); ++i)
+            records[i] = IndexedKey<Key>{GeRealToSortableKey(values[i]), static_cast<GeUint32>(i)};
+
+        SortIndexedKeys(records, scratch, options);
+        for (GeSize k = 0; k < records.size(); ++k)
+            order[k] = records[k].index;
+    }
+
+    // Least significant lane first; each stable pass keeps the order of the
+    // previous ones among equal keys
+    template <typename T>
+    void Vector3SortOrder(GeVector3ArrayCView<T> a, GeSpan<GeUint32> order, const GeSortOptions& options)
+    {
+        assert(a.size == order.size());
+        assert(a.size <= std::numeric_limits<GeUint32>::max());
+
+        using Key = GeSortableKey<T>;
+        const GeArenaAllocator<IndexedKey<Key>> allocator(options.pArena);
+        GeArenaVector<IndexedKey<Key>> records(a.size, allocator);
+        GeArenaVector<IndexedKey<Key>> scratch(a.size, allocator);
+        for (GeSize i = 0; i < a.size; ++i)
+            records[i] = IndexedKey<Key>{GeRealToSortableKey(a.z[i]), static_cast<GeUint32>(i)};
+        SortIndexedKeys(records, scratch, options);
+
+        for (const T* lane : {a.y, a.x})
+        {
+            for (IndexedKey<Key>& record : records)
+                record.key = GeRealToSortableKey(lane[record.index]);
+            SortIndexedKeys(records, scratch, options);
+        }
+
+        for (GeSize k = 0; k < records.size(); ++k)
+            order[k] = records[k].index;
+    }
+} // end of anonymous
+
+template <>
+void GeRadixSort<GeReal32>(GeSpan<GeReal32> values, const GeSortOptions& options)
+{
+    SortValues(values, options);
+}
+
+template <>
+void GeRadixSort<GeReal64>(GeSpan<GeReal64> values, const GeSortOptions& options)
+{
+    SortValues(values, options);
+}
+
+template <>
+void GeRadixSortOrder<GeReal32>(GeSpan<const GeReal32> values, GeSpan<GeUint32> order, const GeSortOptions& options)
+{
+    SortOrder(values, order, options);
+}
+
+template <>
+void GeRadixSortOrder<GeReal64>(GeSpan<const GeReal64> values, GeSpan<GeUint32> order, const GeSortOptions& options)
+{
+    SortOrder(values, order, options);
+}
+
+template <>
+void GeVector3BatchSortOrder<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeSpan<GeUint32> order, const GeSortOptions& options)
+{
+    Vector3SortOrder(a, order, options);
+}
+
+template <>
+void GeVector3BatchSortOrder<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeSpan<GeUint32> order, const GeSortOptions& options)
+{
+    Vector3SortOrder(a, order, options);
+}
@@ -0,0 +1,219 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gestats.h"
+
+namespace
+{
+    const char* const kCounterNames[] = {
+        "real_equal",
+        "real_less",
+        "real_compare",
+        "real_ulp_any_below",
+        "real_ulp_min_below",
+        "real_relative",
+        "orient2d",
+        "orient2d_exact",
+        "orient3d",
+        "orient3d_exact",
+        "incircle",
+        "incircle_exact",
+        "insphere",
+        "insphere_exact"
+    };
+
+    const char* const kPrimitiveNames[] = {
+        "batch_ulp_compare",
+        "batch_real_filter",
+        "batch_dot",
+        "batch_cross",
+        "batch_magnitude",
+        "batch_normalize",
+        "batch_reduce",
+        "batch_transform",
+        "batch_quantize",
+        "batch_dequantize",
+        "batch_half",
+        "batch_octahedral",
+        "radix_sort",
+        "curve_keys",
+        "weld",
+        "bvh_build",
+        "bvh_query"
+    };
+
+    static_assert(sizeof(kCounterNames) / sizeof(kCounterNames[0]) == GeStatsSnapshot::kCounterCount,
+                  "a counter has no name");
+    static_assert(sizeof(kPrimitiveNames) / sizeof(kPrimitiveNames[0]) == GeStatsSnapshot::kPrimitiveCount,
+                  "a primitive has no name");
+
+#ifdef GE_ENABLE_STATS
+    using ge::details::stats::ThreadBlock;
+
+    // Published blocks, never freed; a block is reused once its thread exits
+    std::atomic<ThreadBlock*> s_pBlocks{nullptr};
+
+    // Counts of exited threads, only the counters are used
+    ThreadBlock s_retired;
+
+    // Applies f(total, slot) to every counter of a block
+    template <typename F>
+    void ForEachSlot(ThreadBlock& total, ThreadBlock& block, F f)
+    {
+        for (GeSize i = 0; i < GeStatsSnapshot::kCounterCount; ++i)
+            f(total.counters[i], block.counters[i]);
+        for (GeSize i = 0; i < GeStatsSnapshot::kPrimitiveCount; ++i) {
+            f(total.calls[i], block.calls[i]);
+            f(total.elements[i], block.elements[i]);
+            f(total.cycles[i], block.cycles[i]);
+        }
+    }
+
+    void Zero(ThreadBlock& block)
+    {
+        ForEachSlot(block, block, [](std::atomic<GeUint64>& slot, std::atomic<GeUint64>&) {
+            slot.store(0, std::memory_order_relaxed);
+        });
+    }
+
+    ThreadBlock* ClaimBlock()
+    {
+        for (ThreadBlock* pBlock = s_pBlocks.load(std::memory_order_acquire); pBlock; pBlock = pBlock->pNext) {
+            bool expected = false;
+            if (!pBlock->inUse.load(std::memory_order_relaxed)
+                && pBlock->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return pBlock;
+        }
+
+        ThreadBlock* pBlock = new ThreadBlock();
+        pBlock->inUse.store(true, std::memory_order_relaxed);
+        pBlock->pNext = s_pBlocks.load(std::memory_order_relaxed);
+        while (!s_pBlocks.compare_exchange_weak(pBlock->pNext, pBlock, std::memory_order_release,
+                                                std::memory_order_relaxed))
+            ;
+        return pBlock;
+    }
+
+    void RetireBlock(ThreadBlock& block)
+    {
+        ForEachSlot(s_retired, block, [](std::atomic<GeUint64>& total, std::atomic<GeUint64>& slot) {
+            total.fetch_add(slot.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        });
+        Zero(block);
+        block.inUse.store(false, std::memory_order_release);
+    }
+
+    // Hands the block back when its thread exits. Counts recorded from
+    // thread_local destructors that run after this one are lost.
+    struct BlockReleaser
+    {
+        ThreadBlock* pBlock;
+
+        ~BlockReleaser()
+        {
+            RetireBlock(*pBlock);
+        }
+    };
+#endif // GE_ENABLE_STATS
+} // end of anonymous
+
+#ifdef GE_ENABLE_STATS
+ge::details::stats::ThreadBlock* ge::details::stats::AcquireThreadBlock()
+{
+    thread_local const BlockReleaser s_releaser{ClaimBlock()};
+    return s_releaser.pBlock;
+}
+#endif
+
+GeStatsSnapshot GeGetStatsSnapshot()
+{
+    GeStatsSnapshot snapshot;
+#ifdef GE_ENABLE_STATS
+    const auto add = [&snapshot](ThreadBlock& block) {
+        for (GeSize i = 0; i < GeStatsSnapshot::kCounterCount; ++i)
+            snapshot.counters[i] += block.counters[i].load(std::memory_order_relaxed);
+        for (GeSize i = 0; i < GeStatsSnapshot::kPrimitiveCount; ++i) {
+            snapshot.primitives[i].calls += block.calls[i].load(std::memory_order_relaxed);
+            snapshot.primitives[i].elements += block.elements[i].load(std::memory_order_relaxed);
+            snapshot.primitives[i].cycles += block.cycles[i].load(std::memory_order_relaxed);
+        }
+    };
+
+    add(s_retired);
+    for (ThreadBlock* pBlock = s_pBlocks.load(std::memory_order_acquire); pBlock; pBlock = pBlock->pNext) {
+        add(*pBlock);
+        snapshot.threads += pBlock->inUse.load(std::memory_order_relaxed) ? 1 : 0;
+    }
+#endif
+    return snapshot;
+}
+
+void GeResetStats()
+{
+#ifdef GE_ENABLE_STATS
+    Zero(s_retired);
+    for (ThreadBlock* pBlock = s_pBlocks.load(std::memory_order_acquire); pBlock; pBlock = pBlock->pNext)
+        Zero(*pBlock);
+#endif
+}
+
+const char* GeStatCounterName(GeStatCounter counter)
+{
+    const GeSize index = static_cast<GeSize>(counter);
+    return index < GeStatsSnapshot::kCounterCount ? kCounterNames[index] : "unknown";
+}
+
+const char* GeStatPrimitiveName(GeStatPrimitive primitive)
+{
+    const GeSize index = static_cast<GeSize>(primitive);
+    return index < GeStatsSnapshot::kPrimitiveCount ? kPrimitiveNames[index] : "unknown";
+}
+
+std::string GeStatsToJson(const GeStatsSnapshot& snapshot)
+{
+    std::string json = "{\"enabled\": ";
+    json += GeStatsEnabled() ? "true" : "false";
+    json += ", \"timers\": ";
+    json += GeStatsTimersEnabled() ? "true" : "false";
+    json += ", \"threads\": " + std::to_string(snapshot.threads);
+
+    json += ", \"counters\": {";
+    for (GeSize i = 0; i < GeStatsSnapshot::kCounterCount; ++i) {
+        json += i ? ", \"" : "\"";
+        json += kCounterNames[i];
+        json += "\": " + std::to_string(snapshot.counters[i]);
+    }
+
+    json += "}, \"primitives\": {";
+    for (GeSize i = 0; i < GeStatsSnapshot::kPrimitiveCount; ++i) {
+        const GeStatTiming& timing = snapshot.primitives[i];
+        json += i ? ", \"" : "\"";
+        json += kPrimitiveNames[i];
+        json += "\": {\"calls\": " + std::to_string(timing.calls)
+              + ", \"elements\": " + std::to_string(timing.elements)
+              + ", \"cycles\": " + std::to_string(timing.cycles) + "}";
+    }
+    json += "}}";
+    return json;
+}
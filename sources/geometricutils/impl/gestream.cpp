@@ -0,0 +1,325 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gestream.h"
+#include "impl/gepointfileformat.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#   include <sys/types.h>
+#endif
+
+namespace
+{
+    using namespace ge::details::pointfile;
+
+    bool Seek(std::FILE* pFile, GeUint64 offset, int origin)
+    {
+#ifdef _WIN32
+        return _fseeki64(pFile, static_cast<__int64>(offset), origin) == 0;
+#else
+        return fseeko(pFile, static_cast<off_t>(offset), origin) == 0;
+#endif
+    }
+
+    bool FileSize(std::FILE* pFile, GeUint64& size)
+    {
+        if (!Seek(pFile, 0, SEEK_END))
+            return false;
+#ifdef _WIN32
+        const __int64 end = _ftelli64(pFile);
+#else
+        const off_t end = ftello(pFile);
+#endif
+        if (end < 0)
+            return false;
+        size = static_cast<GeUint64>(end);
+        return true;
+    }
+} // end of anonymous
+
+//==============================================================================
+// Pipeline
+
+namespace ge
+{
+namespace details
+{
+    void RunStreamPipeline(GeSize slotCount,
+                           const std::function<GeSize(GeSize slot)>& produce,
+                           const std::function<void(GeSize slot, GeSize count)>& consume)
+    {
+        if (slotCount <= 1)
+        {
+            for (GeSize count = produce(0); count > 0; count = produce(0))
+                consume(0, count);
+            return;
+        }
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<GeSize> freeSlots;
+        std::deque<std::pair<GeSize, GeSize>> readySlots;     // slot, count
+        bool finished = false;          // producer has returned
+        bool stopped = false;           // consumer has given up
+        std::exception_ptr producerError;
+
+        for (GeSize slot = 0; slot < slotCount; ++slot)
+            freeSlots.push_back(slot);
+
+        std::thread producer([&]() {
+            for (;;)
+            {
+                GeSize slot;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return stopped || !freeSlots.empty(); });
+                    if (stopped)
+                        return;
+                    slot = freeSlots.front();
+                    freeSlots.pop_front();
+                }
+
+                GeSize count = 0;
+                std::exception_ptr error;
+                try
+                {
+                    count = produce(slot);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (count > 0)
+                        readySlots.emplace_back(slot, count);
+                    else
+                        finished = true;
+                    producerError = error;
+                }
+                changed.notify_all();
+                if (count == 0)
+                    return;
+            }
+        });
+
+        try
+        {
+            for (;;)
+            {
+                std::pair<GeSize, GeSize> item;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return finished || !readySlots.empty(); });
+                    if (readySlots.empty())
+                        break;
+                    item = readySlots.front();
+                    readySlots.pop_front();
+                }
+
+                consume(item.first, item.second);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    freeSlots.push_back(item.first);
+                }
+                changed.notify_all();
+            }
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopped = true;
+            }
+            changed.notify_all();
+            producer.join();
+            throw;
+        }
+
+        producer.join();
+        if (producerError)
+            std::rethrow_exception(producerError);
+    }
+} // end of details
+} // end of ge
+
+//==============================================================================
+// GePointFileReader
+
+GePointFileReader::~GePointFileReader()
+{
+    Close();
+}
+
+GePointFileReader::GePointFileReader(GePointFileReader&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+GePointFileReader& GePointFileReader::operator=(GePointFileReader&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_pFile = other.m_pFile;
+        m_scratch = std::move(other.m_scratch);
+        m_count = other.m_count;
+        m_position = other.m_position;
+        m_payloadOffset = other.m_payloadOffset;
+        m_laneStride = other.m_laneStride;
+        m_layout = other.m_layout;
+        m_order = other.m_order;
+        m_scalarSize = other.m_scalarSize;
+        m_failed = other.m_failed;
+        other.m_pFile = nullptr;
+        other.Close();
+    }
+    return *this;
+}
+
+bool GePointFileReader::Open(const char* path)
+{
+    Close();
+
+    std::FILE* pFile = std::fopen(path, "rb");
+    if (pFile == nullptr)
+        return false;
+
+    GeUint64 size = 0;
+    GeByte encoded[kHeaderSize];
+    Header header;
+    if (!FileSize(pFile, size) || size < kHeaderSize || !Seek(pFile, 0, SEEK_SET) ||
+        std::fread(encoded, 1, kHeaderSize, pFile) != kHeaderSize || !DecodeHeader(encoded, size, header))
+    {
+        std::fclose(pFile);
+        return false;
+    }
+
+    m_pFile = pFile;
+    m_count = static_cast<GeSize>(header.count);
+    m_payloadOffset = header.payloadOffset;
+    m_laneStride = header.laneStride;
+    m_layout = header.layout;
+    m_order = header.order;
+    m_scalarSize = header.scalarSize;
+    return true;
+}
+
+void GePointFileReader::Close()
+{
+    if (m_pFile != nullptr)
+        std::fclose(m_pFile);
+
+    m_pFile = nullptr;
+    m_scratch.clear();
+    m_count = 0;
+    m_position = 0;
+    m_payloadOffset = 0;
+    m_laneStride = 0;
+    m_layout = GePointLayout::kAos;
+    m_order = GeByteOrder::kLittle;
+    m_scalarSize = 0;
+    m_failed = false;
+}
+
+GeSize GePointFileReader::Read(GeVector3ArrayView<GeReal32> out)
+{
+    return ReadChunk(out);
+}
+
+GeSize GePointFileReader::Read(GeVector3ArrayView<GeReal64> out)
+{
+    return ReadChunk(out);
+}
+
+template <typename T>
+GeSize GePointFileReader::ReadChunk(GeVector3ArrayView<T> out)
+{
+    if (!IsOpen() || m_failed)
+        return 0;
+    if (m_scalarSize != sizeof(T))
+    {
+        m_failed = true;
+        return 0;
+    }
+
+    const GeSize n = std::min(out.size, m_count - m_position);
+    if (n == 0)
+        return 0;
+
+    T* lanes[3] = {out.x, out.y, out.z};
+    const bool swap = m_order != GeNativeByteOrder();
+    if (m_layout == GePointLayout::kSoa)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const GeUint64 offset = m_payloadOffset + axis * m_laneStride + GeUint64(m_position) * sizeof(T);
+            if (!ReadAt(offset, lanes[axis], n * sizeof(T)))
+                return 0;
+            if (swap)
+                SwapWords<T>(lanes[axis], lanes[axis], n);
+        }
+    }
+    else
+    {
+        // the scratch buffer grows to the largest chunk asked for and stays there
+        m_scratch.resize(3 * n * sizeof(T));
+        const GeUint64 offset = m_payloadOffset + 3 * GeUint64(m_position) * sizeof(T);
+        if (!ReadAt(offset, m_scratch.data(), m_scratch.size()))
+            return 0;
+        if (swap)
+            SwapWords<T>(m_scratch.data(), m_scratch.data(), 3 * n);
+
+        const T* points = reinterpret_cast<const T*>(m_scratch.data());
+        for (GeSize i = 0; i < n; ++i)
+        {
+            lanes[0][i] = points[3 * i + 0];
+            lanes[1][i] = points[3 * i + 1];
+            lanes[2][i] = points[3 * i + 2];
+        }
+    }
+
+    m_position += n;
+    return n;
+}
+
+bool GePointFileReader::ReadAt(GeUint64 offset, void* pData, GeSize size)
+{
+    // the header promised these bytes; a short read means the file changed
+    if (!Seek(m_pFile, offset, SEEK_SET) || std::fread(pData, 1, size, m_pFile) != size)
+    {
+        m_failed = true;
+        return false;
+    }
+    return true;
+}
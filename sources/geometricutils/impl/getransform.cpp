@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "getransform.h"
+#include "geparallel.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+
+namespace
+{
+    template <typename T>
+    const ge::details::dispatch::Vector3KernelTable<T>& Kernels();
+
+    template <>
+    const ge::details::dispatch::Vector3KernelTable<GeReal32>& Kernels<GeReal32>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3f;
+    }
+
+    template <>
+    const ge::details::dispatch::Vector3KernelTable<GeReal64>& Kernels<GeReal64>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3d;
+    }
+
+    // Elements are independent, so the chunking does not affect the results
+    template <typename T>
+    void Transform(typename ge::details::dispatch::Vector3KernelTable<T>::TransformFn fn, GeVector3ArrayCView<T> in,
+                   const T* m, GeVector3ArrayView<T> out, const GeTransformOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchTransform, in.size);
+        assert(in.size == out.size);
+        auto chunk = [&](GeSize begin, GeSize end) {
+            fn(in.x + begin, in.y + begin, in.z + begin, m, out.x + begin, out.y + begin, out.z + begin, end - begin);
+        };
+        if (options.parallel)
+            GeParallelFor(0, in.size, options.grainSize, chunk);
+        else
+            chunk(0, in.size);
+    }
+} // end of anonymous
+
+//==============================================================================
+// Points
+
+template <>
+void GeVector3BatchTransformPoints<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix4<GeReal32>& m,
+                                             GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options)
+{
+    Transform<GeReal32>(Kernels<GeReal32>().affine, in, &m.m[0][0], out, options);
+}
+
+template <>
+void GeVector3BatchTransformPoints<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix4<GeReal64>& m,
+                                             GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options)
+{
+    Transform<GeReal64>(Kernels<GeReal64>().affine, in, &m.m[0][0], out, options);
+}
+
+template <>
+void GeVector3BatchProjectPoints<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix4<GeReal32>& m,
+                                           GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options)
+{
+    Transform<GeReal32>(Kernels<GeReal32>().projective, in, &m.m[0][0], out, options);
+}
+
+template <>
+void GeVector3BatchProjectPoints<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix4<GeReal64>& m,
+                                           GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options)
+{
+    Transform<GeReal64>(Kernels<GeReal64>().projective, in, &m.m[0][0], out, options);
+}
+
+//==============================================================================
+// Directions
+
+template <>
+void GeVector3BatchTransformDirections<GeReal32>(GeVector3ArrayCView<GeReal32> in, const GeMatrix3<GeReal32>& m,
+                                                 GeVector3ArrayView<GeReal32> out, const GeTransformOptions& options)
+{
+    Transform<GeReal32>(Kernels<GeReal32>().linear, in, &m.m[0][0], out, options);
+}
+
+template <>
+void GeVector3BatchTransformDirections<GeReal64>(GeVector3ArrayCView<GeReal64> in, const GeMatrix3<GeReal64>& m,
+                                                 GeVector3ArrayView<GeReal64> out, const GeTransformOptions& options)
+{
+    Transform<GeReal64>(Kernels<GeReal64>().linear, in, &m.m[0][0], out, options);
+}
@@ -0,0 +1,260 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_ULPKERNELS_H
+#define GEOMUTILS_IMPL_ULPKERNELS_H
+
+// Branchless ULP comparison kernels. Each kernel compares kLanes float pairs
+// and returns one result bit per lane, reproducing GeIsRealEqualByUlps and
+// GeIsRealLessByUlps exactly:
+//   equal = sameSign ? |ia - ib| <= tol : a == b
+//   less  = !equal && (sameSign ? ib - ia > 0 : a is negative)
+
+#include "impl/gesimd.h"
+
+#include <cstring>
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace ulpkernels
+{
+    //--------------------------------------------------------------------------
+    struct UlpScalar
+    {
+        static constexpr size_t kLanes = 1;
+
+        static int32_t Bits(real32_t x)
+        {
+            int32_t i;
+            std::memcpy(&i, &x, sizeof(i));
+            return i;
+        }
+
+        static uint32_t EqualMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const int32_t ia = Bits(*a);
+            const int32_t ib = Bits(*b);
+            const bool sameSign = (ia ^ ib) >= 0;
+            const int32_t diff = static_cast<int32_t>(static_cast<uint32_t>(ia) - static_cast<uint32_t>(ib));
+            const int32_t s = diff >> 31;
+            const int32_t absDiff = (diff ^ s) - s;
+            return sameSign ? (absDiff <= tol) : (*a == *b);
+        }
+
+        static uint32_t LessMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const int32_t ia = Bits(*a);
+            const int32_t ib = Bits(*b);
+            const bool sameSign = (ia ^ ib) >= 0;
+            const int32_t diff = static_cast<int32_t>(static_cast<uint32_t>(ib) - static_cast<uint32_t>(ia));
+            const bool raw = sameSign ? (diff > 0) : (ia < 0);
+            return raw & !EqualMask(a, b, tol);
+        }
+    };
+
+#ifdef GE_KERNEL_HAS_SSE2
+    //--------------------------------------------------------------------------
+    struct UlpSse2
+    {
+        static constexpr size_t kLanes = 4;
+
+        static __m128i EqualLanes(__m128 fa, __m128 fb, __m128i ia, __m128i ib, __m128i tol)
+        {
+            const __m128i sameSign = _mm_cmpeq_epi32(_mm_srai_epi32(ia, 31), _mm_srai_epi32(ib, 31));
+            const __m128i diff = _mm_sub_epi32(ia, ib);
+            const __m128i s = _mm_srai_epi32(diff, 31);
+            const __m128i absDiff = _mm_sub_epi32(_mm_xor_si128(diff, s), s);
+            const __m128i eqSame = _mm_andnot_si128(_mm_cmpgt_epi32(absDiff, tol), sameSign);
+            const __m128i eqDiff = _mm_andnot_si128(sameSign, _mm_castps_si128(_mm_cmpeq_ps(fa, fb)));
+            return _mm_or_si128(eqSame, eqDiff);
+        }
+
+        static uint32_t EqualMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m128 fa = _mm_loadu_ps(a);
+            const __m128 fb = _mm_loadu_ps(b);
+            const __m128i eq = EqualLanes(fa, fb, _mm_castps_si128(fa), _mm_castps_si128(fb), _mm_set1_epi32(tol));
+            return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+        }
+
+        static uint32_t LessMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m128 fa = _mm_loadu_ps(a);
+            const __m128 fb = _mm_loadu_ps(b);
+            const __m128i ia = _mm_castps_si128(fa);
+            const __m128i ib = _mm_castps_si128(fb);
+            const __m128i signA = _mm_srai_epi32(ia, 31);
+            const __m128i sameSign = _mm_cmpeq_epi32(signA, _mm_srai_epi32(ib, 31));
+            const __m128i lessSame = _mm_and_si128(sameSign, _mm_cmpgt_epi32(_mm_sub_epi32(ib, ia), _mm_setzero_si128()));
+            const __m128i lessDiff = _mm_andnot_si128(sameSign, signA);
+            const __m128i eq = EqualLanes(fa, fb, ia, ib, _mm_set1_epi32(tol));
+            const __m128i less = _mm_andnot_si128(eq, _mm_or_si128(lessSame, lessDiff));
+            return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(less)));
+        }
+    };
+#endif // GE_KERNEL_HAS_SSE2
+
+#ifdef GE_KERNEL_HAS_AVX2
+    //--------------------------------------------------------------------------
+    struct UlpAvx2
+    {
+        static constexpr size_t kLanes = 8;
+
+        static __m256i EqualLanes(__m256 fa, __m256 fb, __m256i ia, __m256i ib, __m256i tol)
+        {
+            const __m256i sameSign = _mm256_cmpeq_epi32(_mm256_srai_epi32(ia, 31), _mm256_srai_epi32(ib, 31));
+            const __m256i absDiff = _mm256_abs_epi32(_mm256_sub_epi32(ia, ib));
+            const __m256i eqSame = _mm256_andnot_si256(_mm256_cmpgt_epi32(absDiff, tol), sameSign);
+            const __m256i eqDiff = _mm256_andnot_si256(sameSign, _mm256_castps_si256(_mm256_cmp_ps(fa, fb, _CMP_EQ_OQ)));
+            return _mm256_or_si256(eqSame, eqDiff);
+        }
+
+        static uint32_t EqualMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m256 fa = _mm256_loadu_ps(a);
+            const __m256 fb = _mm256_loadu_ps(b);
+            const __m256i eq = EqualLanes(fa, fb, _mm256_castps_si256(fa), _mm256_castps_si256(fb), _mm256_set1_epi32(tol));
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        }
+
+        static uint32_t LessMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m256 fa = _mm256_loadu_ps(a);
+            const __m256 fb = _mm256_loadu_ps(b);
+            const __m256i ia = _mm256_castps_si256(fa);
+            const __m256i ib = _mm256_castps_si256(fb);
+            const __m256i signA = _mm256_srai_epi32(ia, 31);
+            const __m256i sameSign = _mm256_cmpeq_epi32(signA, _mm256_srai_epi32(ib, 31));
+            const __m256i lessSame = _mm256_and_si256(sameSign, _mm256_cmpgt_epi32(_mm256_sub_epi32(ib, ia), _mm256_setzero_si256()));
+            const __m256i lessDiff = _mm256_andnot_si256(sameSign, signA);
+            const __m256i eq = EqualLanes(fa, fb, ia, ib, _mm256_set1_epi32(tol));
+            const __m256i less = _mm256_andnot_si256(eq, _mm256_or_si256(lessSame, lessDiff));
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(less)));
+        }
+    };
+#endif // GE_KERNEL_HAS_AVX2
+
+#ifdef GE_KERNEL_HAS_AVX512
+    //--------------------------------------------------------------------------
+    struct UlpAvx512
+    {
+        static constexpr size_t kLanes = 16;
+
+        static __mmask16 EqualLanes(__m512 fa, __m512 fb, __m512i ia, __m512i ib, __m512i tol)
+        {
+            const __mmask16 diffSign = _mm512_cmplt_epi32_mask(_mm512_xor_si512(ia, ib), _mm512_setzero_si512());
+            const __mmask16 eqSame = _mm512_cmple_epi32_mask(_mm512_abs_epi32(_mm512_sub_epi32(ia, ib)), tol);
+            const __mmask16 eqDiff = _mm512_cmp_ps_mask(fa, fb, _CMP_EQ_OQ);
+            return static_cast<__mmask16>((~diffSign & eqSame) | (diffSign & eqDiff));
+        }
+
+        static uint32_t EqualMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m512 fa = _mm512_loadu_ps(a);
+            const __m512 fb = _mm512_loadu_ps(b);
+            return EqualLanes(fa, fb, _mm512_castps_si512(fa), _mm512_castps_si512(fb), _mm512_set1_epi32(tol));
+        }
+
+        static uint32_t LessMask(const real32_t* a, const real32_t* b, int32_t tol)
+        {
+            const __m512 fa = _mm512_loadu_ps(a);
+            const __m512 fb = _mm512_loadu_ps(b);
+            const __m512i ia = _mm512_castps_si512(fa);
+            const __m512i ib = _mm512_castps_si512(fb);
+            const __m512i zero = _mm512_setzero_si512();
+            const __mmask16 diffSign = _mm512_cmplt_epi32_mask(_mm512_xor_si512(ia, ib), zero);
+            const __mmask16 lessSame = _mm512_cmpgt_epi32_mask(_mm512_sub_epi32(ib, ia), zero);
+            const __mmask16 negA = _mm512_cmplt_epi32_mask(ia, zero);
+            const __mmask16 eq = EqualLanes(fa, fb, ia, ib, _mm512_set1_epi32(tol));
+            return static_cast<__mmask16>(~eq & ((~diffSign & lessSame) | (diffSign & negA)));
+        }
+    };
+#endif // GE_KERNEL_HAS_AVX512
+
+    //--------------------------------------------------------------------------
+    // Drivers: widest kernel for the bulk, UlpScalar for the tail.
+
+    struct EqualOp
+    {
+        template <typename K>
+        static uint32_t Mask(const real32_t* a, const real32_t* b, int32_t tol) { return K::EqualMask(a, b, tol); }
+    };
+
+    struct LessOp
+    {
+        template <typename K>
+        static uint32_t Mask(const real32_t* a, const real32_t* b, int32_t tol) { return K::LessMask(a, b, tol); }
+    };
+
+    template <typename K, typename Op>
+    inline size_t ToBoolsRange(const real32_t* a, const real32_t* b, int32_t tol, bool* out, size_t i, size_t n)
+    {
+        for (; i + K::kLanes <= n; i += K::kLanes)
+        {
+            const uint32_t m = Op::template Mask<K>(a + i, b + i, tol);
+            for (size_t j = 0; j < K::kLanes; ++j)
+            {
+                out[i + j] = (m >> j) & 1u;
+            }
+        }
+        return i;
+    }
+
+    template <typename K, typename Op>
+    void ToBools(const real32_t* a, const real32_t* b, int32_t tol, bool* out, size_t n)
+    {
+        size_t i = ToBoolsRange<K, Op>(a, b, tol, out, 0, n);
+        ToBoolsRange<UlpScalar, Op>(a, b, tol, out, i, n);
+    }
+
+    // Bit i of the result lives in word i / 64 at position i % 64; unused
+    // high bits of the last word are cleared.
+    template <typename K, typename Op>
+    inline size_t ToBitsRange(const real32_t* a, const real32_t* b, int32_t tol, uint64_t* out, size_t i, size_t n)
+    {
+        for (; i + K::kLanes <= n; i += K::kLanes)
+        {
+            const uint64_t m = Op::template Mask<K>(a + i, b + i, tol);
+            out[i / 64] |= m << (i % 64);
+        }
+        return i;
+    }
+
+    template <typename K, typename Op>
+    void ToBits(const real32_t* a, const real32_t* b, int32_t tol, uint64_t* out, size_t n)
+    {
+        std::memset(out, 0, ((n + 63) / 64) * sizeof(uint64_t));
+        size_t i = ToBitsRange<K, Op>(a, b, tol, out, 0, n);
+        ToBitsRange<UlpScalar, Op>(a, b, tol, out, i, n);
+    }
+
+} // end of ulpkernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_ULPKERNELS_H
@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "gevector3array.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+
+namespace
+{
+    const ge::details::dispatch::Vector3KernelTable<GeReal32>& Kernels32()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3f;
+    }
+
+    const ge::details::dispatch::Vector3KernelTable<GeReal64>& Kernels64()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3d;
+    }
+} // end of anonymous
+
+//==============================================================================
+// Dot
+
+template <>
+void GeVector3BatchDot<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayCView<GeReal32> b, GeReal32* out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchDot, a.size);
+    assert(a.size == b.size);
+    Kernels32().dot(a.x, a.y, a.z, b.x, b.y, b.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchDot<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayCView<GeReal64> b, GeReal64* out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchDot, a.size);
+    assert(a.size == b.size);
+    Kernels64().dot(a.x, a.y, a.z, b.x, b.y, b.z, out, a.size);
+}
+
+//==============================================================================
+// Cross
+
+template <>
+void GeVector3BatchCross<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayCView<GeReal32> b, GeVector3ArrayView<GeReal32> out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchCross, a.size);
+    assert(a.size == b.size && a.size == out.size);
+    Kernels32().cross(a.x, a.y, a.z, b.x, b.y, b.z, out.x, out.y, out.z, a.size);
+}
+
+template <>
+void GeVector3BatchCross<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayCView<GeReal64> b, GeVector3ArrayView<GeReal64> out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchCross, a.size);
+    assert(a.size == b.size && a.size == out.size);
+    Kernels64().cross(a.x, a.y, a.z, b.x, b.y, b.z, out.x, out.y, out.z, a.size);
+}
+
+//==============================================================================
+// Magnitude
+
+template <>
+void GeVector3BatchMagnitudeSquare<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels32().magnitudeSquare(a.x, a.y, a.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchMagnitudeSquare<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels64().magnitudeSquare(a.x, a.y, a.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchMagnitude<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels32().magnitude[static_cast<int>(precision)](a.x, a.y, a.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchMagnitude<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels64().magnitude[static_cast<int>(precision)](a.x, a.y, a.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchInvMagnitude<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32* out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels32().invMagnitude[static_cast<int>(precision)](a.x, a.y, a.z, out, a.size);
+}
+
+template <>
+void GeVector3BatchInvMagnitude<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64* out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchMagnitude, a.size);
+    Kernels64().invMagnitude[static_cast<int>(precision)](a.x, a.y, a.z, out, a.size);
+}
+
+//==============================================================================
+// Normalize
+
+template <>
+void GeVector3BatchNormalize<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeVector3ArrayView<GeReal32> out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchNormalize, a.size);
+    assert(a.size == out.size);
+    Kernels32().normalize[static_cast<int>(precision)](a.x, a.y, a.z, out.x, out.y, out.z, a.size);
+}
+
+template <>
+void GeVector3BatchNormalize<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeVector3ArrayView<GeReal64> out, GePrecision precision)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kBatchNormalize, a.size);
+    assert(a.size == out.size);
+    Kernels64().normalize[static_cast<int>(precision)](a.x, a.y, a.z, out.x, out.y, out.z, a.size);
+}
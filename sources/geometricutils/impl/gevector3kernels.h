@@ -0,0 +1,511 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#ifndef GEOMUTILS_IMPL_VECTOR3KERNELS_H
+#define GEOMUTILS_IMPL_VECTOR3KERNELS_H
+
+// SoA GeVector3 kernels written against the lane-pack interface of gesimd.h.
+// Operation order mirrors GeVector3 so every lane rounds exactly like the
+// scalar member functions.
+
+#include "gebaseutl.h"
+#include "impl/gesimd.h"
+
+#include <limits>
+
+namespace ge
+{
+namespace details
+{
+inline namespace GE_KERNEL_TIER
+{
+namespace vector3kernels
+{
+    template <typename P, typename T>
+    inline size_t DotRange(const T* ax, const T* ay, const T* az,
+                           const T* bx, const T* by, const T* bz,
+                           T* out, size_t i, size_t n)
+    {
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            P r = P::Load(ax + i) * P::Load(bx + i) + P::Load(ay + i) * P::Load(by + i);
+            r = r + P::Load(az + i) * P::Load(bz + i);
+            r.Store(out + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t CrossRange(const T* ax, const T* ay, const T* az,
+                             const T* bx, const T* by, const T* bz,
+                             T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P x1 = P::Load(ax + i), y1 = P::Load(ay + i), z1 = P::Load(az + i);
+            const P x2 = P::Load(bx + i), y2 = P::Load(by + i), z2 = P::Load(bz + i);
+            (y1 * z2 - z1 * y2).Store(ox + i);
+            (z1 * x2 - x1 * z2).Store(oy + i);
+            (x1 * y2 - y1 * x2).Store(oz + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline P LoadMagnitudeSquare(const T* x, const T* y, const T* z, size_t i)
+    {
+        const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+        return (px * px + py * py) + pz * pz;
+    }
+
+    template <typename P, typename T>
+    inline size_t MagnitudeSquareRange(const T* x, const T* y, const T* z,
+                                       T* out, size_t i, size_t n)
+    {
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            LoadMagnitudeSquare<P>(x, y, z, i).Store(out + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t MagnitudeRange(const T* x, const T* y, const T* z,
+                                 T* out, size_t i, size_t n)
+    {
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            Sqrt(LoadMagnitudeSquare<P>(x, y, z, i)).Store(out + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t NormalizeRange(const T* x, const T* y, const T* z,
+                                 T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        const P zero = P::Broadcast(T(0));
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P mag = Sqrt(LoadMagnitudeSquare<P>(x, y, z, i));
+            const auto nonZero = NotEqualZero(mag);
+            const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+            Select(nonZero, px / mag, zero).Store(ox + i);
+            Select(nonZero, py / mag, zero).Store(oy + i);
+            Select(nonZero, pz / mag, zero).Store(oz + i);
+        }
+        return i;
+    }
+
+    //--------------------------------------------------------------------------
+    // Precision-tiered variants. Packs without a hardware estimate (double)
+    // always take the exact path, mirroring GeRsqrt.
+
+    template <typename P, GePrecision Prec>
+    constexpr GePrecision EffectivePrecision()
+    {
+        return P::kHasRsqrt ? Prec : GePrecision::kExact;
+    }
+
+    template <typename P, GePrecision Prec>
+    inline P Rsqrt(P x)
+    {
+        using T = typename P::value_type;
+        if constexpr (EffectivePrecision<P, Prec>() == GePrecision::kExact)
+        {
+            return P::Broadcast(T(1)) / Sqrt(x);
+        }
+        else
+        {
+            // The estimate treats denormals as zero: those lanes are scaled
+            // by 2^64 into the normal range and the result back by 2^32
+            const auto tiny = LessThan(x, P::Broadcast(std::numeric_limits<T>::min()));
+            const P xs = Select(tiny, x * P::Broadcast(T(18446744073709551616.0)), x);
+            P y = RsqrtApprox(xs);
+            if constexpr (Prec == GePrecision::kRefined)
+            {
+                // one Newton-Raphson step, same operation order as GeRsqrt;
+                // zero gives 0 * inf there, so it is mapped back to +inf
+                y = y * (P::Broadcast(T(1.5)) - P::Broadcast(T(0.5)) * xs * y * y);
+                y = Select(NotEqualZero(x), y, P::Broadcast(std::numeric_limits<T>::infinity()));
+            }
+            return Select(tiny, y * P::Broadcast(T(4294967296.0)), y);
+        }
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    inline size_t InvMagnitudeRange(const T* x, const T* y, const T* z,
+                                    T* out, size_t i, size_t n)
+    {
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            Rsqrt<P, Prec>(LoadMagnitudeSquare<P>(x, y, z, i)).Store(out + i);
+        }
+        return i;
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    inline size_t ApproxMagnitudeRange(const T* x, const T* y, const T* z,
+                                       T* out, size_t i, size_t n)
+    {
+        const P zero = P::Broadcast(T(0));
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P sq = LoadMagnitudeSquare<P>(x, y, z, i);
+            Select(NotEqualZero(sq), sq * Rsqrt<P, Prec>(sq), zero).Store(out + i);
+        }
+        return i;
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    inline size_t ApproxNormalizeRange(const T* x, const T* y, const T* z,
+                                       T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        const P zero = P::Broadcast(T(0));
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P sq = LoadMagnitudeSquare<P>(x, y, z, i);
+            const auto nonZero = NotEqualZero(sq);
+            const P inv = Rsqrt<P, Prec>(sq);
+            Select(nonZero, P::Load(x + i) * inv, zero).Store(ox + i);
+            Select(nonZero, P::Load(y + i) * inv, zero).Store(oy + i);
+            Select(nonZero, P::Load(z + i) * inv, zero).Store(oz + i);
+        }
+        return i;
+    }
+
+    //--------------------------------------------------------------------------
+    // Reductions. Lane accumulators are folded in lane order and the scalar
+    // tail comes last, so a given block and tier always produce the same
+    // result.
+
+    template <typename P, typename T>
+    inline size_t BoundsRange(const T* x, const T* y, const T* z,
+                              T* lo, T* hi, size_t i, size_t n)
+    {
+        if (i + P::kLanes > n)
+            return i;
+
+        P lx = P::Broadcast(lo[0]), ly = P::Broadcast(lo[1]), lz = P::Broadcast(lo[2]);
+        P hx = P::Broadcast(hi[0]), hy = P::Broadcast(hi[1]), hz = P::Broadcast(hi[2]);
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+            lx = Min(px, lx);
+            ly = Min(py, ly);
+            lz = Min(pz, lz);
+            hx = Max(px, hx);
+            hy = Max(py, hy);
+            hz = Max(pz, hz);
+        }
+
+        const P lows[3] = {lx, ly, lz};
+        const P highs[3] = {hx, hy, hz};
+        T lanes[P::kLanes];
+        for (int k = 0; k < 3; ++k)
+        {
+            lows[k].Store(lanes);
+            for (size_t l = 0; l < P::kLanes; ++l)
+                lo[k] = lanes[l] < lo[k] ? lanes[l] : lo[k];
+            highs[k].Store(lanes);
+            for (size_t l = 0; l < P::kLanes; ++l)
+                hi[k] = lanes[l] > hi[k] ? lanes[l] : hi[k];
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t SumRange(const T* x, const T* y, const T* z,
+                           T* sum, size_t i, size_t n)
+    {
+        if (i + P::kLanes > n)
+            return i;
+
+        const P zero = P::Broadcast(T(0));
+        P sx = zero, sy = zero, sz = zero;
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            sx = sx + P::Load(x + i);
+            sy = sy + P::Load(y + i);
+            sz = sz + P::Load(z + i);
+        }
+
+        const P acc[3] = {sx, sy, sz};
+        T lanes[P::kLanes];
+        for (int k = 0; k < 3; ++k)
+        {
+            acc[k].Store(lanes);
+            for (size_t l = 0; l < P::kLanes; ++l)
+                sum[k] = sum[k] + lanes[l];
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline P LoadDot(const T* x, const T* y, const T* z, const P* d, size_t i)
+    {
+        P r = P::Load(x + i) * d[0] + P::Load(y + i) * d[1];
+        return r + P::Load(z + i) * d[2];
+    }
+
+    // Largest dot product with dir; NaN products are skipped
+    template <typename P, typename T>
+    inline size_t MaxDotRange(const T* x, const T* y, const T* z, const T* dir,
+                              T& best, size_t i, size_t n)
+    {
+        if (i + P::kLanes > n)
+            return i;
+
+        const P d[3] = {P::Broadcast(dir[0]), P::Broadcast(dir[1]), P::Broadcast(dir[2])};
+        P acc = P::Broadcast(best);
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            acc = Max(LoadDot<P>(x, y, z, d, i), acc);
+        }
+
+        T lanes[P::kLanes];
+        acc.Store(lanes);
+        for (size_t l = 0; l < P::kLanes; ++l)
+            best = lanes[l] > best ? lanes[l] : best;
+        return i;
+    }
+
+    // Advances i to the first index whose dot product with dir equals value;
+    // false when there is none before the last full pack
+    template <typename P, typename T>
+    inline bool FindDotRange(const T* x, const T* y, const T* z, const T* dir,
+                             T value, size_t& i, size_t n)
+    {
+        const P d[3] = {P::Broadcast(dir[0]), P::Broadcast(dir[1]), P::Broadcast(dir[2])};
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            T lanes[P::kLanes];
+            LoadDot<P>(x, y, z, d, i).Store(lanes);
+            for (size_t l = 0; l < P::kLanes; ++l)
+            {
+                if (lanes[l] == value)
+                {
+                    i += l;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    // Full-array drivers: widest pack for the bulk, scalar pack for the tail.
+
+    //--------------------------------------------------------------------------
+    // Transforms by a row-major matrix: 3x3 (linear), 3x4 (affine, the last
+    // column is the translation) or 4x4 (projective, divided by w). Every
+    // lane is loaded before anything is stored, so out may alias in.
+
+    template <typename P, typename T>
+    inline size_t LinearRange(const T* x, const T* y, const T* z, const T* m,
+                              T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        const P m00 = P::Broadcast(m[0]), m01 = P::Broadcast(m[1]), m02 = P::Broadcast(m[2]);
+        const P m10 = P::Broadcast(m[3]), m11 = P::Broadcast(m[4]), m12 = P::Broadcast(m[5]);
+        const P m20 = P::Broadcast(m[6]), m21 = P::Broadcast(m[7]), m22 = P::Broadcast(m[8]);
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+            (m00 * px + m01 * py + m02 * pz).Store(ox + i);
+            (m10 * px + m11 * py + m12 * pz).Store(oy + i);
+            (m20 * px + m21 * py + m22 * pz).Store(oz + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t AffineRange(const T* x, const T* y, const T* z, const T* m,
+                              T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        const P m00 = P::Broadcast(m[0]), m01 = P::Broadcast(m[1]), m02 = P::Broadcast(m[2]), m03 = P::Broadcast(m[3]);
+        const P m10 = P::Broadcast(m[4]), m11 = P::Broadcast(m[5]), m12 = P::Broadcast(m[6]), m13 = P::Broadcast(m[7]);
+        const P m20 = P::Broadcast(m[8]), m21 = P::Broadcast(m[9]), m22 = P::Broadcast(m[10]), m23 = P::Broadcast(m[11]);
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+            (m00 * px + m01 * py + m02 * pz + m03).Store(ox + i);
+            (m10 * px + m11 * py + m12 * pz + m13).Store(oy + i);
+            (m20 * px + m21 * py + m22 * pz + m23).Store(oz + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    inline size_t ProjectiveRange(const T* x, const T* y, const T* z, const T* m,
+                                  T* ox, T* oy, T* oz, size_t i, size_t n)
+    {
+        const P m00 = P::Broadcast(m[0]), m01 = P::Broadcast(m[1]), m02 = P::Broadcast(m[2]), m03 = P::Broadcast(m[3]);
+        const P m10 = P::Broadcast(m[4]), m11 = P::Broadcast(m[5]), m12 = P::Broadcast(m[6]), m13 = P::Broadcast(m[7]);
+        const P m20 = P::Broadcast(m[8]), m21 = P::Broadcast(m[9]), m22 = P::Broadcast(m[10]), m23 = P::Broadcast(m[11]);
+        const P m30 = P::Broadcast(m[12]), m31 = P::Broadcast(m[13]), m32 = P::Broadcast(m[14]), m33 = P::Broadcast(m[15]);
+        for (; i + P::kLanes <= n; i += P::kLanes)
+        {
+            const P px = P::Load(x + i), py = P::Load(y + i), pz = P::Load(z + i);
+            const P w = m30 * px + m31 * py + m32 * pz + m33;
+            ((m00 * px + m01 * py + m02 * pz + m03) / w).Store(ox + i);
+            ((m10 * px + m11 * py + m12 * pz + m13) / w).Store(oy + i);
+            ((m20 * px + m21 * py + m22 * pz + m23) / w).Store(oz + i);
+        }
+        return i;
+    }
+
+    template <typename P, typename T>
+    void Linear(const T* x, const T* y, const T* z, const T* m, T* ox, T* oy, T* oz, size_t n)
+    {
+        size_t i = LinearRange<P>(x, y, z, m, ox, oy, oz, 0, n);
+        LinearRange<simd::ScalarPack<T>>(x, y, z, m, ox, oy, oz, i, n);
+    }
+
+    template <typename P, typename T>
+    void Affine(const T* x, const T* y, const T* z, const T* m, T* ox, T* oy, T* oz, size_t n)
+    {
+        size_t i = AffineRange<P>(x, y, z, m, ox, oy, oz, 0, n);
+        AffineRange<simd::ScalarPack<T>>(x, y, z, m, ox, oy, oz, i, n);
+    }
+
+    template <typename P, typename T>
+    void Projective(const T* x, const T* y, const T* z, const T* m, T* ox, T* oy, T* oz, size_t n)
+    {
+        size_t i = ProjectiveRange<P>(x, y, z, m, ox, oy, oz, 0, n);
+        ProjectiveRange<simd::ScalarPack<T>>(x, y, z, m, ox, oy, oz, i, n);
+    }
+
+    template <typename P, typename T>
+    void Dot(const T* ax, const T* ay, const T* az,
+             const T* bx, const T* by, const T* bz, T* out, size_t n)
+    {
+        size_t i = DotRange<P>(ax, ay, az, bx, by, bz, out, 0, n);
+        DotRange<simd::ScalarPack<T>>(ax, ay, az, bx, by, bz, out, i, n);
+    }
+
+    template <typename P, typename T>
+    void Cross(const T* ax, const T* ay, const T* az,
+               const T* bx, const T* by, const T* bz,
+               T* ox, T* oy, T* oz, size_t n)
+    {
+        size_t i = CrossRange<P>(ax, ay, az, bx, by, bz, ox, oy, oz, 0, n);
+        CrossRange<simd::ScalarPack<T>>(ax, ay, az, bx, by, bz, ox, oy, oz, i, n);
+    }
+
+    template <typename P, typename T>
+    void MagnitudeSquare(const T* x, const T* y, const T* z, T* out, size_t n)
+    {
+        size_t i = MagnitudeSquareRange<P>(x, y, z, out, 0, n);
+        MagnitudeSquareRange<simd::ScalarPack<T>>(x, y, z, out, i, n);
+    }
+
+    template <typename P, typename T>
+    void Magnitude(const T* x, const T* y, const T* z, T* out, size_t n)
+    {
+        size_t i = MagnitudeRange<P>(x, y, z, out, 0, n);
+        MagnitudeRange<simd::ScalarPack<T>>(x, y, z, out, i, n);
+    }
+
+    template <typename P, typename T>
+    void Normalize(const T* x, const T* y, const T* z,
+                   T* ox, T* oy, T* oz, size_t n)
+    {
+        size_t i = NormalizeRange<P>(x, y, z, ox, oy, oz, 0, n);
+        NormalizeRange<simd::ScalarPack<T>>(x, y, z, ox, oy, oz, i, n);
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    void InvMagnitude(const T* x, const T* y, const T* z, T* out, size_t n)
+    {
+        size_t i = InvMagnitudeRange<P, Prec>(x, y, z, out, 0, n);
+        InvMagnitudeRange<simd::ScalarPack<T>, Prec>(x, y, z, out, i, n);
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    void MagnitudeP(const T* x, const T* y, const T* z, T* out, size_t n)
+    {
+        if constexpr (EffectivePrecision<P, Prec>() == GePrecision::kExact)
+        {
+            Magnitude<P>(x, y, z, out, n);
+        }
+        else
+        {
+            size_t i = ApproxMagnitudeRange<P, Prec>(x, y, z, out, 0, n);
+            ApproxMagnitudeRange<simd::ScalarPack<T>, Prec>(x, y, z, out, i, n);
+        }
+    }
+
+    template <typename P, GePrecision Prec, typename T>
+    void NormalizeP(const T* x, const T* y, const T* z,
+                    T* ox, T* oy, T* oz, size_t n)
+    {
+        if constexpr (EffectivePrecision<P, Prec>() == GePrecision::kExact)
+        {
+            Normalize<P>(x, y, z, ox, oy, oz, n);
+        }
+        else
+        {
+            size_t i = ApproxNormalizeRange<P, Prec>(x, y, z, ox, oy, oz, 0, n);
+            ApproxNormalizeRange<simd::ScalarPack<T>, Prec>(x, y, z, ox, oy, oz, i, n);
+        }
+    }
+
+    // lo/hi (three components each) are expanded by the block
+    template <typename P, typename T>
+    void Bounds(const T* x, const T* y, const T* z, size_t n, T* lo, T* hi)
+    {
+        size_t i = BoundsRange<P>(x, y, z, lo, hi, 0, n);
+        BoundsRange<simd::ScalarPack<T>>(x, y, z, lo, hi, i, n);
+    }
+
+    // sum receives the three component sums of the block
+    template <typename P, typename T>
+    void Sum(const T* x, const T* y, const T* z, size_t n, T* sum)
+    {
+        sum[0] = sum[1] = sum[2] = T(0);
+        size_t i = SumRange<P>(x, y, z, sum, 0, n);
+        SumRange<simd::ScalarPack<T>>(x, y, z, sum, i, n);
+    }
+
+    // Index of the first largest dot product with dir, or n when every
+    // product is NaN; best receives the product
+    template <typename P, typename T>
+    size_t Extreme(const T* x, const T* y, const T* z, size_t n, const T* dir, T* best)
+    {
+        T value = -std::numeric_limits<T>::infinity();
+        size_t i = MaxDotRange<P>(x, y, z, dir, value, 0, n);
+        MaxDotRange<simd::ScalarPack<T>>(x, y, z, dir, value, i, n);
+        *best = value;
+
+        i = 0;
+        if (!FindDotRange<P>(x, y, z, dir, value, i, n))
+            FindDotRange<simd::ScalarPack<T>>(x, y, z, dir, value, i, n);
+        return i;
+    }
+
+} // end of vector3kernels
+} // end of GE_KERNEL_TIER
+} // end of details
+} // end of ge
+
+#endif // GEOMUTILS_IMPL_VECTOR3KERNELS_H
@@ -0,0 +1,318 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "gevector3reduce.h"
+#include "geparallel.h"
+#include "gestats.h"
+#include "impl/gekernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    // Fixed so that block results, and their combination, do not depend on
+    // the number of threads
+    const GeSize kBlockSize = 1 << 12;
+
+    template <typename T>
+    const ge::details::dispatch::Vector3KernelTable<T>& Kernels();
+
+    template <>
+    const ge::details::dispatch::Vector3KernelTable<GeReal32>& Kernels<GeReal32>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3f;
+    }
+
+    template <>
+    const ge::details::dispatch::Vector3KernelTable<GeReal64>& Kernels<GeReal64>()
+    {
+        return ge::details::dispatch::ActiveKernelTable().vector3d;
+    }
+
+    GeSize BlockCount(GeSize n)
+    {
+        return (n + kBlockSize - 1) / kBlockSize;
+    }
+
+    // Calls f(block, begin, end) for every block of [0, n)
+    template <typename F>
+    void ForEachBlock(GeSize n, const GeReduceOptions& options, F&& f)
+    {
+        auto blocks = [&](GeSize first, GeSize last) {
+            for (GeSize b = first; b < last; ++b)
+                f(b, b * kBlockSize, std::min(n, (b + 1) * kBlockSize));
+        };
+        if (options.parallel)
+            GeParallelFor(0, BlockCount(n), std::max<GeSize>(1, options.grainSize / kBlockSize), blocks);
+        else
+            blocks(0, BlockCount(n));
+    }
+
+    template <typename T>
+    GeAabb3<T> Bounds(GeVector3ArrayCView<T> a, const GeReduceOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchReduce, a.size);
+        const auto& kernels = Kernels<T>();
+        const GeAabb3<T> empty;
+        GeArenaVector<GeAabb3<T>> partial(BlockCount(a.size), empty, GeArenaAllocator<GeAabb3<T>>(options.pArena));
+        ForEachBlock(a.size, options, [&](GeSize b, GeSize begin, GeSize end) {
+            T lo[3] = {empty.min.x, empty.min.y, empty.min.z};
+            T hi[3] = {empty.max.x, empty.max.y, empty.max.z};
+            kernels.bounds(a.x + begin, a.y + begin, a.z + begin, end - begin, lo, hi);
+            partial[b] = GeAabb3<T>(GeVector3<T>(lo[0], lo[1], lo[2]), GeVector3<T>(hi[0], hi[1], hi[2]));
+        });
+
+        GeAabb3<T> box;
+        for (const GeAabb3<T>& block : partial)
+            box.Expand(block);
+        return box;
+    }
+
+    template <typename T>
+    GeVector3<T> Centroid(GeVector3ArrayCView<T> a, const GeReduceOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchReduce, a.size);
+        if (a.size == 0)
+            return GeVector3<T>();
+
+        const auto& kernels = Kernels<T>();
+        GeArenaVector<GeVector3<T>> partial(BlockCount(a.size), GeArenaAllocator<GeVector3<T>>(options.pArena));
+        ForEachBlock(a.size, options, [&](GeSize b, GeSize begin, GeSize end) {
+            T sum[3];
+            kernels.sum(a.x + begin, a.y + begin, a.z + begin, end - begin, sum);
+            partial[b] = GeVector3<T>(sum[0], sum[1], sum[2]);
+        });
+
+        double sum[3] = {0.0, 0.0, 0.0};
+        for (const GeVector3<T>& block : partial)
+        {
+            sum[0] += block.x;
+            sum[1] += block.y;
+            sum[2] += block.z;
+        }
+        const double n = static_cast<double>(a.size);
+        return GeVector3<T>(static_cast<T>(sum[0] / n), static_cast<T>(sum[1] / n), static_cast<T>(sum[2] / n));
+    }
+
+    const GeSize kScanStride = 64;
+
+    // Interval holding every v that is GeRealEqual to m with tol: the
+    // relative test allows tol * |m| / (1 - tol) around m, the ULP test one
+    // ULP. It is widened twofold to absorb rounding, as it only serves to
+    // skip elements before the exact test. An infinite m would give an
+    // inf - inf bound, so it, like a large tol, skips nothing. Neither does
+    // the window of a lane holding an infinity (laneInfinite): on the
+    // relative path |inf - m| <= tol * inf, so inf can match a finite m.
+    template <typename T>
+    void EqualWindow(T m, T tol, bool laneInfinite, T& lo, T& hi)
+    {
+        if (!(tol < T(0.5)) || !std::isfinite(m) || laneInfinite)
+        {
+            lo = -std::numeric_limits<T>::infinity();
+            hi = std::numeric_limits<T>::infinity();
+            return;
+        }
+
+        const T absM = GeRealAbs(m);
+        const T relative = std::max(tol, T(0)) * absM / (T(1) - tol);
+        const T ulp = T(2) * std::numeric_limits<T>::epsilon() * absM;
+        const T window = T(2) * std::max(relative, ulp) + std::numeric_limits<T>::denorm_min();
+        lo = m - window;
+        hi = m + window;
+    }
+
+    // First index in [begin, end) GeRealEqual to m, or end
+    template <typename T>
+    GeSize FindRealEqual(const T* lane, GeSize begin, GeSize end, T m, T tol, T lo, T hi)
+    {
+        GeSize i = begin;
+        for (; i + kScanStride <= end; i += kScanStride)
+        {
+            // fixed-length and branch-free so that it vectorizes
+            int hits = 0;
+            for (GeSize j = 0; j < kScanStride; ++j)
+                hits |= (lane[i + j] >= lo) & (lane[i + j] <= hi);
+            if (hits == 0)
+                continue;
+
+            for (GeSize j = i; j < i + kScanStride; ++j)
+            {
+                if (GeRealEqual(lane[j], m, tol))
+                    return j;
+            }
+        }
+        for (; i < end; ++i)
+        {
+            if (GeRealEqual(lane[i], m, tol))
+                return i;
+        }
+        return end;
+    }
+
+    template <typename T>
+    bool RealMinMax(GeVector3ArrayCView<T> a, T tol, GeVector3<T>& outMin, GeVector3<T>& outMax,
+                    const GeReduceOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchReduce, a.size);
+        const GeAabb3<T> box = Bounds(a, options);
+        if (box.IsEmpty())
+            return false;
+
+        // Earliest element tolerantly equal to each exact extreme. A block is
+        // only scanned for the targets not yet found in an earlier position.
+        const T* lanes[3] = {a.x, a.y, a.z};
+        const T exact[6] = {box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z};
+        T lo[6], hi[6];
+        for (int k = 0; k < 6; ++k)
+            EqualWindow(exact[k], tol, std::isinf(exact[k % 3]) || std::isinf(exact[k % 3 + 3]), lo[k], hi[k]);
+        std::atomic<GeSize> first[6];
+        for (std::atomic<GeSize>& index : first)
+            index.store(a.size, std::memory_order_relaxed);
+
+        ForEachBlock(a.size, options, [&](GeSize, GeSize begin, GeSize end) {
+            for (int k = 0; k < 6; ++k)
+            {
+                if (first[k].load(std::memory_order_relaxed) <= begin)
+                    continue;
+
+                const GeSize i = FindRealEqual(lanes[k % 3], begin, end, exact[k], tol, lo[k], hi[k]);
+                if (i == end)
+                    continue;
+                GeSize current = first[k].load(std::memory_order_relaxed);
+                while (i < current && !first[k].compare_exchange_weak(current, i, std::memory_order_relaxed))
+                {
+                }
+            }
+        });
+
+        // The exact extreme always matches itself
+        T found[6];
+        for (int k = 0; k < 6; ++k)
+        {
+            const GeSize index = first[k].load();
+            found[k] = index < a.size ? lanes[k % 3][index] : exact[k];
+        }
+        outMin = GeVector3<T>(found[0], found[1], found[2]);
+        outMax = GeVector3<T>(found[3], found[4], found[5]);
+        return true;
+    }
+
+    template <typename T>
+    GeSize Extreme(GeVector3ArrayCView<T> a, const GeVector3<T>& direction, const GeReduceOptions& options)
+    {
+        GE_STATS_SCOPE(GeStatPrimitive::kBatchReduce, a.size);
+        struct Candidate
+        {
+            GeSize index;
+            T dot;
+        };
+
+        const auto& kernels = Kernels<T>();
+        const T dir[3] = {direction.x, direction.y, direction.z};
+        GeArenaVector<Candidate> partial(BlockCount(a.size), GeArenaAllocator<Candidate>(options.pArena));
+        ForEachBlock(a.size, options, [&](GeSize b, GeSize begin, GeSize end) {
+            T dot;
+            const GeSize index = kernels.extreme(a.x + begin, a.y + begin, a.z + begin, end - begin, dir, &dot);
+            partial[b] = Candidate{index < end - begin ? begin + index : a.size, dot};
+        });
+
+        Candidate best{a.size, T(0)};
+        for (const Candidate& block : partial)
+        {
+            if (block.index != a.size && (best.index == a.size || block.dot > best.dot))
+                best = block;
+        }
+        return best.index;
+    }
+} // end of anonymous
+
+//==============================================================================
+// Bounds
+
+template <>
+GeAabb3<GeReal32> GeVector3BatchBounds<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeReduceOptions& options)
+{
+    return Bounds(a, options);
+}
+
+template <>
+GeAabb3<GeReal64> GeVector3BatchBounds<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeReduceOptions& options)
+{
+    return Bounds(a, options);
+}
+
+//==============================================================================
+// Centroid
+
+template <>
+GeVector3<GeReal32> GeVector3BatchCentroid<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeReduceOptions& options)
+{
+    return Centroid(a, options);
+}
+
+template <>
+GeVector3<GeReal64> GeVector3BatchCentroid<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeReduceOptions& options)
+{
+    return Centroid(a, options);
+}
+
+//==============================================================================
+// Tolerant min/max
+
+template <>
+bool GeVector3BatchRealMinMax<GeReal32>(GeVector3ArrayCView<GeReal32> a, GeReal32 tol,
+                                        GeVector3<GeReal32>& outMin, GeVector3<GeReal32>& outMax,
+                                        const GeReduceOptions& options)
+{
+    return RealMinMax(a, tol, outMin, outMax, options);
+}
+
+template <>
+bool GeVector3BatchRealMinMax<GeReal64>(GeVector3ArrayCView<GeReal64> a, GeReal64 tol,
+                                        GeVector3<GeReal64>& outMin, GeVector3<GeReal64>& outMax,
+                                        const GeReduceOptions& options)
+{
+    return RealMinMax(a, tol, outMin, outMax, options);
+}
+
+//==============================================================================
+// Extreme point
+
+template <>
+GeSize GeVector3BatchExtreme<GeReal32>(GeVector3ArrayCView<GeReal32> a, const GeVector3<GeReal32>& direction,
+                                       const GeReduceOptions& options)
+{
+    return Extreme(a, direction, options);
+}
+
+template <>
+GeSize GeVector3BatchExtreme<GeReal64>(GeVector3ArrayCView<GeReal64> a, const GeVector3<GeReal64>& direction,
+                                       const GeReduceOptions& options)
+{
+    return Extreme(a, direction, options);
+}
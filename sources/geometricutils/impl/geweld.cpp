@@ -0,0 +1,371 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "geweld.h"
+#include "geparallel.h"
+#include "gerealutl.h"
+#include "gestats.h"
+#include "impl/geradixsort.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace ge
+{
+namespace details
+{
+namespace weld
+{
+    const GeUint64 kNoCell = ~GeUint64(0);
+    const GeUint32 kMerged = ~GeUint32(0);
+
+    // A partner lies within a quarter cell; the rest of the margin absorbs
+    // rounding of the cell coordinates
+    const double kNeighbourMargin = 0.3125;
+
+    struct Entry
+    {
+        GeUint64 key;
+        GeUint32 index;
+    };
+
+    struct Run
+    {
+        GeUint32 begin;
+        GeUint32 end;
+    };
+
+    inline GeUint64 Mix(GeUint64 h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    inline GeUint64 HashCell(GeInt64 x, GeInt64 y, GeInt64 z)
+    {
+        GeUint64 h = Mix(static_cast<GeUint64>(x));
+        h = Mix(h ^ static_cast<GeUint64>(y));
+        h = Mix(h ^ static_cast<GeUint64>(z));
+        return h == kNoCell ? h - 1 : h;
+    }
+
+    template <typename T>
+    inline bool IsFinite(const GeVector3<T>& v)
+    {
+        return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+    }
+
+    template <typename T>
+    inline bool Equal(const GeVector3<T>& a, const GeVector3<T>& b, T tol)
+    {
+        return GeRealEqual(a.x, b.x, tol) && GeRealEqual(a.y, b.y, tol) && GeRealEqual(a.z, b.z, tol);
+    }
+
+    //--------------------------------------------------------------------------
+    // Cell coordinates are computed in double for both precisions, which
+    // keeps their rounding far below the neighbour margin
+
+    struct Cell
+    {
+        GeInt64 c[3];
+        int lo[3];                      // first neighbour offset to visit, -1 or 0
+        int hi[3];                      // last neighbour offset to visit, 0 or 1
+    };
+
+    template <typename T>
+    inline Cell Locate(const GeVector3<T>& v, double invCellSize)
+    {
+        const double p[3] = {double(v.x) * invCellSize, double(v.y) * invCellSize, double(v.z) * invCellSize};
+        Cell cell;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const double base = std::floor(p[axis]);
+            const double frac = p[axis] - base;
+            cell.c[axis] = static_cast<GeInt64>(base);
+            cell.lo[axis] = frac < kNeighbourMargin ? -1 : 0;
+            cell.hi[axis] = frac > 1.0 - kNeighbourMargin ? 1 : 0;
+        }
+        return cell;
+    }
+
+    //--------------------------------------------------------------------------
+    // Open-addressed map from a cell hash to its run in the sorted entries.
+    // Keys are claimed with a CAS, so runs can be inserted concurrently.
+
+    class CellTable
+    {
+    public:
+        explicit CellTable(GeSize runCount)
+        {
+            GeSize capacity = 16;
+            while (capacity < runCount * 2)
+                capacity *= 2;
+            m_mask = capacity - 1;
+            m_keys.reset(new std::atomic<GeUint64>[capacity]);
+            m_runs.reset(new Run[capacity]);
+            for (GeSize i = 0; i < capacity; ++i)
+                m_keys[i].store(kNoCell, std::memory_order_relaxed);
+        }
+
+        void Insert(GeUint64 key, Run run)
+        {
+            for (GeSize slot = key & m_mask;; slot = (slot + 1) & m_mask)
+            {
+                GeUint64 expected = kNoCell;
+                if (m_keys[slot].compare_exchange_strong(expected, key, std::memory_order_relaxed))
+                {
+                    m_runs[slot] = run;
+                    return;
+                }
+                assert(expected != key);
+            }
+        }
+
+        // Only valid once all insertions have been joined
+        bool Find(GeUint64 key, Run& run) const
+        {
+            for (GeSize slot = key & m_mask;; slot = (slot + 1) & m_mask)
+            {
+                const GeUint64 stored = m_keys[slot].load(std::memory_order_relaxed);
+                if (stored == key)
+                {
+                    run = m_runs[slot];
+                    return true;
+                }
+                if (stored == kNoCell)
+                    return false;
+            }
+        }
+
+    private:
+        GeSize m_mask = 0;
+        std::unique_ptr<std::atomic<GeUint64>[]> m_keys;
+        std::unique_ptr<Run[]> m_runs;
+    };
+
+    //--------------------------------------------------------------------------
+    // Calls visit(j) for the candidates of every neighbouring cell of v, in
+    // increasing index order per cell, until visit returns false
+
+    template <typename T, typename Visit>
+    void ForEachNeighbour(const GeVector3<T>& v, double invCellSize, const CellTable& table,
+                          const std::vector<Entry>& entries, Visit&& visit)
+    {
+        const Cell cell = Locate(v, invCellSize);
+        for (int dz = cell.lo[2]; dz <= cell.hi[2]; ++dz)
+        {
+            for (int dy = cell.lo[1]; dy <= cell.hi[1]; ++dy)
+            {
+                for (int dx = cell.lo[0]; dx <= cell.hi[0]; ++dx)
+                {
+                    Run run;
+                    if (!table.Find(HashCell(cell.c[0] + dx, cell.c[1] + dy, cell.c[2] + dz), run))
+                        continue;
+                    for (GeUint32 p = run.begin; p < run.end; ++p)
+                    {
+                        if (!visit(entries[p].index))
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename F>
+    void Dispatch(GeSize count, const GeWeldOptions& options, F&& f)
+    {
+        if (options.parallel)
+            GeParallelFor(0, count, options.grainSize, f);
+        else
+            f(GeSize(0), count);
+    }
+
+    //--------------------------------------------------------------------------
+
+    template <typename T>
+    GeSize WeldVertices(GeSpan<const GeVector3<T>> vertices, T tol,
+                        std::vector<GeUint32>& remap, std::vector<GeVector3<T>>& unique,
+                        const GeWeldOptions& options)
+    {
+        const GeSize count = vertices.size();
+        assert(count < kMerged);
+
+        remap.resize(count);
+        unique.clear();
+        if (count == 0)
+            return 0;
+
+        const GeVector3<T>* v = vertices.data();
+
+        // Largest finite coordinate magnitude bounds the distance between
+        // equal vertices: tol (or one ULP) relative to it
+        T maxAbs = T(0);
+        std::mutex maxAbsLock;
+        Dispatch(count, options, [&](GeSize begin, GeSize end) {
+            T local = T(0);
+            for (GeSize i = begin; i < end; ++i)
+            {
+                if (!IsFinite(v[i]))
+                    continue;
+                local = std::max({local, std::fabs(v[i].x), std::fabs(v[i].y), std::fabs(v[i].z)});
+            }
+            std::lock_guard<std::mutex> guard(maxAbsLock);
+            maxAbs = std::max(maxAbs, local);
+        });
+
+        const double relTol = double(tol) > 2.0 * std::numeric_limits<T>::epsilon() ? double(tol) : 2.0 * std::numeric_limits<T>::epsilon();
+        const double cellSize = std::max(4.0 * relTol * double(maxAbs), double(std::numeric_limits<T>::min()));
+        const double invCellSize = 1.0 / cellSize;
+
+        // Bucket by cell hash; non-finite vertices sort last and get no cell
+        std::vector<Entry> entries(count);
+        Dispatch(count, options, [&](GeSize begin, GeSize end) {
+            for (GeSize i = begin; i < end; ++i)
+            {
+                GeUint64 key = kNoCell;
+                if (IsFinite(v[i]))
+                {
+                    const Cell cell = Locate(v[i], invCellSize);
+                    key = HashCell(cell.c[0], cell.c[1], cell.c[2]);
+                }
+                entries[i] = Entry{key, static_cast<GeUint32>(i)};
+            }
+        });
+        // Entries start in index order, so the stable key sort also orders
+        // every run by index
+        radix::Sort(entries.data(), entries.size(), [](const Entry& e) { return e.key; },
+                    options.parallel, options.grainSize);
+
+        auto isRunStart = [&entries](GeSize p) {
+            return entries[p].key != kNoCell && (p == 0 || entries[p].key != entries[p - 1].key);
+        };
+
+        std::atomic<GeSize> runCount{0};
+        Dispatch(count, options, [&](GeSize begin, GeSize end) {
+            GeSize local = 0;
+            for (GeSize p = begin; p < end; ++p)
+                local += isRunStart(p) ? 1 : 0;
+            runCount.fetch_add(local, std::memory_order_relaxed);
+        });
+
+        CellTable table(runCount.load());
+        Dispatch(count, options, [&](GeSize begin, GeSize end) {
+            for (GeSize p = begin; p < end; ++p)
+            {
+                if (!isRunStart(p))
+                    continue;
+                GeSize last = p + 1;
+                while (last < count && entries[last].key == entries[p].key)
+                    ++last;
+                table.Insert(entries[p].key, Run{static_cast<GeUint32>(p), static_cast<GeUint32>(last)});
+            }
+        });
+
+        // Lowest index of an earlier vertex equal to each vertex, or itself
+        std::vector<GeUint32> firstEqual(count);
+        Dispatch(count, options, [&](GeSize begin, GeSize end) {
+            for (GeSize i = begin; i < end; ++i)
+            {
+                GeUint32 best = static_cast<GeUint32>(i);
+                if (IsFinite(v[i]))
+                {
+                    ForEachNeighbour(v[i], invCellSize, table, entries, [&](GeUint32 j) {
+                        if (j >= best)
+                            return false;
+                        if (!Equal(v[i], v[j], tol))
+                            return true;
+                        best = j;
+                        return false;
+                    });
+                }
+                firstEqual[i] = best;
+            }
+        });
+
+        // Resolve in index order. Once a vertex is done its slot holds its own
+        // index if it is unique and kMerged otherwise. Equality is not
+        // transitive, so when the first equal vertex was itself merged the
+        // lowest equal unique one has to be searched for.
+        GeSize uniqueCount = 0;
+        for (GeSize i = 0; i < count; ++i)
+        {
+            const GeUint32 self = static_cast<GeUint32>(i);
+            GeUint32 target = firstEqual[i];
+            if (target != self && firstEqual[target] != target)
+            {
+                target = self;
+                ForEachNeighbour(v[i], invCellSize, table, entries, [&](GeUint32 j) {
+                    if (j >= target)
+                        return false;
+                    if (firstEqual[j] != j || !Equal(v[i], v[j], tol))
+                        return true;
+                    target = j;
+                    return false;
+                });
+            }
+
+            if (target == self)
+            {
+                remap[i] = static_cast<GeUint32>(uniqueCount++);
+                unique.push_back(v[i]);
+                firstEqual[i] = self;
+            }
+            else
+            {
+                remap[i] = remap[target];
+                firstEqual[i] = kMerged;
+            }
+        }
+        return uniqueCount;
+    }
+} // end of weld
+} // end of details
+} // end of ge
+
+template <>
+GeSize GeWeldVertices<GeReal32>(GeSpan<const GeVector3<GeReal32>> vertices, GeReal32 tol,
+                                std::vector<GeUint32>& remap, std::vector<GeVector3<GeReal32>>& unique,
+                                const GeWeldOptions& options)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kWeld, vertices.size());
+    return ge::details::weld::WeldVertices(vertices, tol, remap, unique, options);
+}
+
+template <>
+GeSize GeWeldVertices<GeReal64>(GeSpan<const GeVector3<GeReal64>> vertices, GeReal64 tol,
+                                std::vector<GeUint32>& remap, std::vector<GeVector3<GeReal64>>& unique,
+                                const GeWeldOptions& options)
+{
+    GE_STATS_SCOPE(GeStatPrimitive::kWeld, vertices.size());
+    return ge::details::weld::WeldVertices(vertices, tol, remap, unique, options);
+}
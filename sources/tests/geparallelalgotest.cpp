@@ -0,0 +1,213 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// The parallel batch algorithms on a 5-thread scheduler, with grains small
+// enough to split the inputs, against their serial runs: the results must
+// be identical.
+
+#include "gecurve.h"
+#include "geparallel.h"
+#include "gesort.h"
+#include "gevector3reduce.h"
+#include "geweld.h"
+#include "getestutl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+const GeSize kCount = 50000;
+const GeSize kGrain = 1024;
+
+GeVector3Array<double> MakePoints(GeSize n)
+{
+    std::mt19937_64 rng(2025);
+    std::uniform_real_distribution<double> coord(-100.0, 100.0);
+    GeVector3Array<double> points(n);
+    for (GeSize i = 0; i < n; ++i)
+    {
+        // Every fourth point repeats an earlier one within the weld tolerance
+        if (i % 4 == 3)
+        {
+            const GeVector3<double> p = points[i / 2];
+            points.set(i, GeVector3<double>(p.x + 1e-9, p.y, p.z - 1e-9));
+        }
+        else
+        {
+            points.set(i, GeVector3<double>(coord(rng), coord(rng), std::floor(coord(rng))));
+        }
+    }
+    return points;
+}
+
+template <typename T>
+bool SameBits(const T& a, const T& b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+void TestRadixSort()
+{
+    const GeVector3Array<double> points = MakePoints(kCount);
+    std::vector<double> expected(points.x(), points.x() + kCount);
+    std::sort(expected.begin(), expected.end());
+
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GeSortOptions options;
+    options.grainSize = kGrain;
+    std::vector<double> values(points.x(), points.x() + kCount);
+    GeRadixSort<double>(GeSpan<double>(values.data(), values.size()), options);
+    GE_CHECK(values == expected);
+
+    std::vector<float> floats(kCount);
+    for (GeSize i = 0; i < kCount; ++i)
+        floats[i] = static_cast<float>(points.y()[i]);
+    std::vector<GeUint32> order(kCount), serialOrder(kCount);
+    GeRadixSortOrder<float>(GeSpan<const float>(floats.data(), kCount), GeSpan<GeUint32>(order.data(), kCount),
+                            options);
+    GeSortOptions serial = options;
+    serial.parallel = false;
+    GeRadixSortOrder<float>(GeSpan<const float>(floats.data(), kCount), GeSpan<GeUint32>(serialOrder.data(), kCount),
+                            serial);
+    GE_CHECK(order == serialOrder);
+}
+
+void TestVector3Sort()
+{
+    const GeVector3Array<double> points = MakePoints(kCount);
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GeSortOptions options;
+    options.grainSize = kGrain;
+    std::vector<GeUint32> order(kCount), expected(kCount);
+    GeVector3BatchSortOrder<double>(points.cview(), GeSpan<GeUint32>(order.data(), kCount), options);
+    // The generic template is the std::stable_sort reference
+    const GeVector3ArrayCView<double> view = points.cview();
+    std::iota(expected.begin(), expected.end(), GeUint32(0));
+    std::stable_sort(expected.begin(), expected.end(), [&view](GeUint32 i, GeUint32 j) {
+        if (view.x[i] != view.x[j])
+            return view.x[i] < view.x[j];
+        if (view.y[i] != view.y[j])
+            return view.y[i] < view.y[j];
+        return view.z[i] < view.z[j];
+    });
+    GE_CHECK(order == expected);
+}
+
+void TestWeld()
+{
+    const GeVector3Array<double> points = MakePoints(kCount);
+    std::vector<GeVector3<double>> vertices(kCount);
+    for (GeSize i = 0; i < kCount; ++i)
+        vertices[i] = points[i];
+    const GeSpan<const GeVector3<double>> span(vertices.data(), vertices.size());
+
+    GeWeldOptions serial;
+    serial.parallel = false;
+    std::vector<GeUint32> serialRemap;
+    std::vector<GeVector3<double>> serialUnique;
+    const GeSize serialCount = GeWeldVertices<double>(span, 1e-6, serialRemap, serialUnique, serial);
+    GE_CHECK(serialCount < kCount);
+
+    for (GeSize threads : {GeSize(2), GeSize(5)})
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        GeWeldOptions options;
+        options.grainSize = kGrain;
+        std::vector<GeUint32> remap;
+        std::vector<GeVector3<double>> unique;
+        GE_CHECK(GeWeldVertices<double>(span, 1e-6, remap, unique, options) == serialCount);
+        GE_CHECK(remap == serialRemap);
+        GE_CHECK(unique.size() == serialUnique.size() &&
+                 std::memcmp(unique.data(), serialUnique.data(), unique.size() * sizeof(unique[0])) == 0);
+    }
+}
+
+void TestCurveKeys()
+{
+    const GeVector3Array<double> points = MakePoints(kCount);
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GeReduceOptions reduce;
+    reduce.grainSize = kGrain;
+    const GeAabb3<double> box = GeVector3BatchBounds<double>(points.cview(), reduce);
+
+    for (GeSpaceCurve curve : {GeSpaceCurve::kMorton, GeSpaceCurve::kHilbert})
+    {
+        GeCurveOptions options;
+        options.grainSize = kGrain;
+        GeCurveOptions serial = options;
+        serial.parallel = false;
+        std::vector<GeUint64> keys(kCount), serialKeys(kCount);
+        GeVector3BatchCurveKeys<double>(points.cview(), box, curve, GeSpan<GeUint64>(keys.data(), kCount), options);
+        GeVector3BatchCurveKeys<double>(points.cview(), box, curve, GeSpan<GeUint64>(serialKeys.data(), kCount),
+                                        serial);
+        GE_CHECK(keys == serialKeys);
+    }
+}
+
+void TestReductions()
+{
+    const GeVector3Array<double> points = MakePoints(kCount);
+    GeReduceOptions options;
+    options.grainSize = kGrain;
+    GeAabb3<double> box;
+    GeVector3<double> centroid;
+    for (GeSize threads : {GeSize(1), GeSize(5)})
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        GeArena arena;
+        GeReduceOptions withArena = options;
+        withArena.pArena = &arena;
+        const GeAabb3<double> b = GeVector3BatchBounds<double>(points.cview(), options);
+        const GeVector3<double> c = GeVector3BatchCentroid<double>(points.cview(), withArena);
+        if (threads == 1)
+        {
+            box = b;
+            centroid = c;
+        }
+        GE_CHECK(SameBits(b.min, box.min) && SameBits(b.max, box.max));
+        GE_CHECK(SameBits(c, centroid));
+    }
+}
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"RadixSort", TestRadixSort},
+        {"Vector3Sort", TestVector3Sort},
+        {"Weld", TestWeld},
+        {"CurveKeys", TestCurveKeys},
+        {"Reductions", TestReductions},
+    });
+}
@@ -0,0 +1,334 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Scheduler tests: reproducible reductions and scans across thread counts,
+// exception propagation and nested parallel calls. Only needs
+// impl/geparallel.cpp and impl/gearena.cpp, so it is also built with
+// ThreadSanitizer (target geparalleltest_tsan).
+
+#include "geparallel.h"
+#include "getestutl.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+const GeSize kThreadCounts[] = {1, 2, 3, 5, 8};
+
+// Values over many magnitudes, so a different summation order would show
+std::vector<double> MakeValues(GeSize n)
+{
+    std::mt19937_64 rng(12345);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    std::vector<double> values(n);
+    for (double& v : values)
+        v = std::ldexp(mantissa(rng), exponent(rng));
+    return values;
+}
+
+bool SameBits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+double Sum(const std::vector<double>& values, GeSize grainSize, GeArena* pArena = nullptr)
+{
+    return GeParallelReduce(
+        GeSize(0), values.size(), grainSize, 0.0,
+        [&values](GeSize first, GeSize last) {
+            double sum = 0.0;
+            for (GeSize i = first; i < last; ++i)
+                sum += values[i];
+            return sum;
+        },
+        [](double a, double b) { return a + b; }, pArena);
+}
+
+void TestReduceDeterministic()
+{
+    const std::vector<double> values = MakeValues(100003);
+    for (GeSize grainSize : {GeSize(1000), GeSize(4096), GeSize(1 << 16)})
+    {
+        double reference = 0.0;
+        for (GeSize threads : kThreadCounts)
+        {
+            GeScheduler scheduler(threads);
+            GeSchedulerScope scope(scheduler);
+            for (int round = 0; round < 4; ++round)
+            {
+                const double sum = Sum(values, grainSize);
+                if (threads == 1 && round == 0)
+                    reference = sum;
+                GE_CHECK(SameBits(sum, reference));
+            }
+        }
+    }
+}
+
+void TestReduceArena()
+{
+    const std::vector<double> values = MakeValues(50000);
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GeArena arena;
+    GE_CHECK(SameBits(Sum(values, 777, &arena), Sum(values, 777)));
+    GE_CHECK(Sum(std::vector<double>(), 777, &arena) == 0.0);
+}
+
+void TestScanDeterministic()
+{
+    const std::vector<double> values = MakeValues(70001);
+    const auto plus = [](double a, double b) { return a + b; };
+    std::vector<double> inclusiveRef, exclusiveRef;
+    for (GeSize threads : kThreadCounts)
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        GeArena arena;
+        std::vector<double> inclusive(values.size()), exclusive(values.size());
+        GeParallelInclusiveScan(values.data(), inclusive.data(), values.size(), 0.0, plus, 1000);
+        GeParallelExclusiveScan(values.data(), exclusive.data(), values.size(), 0.0, plus, 1000, &arena);
+        if (threads == 1)
+        {
+            inclusiveRef = inclusive;
+            exclusiveRef = exclusive;
+        }
+        GE_CHECK(std::memcmp(inclusive.data(), inclusiveRef.data(), values.size() * sizeof(double)) == 0);
+        GE_CHECK(std::memcmp(exclusive.data(), exclusiveRef.data(), values.size() * sizeof(double)) == 0);
+    }
+}
+
+void TestScanValues()
+{
+    // Integer sums are exact, so the chunked scan must match the serial one
+    std::vector<GeInt64> values(54321);
+    std::iota(values.begin(), values.end(), GeInt64(-1000));
+    std::vector<GeInt64> inclusive(values.size()), exclusive(values.size()), serial(values.size());
+    std::partial_sum(values.begin(), values.end(), serial.begin());
+
+    GeScheduler scheduler(3);
+    GeSchedulerScope scope(scheduler);
+    const auto plus = [](GeInt64 a, GeInt64 b) { return a + b; };
+    GeParallelInclusiveScan(values.data(), inclusive.data(), values.size(), GeInt64(0), plus, 512);
+    GeParallelExclusiveScan(values.data(), exclusive.data(), values.size(), GeInt64(0), plus, 512);
+    GE_CHECK(inclusive == serial);
+    GE_CHECK(exclusive[0] == 0);
+    bool shifted = true;
+    for (GeSize i = 1; i < values.size(); ++i)
+        shifted = shifted && exclusive[i] == serial[i - 1];
+    GE_CHECK(shifted);
+
+    // In place
+    GeParallelInclusiveScan(values.data(), values.data(), values.size(), GeInt64(0), plus, 512);
+    GE_CHECK(values == serial);
+}
+
+void TestForCoversRange()
+{
+    for (GeSize threads : kThreadCounts)
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        std::vector<std::atomic<int>> hits(10007);
+        GeParallelFor(0, hits.size(), 7, [&hits](GeSize first, GeSize last) {
+            for (GeSize i = first; i < last; ++i)
+                hits[i].fetch_add(1);
+        });
+        bool once = true;
+        for (const std::atomic<int>& hit : hits)
+            once = once && hit.load() == 1;
+        GE_CHECK(once);
+    }
+}
+
+void TestForException()
+{
+    for (GeSize threads : kThreadCounts)
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        GE_CHECK_THROWS(GeParallelFor(0, 100000, 100,
+                                      [](GeSize first, GeSize last) {
+                                          if (first <= 54321 && 54321 < last)
+                                              throw std::runtime_error("chunk failed");
+                                      }),
+                        std::runtime_error);
+
+        // The scheduler is still usable afterwards
+        std::atomic<GeSize> count{0};
+        GeParallelFor(0, 100000, 100, [&count](GeSize first, GeSize last) { count.fetch_add(last - first); });
+        GE_CHECK(count.load() == 100000);
+    }
+}
+
+void TestReduceException()
+{
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GE_CHECK_THROWS(GeParallelReduce(
+                        GeSize(0), GeSize(100000), GeSize(1000), 0,
+                        [](GeSize first, GeSize) -> int {
+                            if (first >= 50000)
+                                throw std::out_of_range("map failed");
+                            return 1;
+                        },
+                        [](int a, int b) { return a + b; }),
+                    std::out_of_range);
+    const int chunks = GeParallelReduce(
+        GeSize(0), GeSize(100000), GeSize(1000), 0, [](GeSize, GeSize) { return 1; },
+        [](int a, int b) { return a + b; });
+    GE_CHECK(chunks == 100);
+}
+
+void TestNestedException()
+{
+    // Thrown two levels down, on whichever thread ran the inner chunk
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    GE_CHECK_THROWS(GeParallelFor(0, 64, 1,
+                                  [](GeSize first, GeSize last) {
+                                      for (GeSize i = first; i < last; ++i)
+                                      {
+                                          GeParallelFor(0, 1000, 10, [i](GeSize a, GeSize b) {
+                                              if (i == 37 && a <= 500 && 500 < b)
+                                                  throw std::logic_error("inner chunk failed");
+                                          });
+                                      }
+                                  }),
+                    std::logic_error);
+}
+
+void TestNestedForInSort()
+{
+    // GeParallelSort runs its halves as GeParallelInvoke tasks; each task
+    // here runs a GeParallelFor of its own alongside its sort, and the
+    // outer sorts are themselves chunks of a GeParallelFor
+    const GeSize kBlocks = 8;
+    const GeSize kBlockSize = 20000;
+    std::mt19937 rng(7);
+    std::vector<int> values(kBlocks * kBlockSize);
+    for (int& v : values)
+        v = static_cast<int>(rng() % 100000);
+
+    std::vector<int> expected = values;
+    for (GeSize b = 0; b < kBlocks; ++b)
+        std::sort(expected.begin() + b * kBlockSize, expected.begin() + (b + 1) * kBlockSize);
+
+    for (GeSize threads : kThreadCounts)
+    {
+        GeScheduler scheduler(threads);
+        GeSchedulerScope scope(scheduler);
+        std::vector<int> sorted = values;
+        std::vector<GeInt64> sums(kBlocks, 0);
+        GeParallelFor(0, kBlocks, 1, [&](GeSize first, GeSize last) {
+            for (GeSize b = first; b < last; ++b)
+            {
+                const auto begin = sorted.begin() + b * kBlockSize;
+                std::atomic<GeInt64> sum{0};
+                GeParallelInvoke(
+                    [&]() { GeParallelSort(begin, begin + kBlockSize, std::less<int>(), 1000); },
+                    [&]() {
+                        GeParallelFor(0, kBlockSize, 1000, [&](GeSize i0, GeSize i1) {
+                            GeInt64 local = 0;
+                            for (GeSize i = i0; i < i1; ++i)
+                                local += values[b * kBlockSize + i];
+                            sum.fetch_add(local);
+                        });
+                    });
+                sums[b] = sum.load();
+            }
+        });
+        GE_CHECK(sorted == expected);
+        bool sumsMatch = true;
+        for (GeSize b = 0; b < kBlocks; ++b)
+        {
+            const auto begin = values.begin() + b * kBlockSize;
+            sumsMatch = sumsMatch && sums[b] == std::accumulate(begin, begin + kBlockSize, GeInt64(0));
+        }
+        GE_CHECK(sumsMatch);
+    }
+}
+
+void TestSortComparatorThrows()
+{
+    GeScheduler scheduler(5);
+    GeSchedulerScope scope(scheduler);
+    std::vector<int> values(50000);
+    std::iota(values.rbegin(), values.rend(), 0);
+    GE_CHECK_THROWS(GeParallelSort(values.begin(), values.end(),
+                                   [](int a, int b) {
+                                       if (a == 12345 || b == 12345)
+                                           throw std::runtime_error("comparator failed");
+                                       return a < b;
+                                   },
+                                   1000),
+                    std::runtime_error);
+    GeParallelSort(values.begin(), values.end(), std::less<int>(), 1000);
+    GE_CHECK(std::is_sorted(values.begin(), values.end()));
+}
+
+void TestSchedulerScope()
+{
+    GeScheduler outer(3);
+    GeScheduler inner(5);
+    GeSchedulerScope outerScope(outer);
+    GE_CHECK(GeGetConcurrency() == 3);
+    {
+        GeSchedulerScope innerScope(inner);
+        GE_CHECK(GeGetConcurrency() == 5);
+        std::atomic<bool> sameInTasks{true};
+        GeParallelFor(0, 1000, 10, [&sameInTasks](GeSize, GeSize) {
+            if (GeGetConcurrency() != 5)
+                sameInTasks.store(false);
+        });
+        GE_CHECK(sameInTasks.load());
+    }
+    GE_CHECK(GeGetConcurrency() == 3);
+}
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"ReduceDeterministic", TestReduceDeterministic},
+        {"ReduceArena", TestReduceArena},
+        {"ScanDeterministic", TestScanDeterministic},
+        {"ScanValues", TestScanValues},
+        {"ForCoversRange", TestForCoversRange},
+        {"ForException", TestForException},
+        {"ReduceException", TestReduceException},
+        {"NestedException", TestNestedException},
+        {"NestedForInSort", TestNestedForInSort},
+        {"SortComparatorThrows", TestSortComparatorThrows},
+        {"SchedulerScope", TestSchedulerScope},
+    });
+}
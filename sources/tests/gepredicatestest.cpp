@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Robust predicates of gepredicates.h: exact signs on degenerate inputs the
+// double filter cannot decide, and their gestats.h counters summed over the
+// threads that called them.
+
+#include "gepredicates.h"
+#include "geparallel.h"
+#include "gestats.h"
+#include "getestutl.h"
+
+#include <atomic>
+
+namespace
+{
+using Vec = GeVector3<GeReal64>;
+
+// c on the line a -> b up to the last bit, where the double determinant
+// only sees rounding noise
+const Vec kA(0.5, 0.5, 0.0);
+const Vec kB(12.0, 12.0, 0.0);
+const Vec kC(24.0, 24.0, 0.0);
+const Vec kNudged(24.0, 24.000000000000004, 0.0);
+
+void TestOrient2dExact()
+{
+    GE_CHECK(GeOrient2d(kA, kB, kC) == 0);
+    GE_CHECK(GeOrient2d(kA, kB, kNudged) == 1);
+    GE_CHECK(GeOrient2d(kB, kA, kNudged) == -1);
+    GE_CHECK(GeOrient2d(Vec(0, 0, 0), Vec(1, 0, 0), Vec(0, 1, 0)) == 1);
+}
+
+void TestCocircularAndCospherical()
+{
+    const Vec a(1, 0, 0), b(0, 1, 0), c(-1, 0, 0), d(0, -1, 0);
+    GE_CHECK(GeInCircle(a, b, c, d) == 0);
+    GE_CHECK(GeInCircle(a, b, c, Vec(0, 0, 0)) == 1);
+    GE_CHECK(GeInCircle(a, b, c, Vec(0, -2, 0)) == -1);
+
+    const Vec e(0, 0, 1);
+    GE_CHECK(GeOrient3d(a, b, c, d) == 0);
+    GE_CHECK(GeInSphere(a, b, c, e, Vec(0, 0, -1)) == 0);
+    GE_CHECK(GeInSphere(a, b, c, e, Vec(0, 0, 0)) * GeOrient3d(a, b, c, e) > 0);
+}
+
+void TestStatsAcrossThreads()
+{
+    const GeSize kCalls = 4000;
+    GeScheduler scheduler(4);
+    GeSchedulerScope scope(scheduler);
+    GeResetStats();
+
+    std::atomic<GeSize> zeros{0};
+    GeParallelFor(0, kCalls, 100, [&zeros](GeSize first, GeSize last) {
+        for (GeSize i = first; i < last; ++i)
+        {
+            // every other call is decided by the filter
+            const Vec& c = i % 2 ? kC : Vec(0.0, 24.0, 0.0);
+            zeros.fetch_add(GeOrient2d(kA, kB, c) == 0);
+        }
+    });
+    GE_CHECK(zeros.load() == kCalls / 2);
+
+    const GeStatsSnapshot snapshot = GeGetStatsSnapshot();
+    const GeUint64 calls = GeStatsEnabled() ? kCalls : 0;
+    GE_CHECK(snapshot[GeStatCounter::kOrient2d] == calls);
+    GE_CHECK(snapshot[GeStatCounter::kOrient2dExact] == calls / 2);
+    GE_CHECK(snapshot[GeStatCounter::kOrient3d] == 0);
+    GE_CHECK(snapshot[GeStatCounter::kInSphereExact] == 0);
+}
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"Orient2dExact", TestOrient2dExact},
+        {"CocircularAndCospherical", TestCocircularAndCospherical},
+        {"StatsAcrossThreads", TestStatsAcrossThreads},
+    });
+}
@@ -0,0 +1,132 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Tolerant comparisons of gerealutl.h: the three-way GeRealCompare against
+// GeRealEqual/GeRealLess/GeRealGreater, their symmetries, and the relative
+// rule of the generic templates away from the ULP threshold.
+
+#include "gerealutl.h"
+#include "getestutl.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+template <typename T>
+std::vector<T> SpecialValues()
+{
+    using limits = std::numeric_limits<T>;
+    const T tiny = ge::details::RealCompareThreshold<T>();
+    return {T(0), -T(0), T(1), -T(1), T(1) + limits::epsilon(), limits::infinity(), -limits::infinity(),
+            limits::quiet_NaN(), limits::denorm_min(), -limits::denorm_min(), limits::min(), limits::max(),
+            limits::lowest(), tiny, -tiny, std::nextafter(tiny, T(0)), std::nextafter(tiny, T(1)), T(1e-30),
+            T(123.5), T(-123.5)};
+}
+
+template <typename T>
+std::vector<T> Tolerances()
+{
+    return {T(0), T(1e-6), T(1e-3), T(0.25), T(0.5)};
+}
+
+template <typename T>
+bool Consistent(T a, T b, T tol)
+{
+    const bool equal = GeRealEqual(a, b, tol);
+    const bool less = GeRealLess(a, b, tol);
+    const bool greater = GeRealGreater(a, b, tol);
+    const GeRealOrder order = GeRealCompare(a, b, tol);
+    const GeRealOrder expected = equal ? GeRealOrder::kEqual
+                                 : less ? GeRealOrder::kLess
+                                 : greater ? GeRealOrder::kGreater
+                                 : GeRealOrder::kUnordered;
+    return order == expected && (equal + less + greater) <= 1 && equal == GeRealEqual(b, a, tol) &&
+           less == GeRealGreater(b, a, tol);
+}
+
+template <typename T>
+void CheckCompareConsistent()
+{
+    int failures = 0;
+    for (T a : SpecialValues<T>())
+        for (T b : SpecialValues<T>())
+            for (T tol : Tolerances<T>())
+                failures += !Consistent(a, b, tol);
+
+    std::mt19937_64 rng(4);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-40, 40);
+    for (int i = 0; i < 200000; ++i)
+    {
+        const T a = static_cast<T>(std::ldexp(mantissa(rng), exponent(rng)));
+        T b = static_cast<T>(std::ldexp(mantissa(rng), exponent(rng)));
+        if (i % 3 == 1)
+            b = a * static_cast<T>(1.0 + mantissa(rng) * 1e-6);
+        else if (i % 3 == 2)
+            b = std::nextafter(a, T(0));
+        failures += !Consistent(a, b, T(1e-6));
+    }
+    GE_CHECK(failures == 0);
+}
+
+template <typename T>
+void CheckRelativeRule()
+{
+    // Magnitudes whose tolerance multiples are well above the threshold:
+    // the specializations give the generic relative answers
+    std::mt19937_64 rng(5);
+    std::uniform_real_distribution<double> value(100.0, 1000.0);
+    int failures = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        const T a = static_cast<T>(value(rng));
+        const T b = a * static_cast<T>(1.0 + (value(rng) - 550.0) * 4e-9);
+        const T tol = T(1e-6);
+        const T absA = std::fabs(a), absB = std::fabs(b);
+        const T bound = tol * (absA < absB ? absB : absA);
+        failures += GeRealEqual(a, b, tol) != (std::fabs(a - b) <= bound);
+        failures += GeRealLess(a, b, tol) != ((b - a) > bound);
+        failures += GeRealGreater(a, b, tol) != ((a - b) > bound);
+    }
+    GE_CHECK(failures == 0);
+}
+
+void TestCompareConsistent32() { CheckCompareConsistent<GeReal32>(); }
+void TestCompareConsistent64() { CheckCompareConsistent<GeReal64>(); }
+void TestRelativeRule32() { CheckRelativeRule<GeReal32>(); }
+void TestRelativeRule64() { CheckRelativeRule<GeReal64>(); }
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"CompareConsistent32", TestCompareConsistent32},
+        {"CompareConsistent64", TestCompareConsistent64},
+        {"RelativeRule32", TestRelativeRule32},
+        {"RelativeRule64", TestRelativeRule64},
+    });
+}
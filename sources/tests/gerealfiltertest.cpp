@@ -0,0 +1,157 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// GeRealBatchFilter and GeRealBatchMask on every supported SIMD tier against
+// GeRealCompare of each value, with special values on both sides and
+// lengths that leave vector tails.
+
+#include "gecpufeatures.h"
+#include "gerealutl.h"
+#include "getestutl.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+const GeSimdTier kTiers[] = {GeSimdTier::kScalar, GeSimdTier::kSse2, GeSimdTier::kAvx2, GeSimdTier::kAvx512};
+const GeRealOrder kOrders[] = {GeRealOrder::kLess, GeRealOrder::kEqual, GeRealOrder::kGreater, GeRealOrder::kUnordered};
+
+template <typename T>
+std::vector<T> SpecialValues()
+{
+    using limits = std::numeric_limits<T>;
+    const T threshold = ge::details::RealCompareThreshold<T>();
+    std::vector<T> values = {T(0), -T(0), T(1), -T(1), std::nextafter(T(1), T(2)), std::nextafter(T(1), T(0)),
+                             limits::infinity(), -limits::infinity(), limits::quiet_NaN(), -limits::quiet_NaN(),
+                             limits::denorm_min(), -limits::denorm_min(), limits::min(), limits::max(),
+                             limits::lowest(), threshold, -threshold, std::nextafter(threshold, T(0)),
+                             std::nextafter(threshold, T(1)), T(1e-30), T(123.5), T(-123.5)};
+    // tol * |v| just around the threshold for the tolerances below
+    values.push_back(threshold / T(1e-3));
+    values.push_back(std::nextafter(threshold / T(1e-3), T(0)));
+    values.push_back(-threshold / T(1e-6));
+    return values;
+}
+
+template <typename T>
+std::vector<T> MakeValues(std::mt19937_64& rng, GeSize n, T near)
+{
+    const std::vector<T> specials = SpecialValues<T>();
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<T> values(n);
+    for (GeSize i = 0; i < n; ++i)
+    {
+        switch (rng() % 4)
+        {
+        case 0:
+            values[i] = specials[rng() % specials.size()];
+            break;
+        case 1:
+            values[i] = near * static_cast<T>(1.0 + mantissa(rng) * 1e-5);
+            break;
+        case 2:
+            values[i] = std::nextafter(near, static_cast<T>(mantissa(rng)));
+            break;
+        default:
+            values[i] = static_cast<T>(std::ldexp(mantissa(rng), exponent(rng)));
+            break;
+        }
+    }
+    return values;
+}
+
+template <typename T>
+int CheckOne(const std::vector<T>& values, T value, T tol)
+{
+    const GeRealComparator<T> comparator(value, tol);
+    const GeSpan<const T> span(values.data(), values.size());
+    std::vector<GeUint32> indices(values.size());
+    std::vector<GeUint64> mask((values.size() + 63) / 64, ~GeUint64(0));
+    int failures = 0;
+    for (GeRealOrder order : kOrders)
+    {
+        std::vector<GeUint32> expected;
+        for (GeSize i = 0; i < values.size(); ++i)
+        {
+            if (GeRealCompare(values[i], value, tol) == order)
+                expected.push_back(static_cast<GeUint32>(i));
+        }
+
+        const GeSize count = GeRealBatchFilter<T>(span, comparator, order, GeSpan<GeUint32>(indices.data(), indices.size()));
+        failures += count != expected.size() || !std::equal(expected.begin(), expected.end(), indices.begin());
+
+        GeRealBatchMask<T>(span, comparator, order, GeSpan<GeUint64>(mask.data(), mask.size()));
+        std::vector<GeUint64> expectedMask(mask.size(), 0);
+        for (GeUint32 i : expected)
+            expectedMask[i / 64] |= GeUint64(1) << (i % 64);
+        failures += mask != expectedMask;
+    }
+    return failures;
+}
+
+template <typename T>
+void CheckTiers()
+{
+    const GeSimdTier initial = GeGetSimdTier();
+    const std::vector<T> fixed = SpecialValues<T>();
+    const T tolerances[] = {T(0), T(1e-6), T(1e-3), T(0.5), T(-1e-3), std::numeric_limits<T>::quiet_NaN()};
+
+    for (GeSimdTier tier : kTiers)
+    {
+        if (!GeSetSimdTier(tier))
+            continue;
+
+        std::mt19937_64 rng(42);
+        int failures = 0;
+        for (T value : fixed)
+        {
+            for (T tol : tolerances)
+            {
+                for (GeSize n : {GeSize(0), GeSize(1), GeSize(7), GeSize(64), GeSize(131)})
+                    failures += CheckOne(MakeValues(rng, n, value), value, tol);
+            }
+        }
+        if (failures != 0)
+            std::fprintf(stderr, "tier %s: %d mismatches\n", GeSimdTierName(tier), failures);
+        GE_CHECK(failures == 0);
+    }
+    GeSetSimdTier(initial);
+}
+
+void TestFilterTiers32() { CheckTiers<GeReal32>(); }
+void TestFilterTiers64() { CheckTiers<GeReal64>(); }
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"FilterTiers32", TestFilterTiers32},
+        {"FilterTiers64", TestFilterTiers64},
+    });
+}
@@ -0,0 +1,115 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef GEOMUTILS_TESTUTL_H
+#define GEOMUTILS_TESTUTL_H
+
+// Minimal checks for the test executables: each test is a function, a
+// failed GE_CHECK is reported with its location and the test goes on, and
+// GeRunTests returns the process exit code ctest looks at.
+
+#include <cstdio>
+#include <exception>
+#include <initializer_list>
+
+namespace ge
+{
+namespace details
+{
+namespace test
+{
+    inline int& FailureCount()
+    {
+        static int s_count = 0;
+        return s_count;
+    }
+
+    inline void Fail(const char* file, int line, const char* expr)
+    {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        ++FailureCount();
+    }
+} // end of test
+} // end of details
+} // end of ge
+
+#define GE_CHECK(expr)                                                       \
+    do                                                                       \
+    {                                                                        \
+        if (!(expr))                                                         \
+            ge::details::test::Fail(__FILE__, __LINE__, #expr);              \
+    } while (0)
+
+#define GE_CHECK_THROWS(expr, Exception)                                     \
+    do                                                                       \
+    {                                                                        \
+        bool thrown_ = false;                                                \
+        try                                                                  \
+        {                                                                    \
+            expr;                                                            \
+        }                                                                    \
+        catch (const Exception&)                                             \
+        {                                                                    \
+            thrown_ = true;                                                  \
+        }                                                                    \
+        if (!thrown_)                                                        \
+            ge::details::test::Fail(__FILE__, __LINE__, #expr " throws " #Exception); \
+    } while (0)
+
+//------------------------------------------------------------------------------
+/**
+    Named test function.
+*/
+struct GeTestCase
+{
+    const char* name;
+    void (*run)();
+};
+
+//------------------------------------------------------------------------------
+/**
+    Runs the tests in order and prints a line per test.
+
+    @return 0 when every check passed, 1 otherwise
+*/
+inline int GeRunTests(std::initializer_list<GeTestCase> tests)
+{
+    for (const GeTestCase& test : tests)
+    {
+        const int before = ge::details::test::FailureCount();
+        try
+        {
+            test.run();
+        }
+        catch (const std::exception& e)
+        {
+            std::fprintf(stderr, "%s: unexpected exception: %s\n", test.name, e.what());
+            ++ge::details::test::FailureCount();
+        }
+        std::printf("%-40s %s\n", test.name, ge::details::test::FailureCount() == before ? "ok" : "FAILED");
+    }
+    return ge::details::test::FailureCount() == 0 ? 0 : 1;
+}
+
+#endif // GEOMUTILS_TESTUTL_H
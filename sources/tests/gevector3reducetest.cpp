@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2025 Marat Sungatullin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Batch reductions of gevector3reduce.h against the rules their generic
+// templates state, serial and split across a scheduler.
+
+#include "gevector3reduce.h"
+#include "geparallel.h"
+#include "getestutl.h"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+template <typename T>
+bool SameBits(T a, T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// GeVector3BatchRealMinMax as documented: the first element GeRealEqual to
+// the exact extreme of its axis
+template <typename T>
+bool ReferenceRealMinMax(const GeVector3Array<T>& a, T tol, GeVector3<T>& outMin, GeVector3<T>& outMax)
+{
+    GeAabb3<T> box;
+    for (GeSize i = 0; i < a.size(); ++i)
+        box.Expand(a[i]);
+    if (box.IsEmpty())
+        return false;
+
+    const T* lanes[3] = {a.x(), a.y(), a.z()};
+    const T exact[6] = {box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z};
+    T found[6];
+    for (int k = 0; k < 6; ++k)
+    {
+        found[k] = exact[k];
+        for (GeSize i = 0; i < a.size(); ++i)
+        {
+            if (GeRealEqual(lanes[k % 3][i], exact[k], tol))
+            {
+                found[k] = lanes[k % 3][i];
+                break;
+            }
+        }
+    }
+    outMin = GeVector3<T>(found[0], found[1], found[2]);
+    outMax = GeVector3<T>(found[3], found[4], found[5]);
+    return true;
+}
+
+template <typename T>
+bool MatchesReference(const GeVector3Array<T>& a, T tol, const GeReduceOptions& options)
+{
+    GeVector3<T> min, max, refMin, refMax;
+    const bool found = GeVector3BatchRealMinMax<T>(a.cview(), tol, min, max, options);
+    if (found != ReferenceRealMinMax(a, tol, refMin, refMax))
+        return false;
+    return !found || (SameBits(min.x, refMin.x) && SameBits(min.y, refMin.y) && SameBits(min.z, refMin.z) &&
+                      SameBits(max.x, refMax.x) && SameBits(max.y, refMax.y) && SameBits(max.z, refMax.z));
+}
+
+template <typename T>
+void CheckInfinityMatchesFiniteExtreme()
+{
+    // inf is GeRealEqual to any finite m on the relative path, so it is the
+    // first element matching min.x = -5, whatever the input size
+    for (GeSize n : {GeSize(8), GeSize(63), GeSize(64), GeSize(128), GeSize(1000)})
+    {
+        GeVector3Array<T> a(n);
+        for (GeSize i = 0; i < n; ++i)
+            a.set(i, GeVector3<T>(T(1), T(2), T(3)));
+        a.x()[1] = std::numeric_limits<T>::infinity();
+        a.x()[n - 3] = T(-5);
+
+        GeVector3<T> min, max;
+        GE_CHECK(GeVector3BatchRealMinMax<T>(a.cview(), T(1e-3), min, max));
+        GE_CHECK(min.x == std::numeric_limits<T>::infinity());
+        GE_CHECK(MatchesReference(a, T(1e-3), GeReduceOptions()));
+
+        a.x()[1] = -std::numeric_limits<T>::infinity();
+        GE_CHECK(MatchesReference(a, T(1e-3), GeReduceOptions()));
+    }
+}
+
+template <typename T>
+void CheckRandomRealMinMax()
+{
+    std::mt19937_64 rng(11);
+    std::uniform_real_distribution<double> coord(-10.0, 10.0);
+    std::uniform_int_distribution<int> special(0, 400);
+    const T specials[] = {std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                          std::numeric_limits<T>::quiet_NaN(), T(0), -T(0)};
+
+    GeScheduler scheduler(3);
+    GeSchedulerScope scope(scheduler);
+    GeReduceOptions split;
+    split.grainSize = 256;
+    GeReduceOptions serial;
+    serial.parallel = false;
+
+    int failures = 0;
+    for (int round = 0; round < 200; ++round)
+    {
+        const GeSize n = 1 + static_cast<GeSize>(rng() % 3000);
+        GeVector3Array<T> a(n);
+        for (GeSize i = 0; i < n; ++i)
+        {
+            T v[3];
+            for (T& c : v)
+            {
+                const int s = special(rng);
+                c = s < 5 ? specials[s] : static_cast<T>(coord(rng));
+            }
+            a.set(i, GeVector3<T>(v[0], v[1], v[2]));
+        }
+        for (T tol : {T(0), T(1e-6), T(1e-2), T(0.6)})
+        {
+            failures += !MatchesReference(a, tol, serial);
+            failures += !MatchesReference(a, tol, split);
+        }
+    }
+    GE_CHECK(failures == 0);
+}
+
+void TestInfinityMatches32() { CheckInfinityMatchesFiniteExtreme<GeReal32>(); }
+void TestInfinityMatches64() { CheckInfinityMatchesFiniteExtreme<GeReal64>(); }
+void TestRandomRealMinMax32() { CheckRandomRealMinMax<GeReal32>(); }
+void TestRandomRealMinMax64() { CheckRandomRealMinMax<GeReal64>(); }
+} // namespace
+
+int main()
+{
+    return GeRunTests({
+        {"InfinityMatches32", TestInfinityMatches32},
+        {"InfinityMatches64", TestInfinityMatches64},
+        {"RandomRealMinMax32", TestRandomRealMinMax32},
+        {"RandomRealMinMax64", TestRandomRealMinMax64},
+    });
+}